@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""
+Generates src/fonts/fontCN_index.c, a sorted lookup index for the
+Font12CN/Font24CN tables used by Paint_DrawString_CN, and
+src/fonts/fontCN_index.h with the number of entries of each index.
+
+The CN tables key each glyph by its UTF-8 bytes (at most 3, so the Basic
+Multilingual Plane). The index lists every table position ordered by code
+point, equal code points in table order, so a binary search finds the same
+glyph the old front to back scan did. The cFONTs carry the entry count
+next to their table size, an index whose count no longer matches its
+table (not regenerated) is ignored and the table is scanned instead.
+
+Run from the repository root after changing any font*CN.c table:
+    python3 extras/font_cn_index.py
+"""
+import os
+import re
+
+FONTS = [12, 24]
+SRC = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src', 'fonts')
+OUT = os.path.join(SRC, 'fontCN_index.c')
+OUT_H = os.path.join(SRC, 'fontCN_index.h')
+
+
+def load(size):
+    text = open(os.path.join(SRC, 'font%dCN.c' % size), encoding='utf-8').read()
+    body = re.search(r'Font%dCN_Table\s*\[\]\s*=\s*\{(.*)\};\s*cFONT' % size, text, re.S).group(1)
+    body = re.sub(r'/\*.*?\*/', '', body, flags=re.S)
+    return [ord(c) for c in re.findall(r'\{\s*"(.)"', body)]
+
+
+def main():
+    lines = [
+        '/**',
+        '  ******************************************************************************',
+        '  * @file    fontCN_index.c',
+        '  * @brief   Font12CN/Font24CN table positions sorted by code point.',
+        '  *          Generated by extras/font_cn_index.py from the font*CN.c tables, do not edit.',
+        '  ******************************************************************************',
+        '  */',
+        '',
+        '/* Includes ------------------------------------------------------------------*/',
+        '#include "fonts.h"',
+    ]
+    header = [
+        '/**',
+        '  ******************************************************************************',
+        '  * @file    fontCN_index.h',
+        '  * @brief   Entries in the Font12CN/Font24CN indexes of fontCN_index.c.',
+        '  *          Generated by extras/font_cn_index.py from the font*CN.c tables, do not edit.',
+        '  ******************************************************************************',
+        '  */',
+        '#ifndef __FONTCN_INDEX_H',
+        '#define __FONTCN_INDEX_H',
+        '',
+    ]
+    for size in FONTS:
+        codes = load(size)
+        header.append('#define FONT%dCN_INDEX_SIZE %d' % (size, len(codes)))
+        order = sorted(range(len(codes)), key=lambda i: (codes[i], i))
+        lines += ['', '// %d glyphs' % len(codes),
+                  'const CH_CN_INDEX Font%dCN_Index[] = ' % size, '{']
+        for i in order:
+            lines.append("\t{0x%04X, %3d}, // '%s'" % (codes[i], i, chr(codes[i])))
+        lines.append('};')
+    header += ['', '#endif']
+    open(OUT, 'w', encoding='utf-8', newline='\r\n').write('\n'.join(lines) + '\n')
+    open(OUT_H, 'w', encoding='utf-8', newline='\r\n').write('\n'.join(header) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""
+Generates src/fonts/font_packed.cpp, the Font8-Font24 glyphs bit packed for
+USE_PACKED_FONTS builds.
+
+A glyph is stored as lines without byte padding: its columns (left to
+right, each Height bits top to bottom) for Paint's 270 degree canvas, or
+its rows (top to bottom, each Width bits left to right) under
+USE_LANDSCAPE_PAINT. Lines follow each other MSB first across byte
+boundaries, glyph after glyph. Paint_DrawChar pulls one line at a time
+out of the stream straight into its line blitter, so a glyph costs
+Width * Height bits of flash instead of whole bytes per line, and the
+padded font*.cpp / font_r270.cpp tables are no longer linked.
+
+--chars keeps only the given characters (space is always kept). A map
+from character to stored glyph is emitted then; characters left out draw
+as a space.
+
+Run from the repository root after changing any font*.cpp table:
+    python3 extras/font_pack.py [--chars "0123456789:. "]
+"""
+import argparse
+import os
+
+from font_r270 import FONTS, SRC, load
+
+OUT = os.path.join(SRC, 'font_packed.cpp')
+
+
+def glyph_bits(table, width, height, g, columns):
+    row_bytes = (width + 7) // 8
+    rows = table[g * height * row_bytes:(g + 1) * height * row_bytes]
+    pixel = lambda r, c: (rows[r * row_bytes + c // 8] >> (7 - c % 8)) & 1
+    if columns:
+        return [pixel(r, c) for c in range(width) for r in range(height)]
+    return [pixel(r, c) for r in range(height) for c in range(width)]
+
+
+def pack(bits):
+    bits = bits + [0] * (-len(bits) % 8)
+    return [sum(bits[b + i] << (7 - i) for i in range(8)) for b in range(0, len(bits), 8)]
+
+
+def emit(name, data, lines):
+    # The decoder reads a 32 bit window, pad so the last line stays inside the array
+    data = data + [0] * 4
+    lines.append('const uint8_t %s[] = ' % name)
+    lines.append('{')
+    for i in range(0, len(data), 16):
+        lines.append('\t' + ' '.join('0x%02X,' % b for b in data[i:i + 16]))
+    lines.append('};')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--chars', help='characters to keep, default all of 0x20-0x7E')
+    args = parser.parse_args()
+    keep = [chr(c) for c in range(32, 127)]
+    if args.chars is not None:
+        keep = [c for c in keep if c == ' ' or c in args.chars]
+
+    lines = [
+        '/**',
+        '  ******************************************************************************',
+        '  * @file    font_packed.cpp',
+        '  * @brief   Font8-Font24 glyphs as bit packed lines for USE_PACKED_FONTS.',
+        '  *          Generated by extras/font_pack.py from the font*.cpp tables, do not edit.',
+        '  ******************************************************************************',
+        '  */',
+        '',
+        '/* Includes ------------------------------------------------------------------*/',
+        '#include "../DEV_Config.h"',
+        '#include "fonts.h"',
+        '',
+        '#if USE_PACKED_FONTS',
+    ]
+    if len(keep) < 95:
+        slots = [keep.index(chr(c)) if chr(c) in keep else 0 for c in range(32, 127)]
+        lines += ['', '// Stored glyph of each character from \' \', %d of 95 kept' % len(keep),
+                  'static const uint8_t Font_PackedMap[] = ', '{']
+        for i in range(0, 95, 16):
+            lines.append('\t' + ' '.join('%d,' % s for s in slots[i:i + 16]))
+        lines.append('};')
+    for size in FONTS:
+        table, width, height = load(size)
+        padded = len(table) + width * ((height + 7) // 8) * 95
+        streams = {}
+        for columns in (True, False):
+            bits = []
+            for c in keep:
+                bits += glyph_bits(table, width, height, ord(c) - 32, columns)
+            streams[columns] = pack(bits)
+        lines += ['', '// %dx%d, %d bits per glyph, %d B packed (font%d.cpp + font_r270.cpp: %d B)'
+                  % (width, height, width * height, len(streams[True]), size, padded),
+                  '#if USE_LANDSCAPE_PAINT']
+        emit('Font%d_Packed' % size, streams[False], lines)
+        lines.append('#else')
+        emit('Font%d_Packed' % size, streams[True], lines)
+        lines += ['#endif', '',
+                  'sFONT Font%d = {' % size,
+                  '  NULL,',
+                  '  %d, /* Width */' % width,
+                  '  %d, /* Height */' % height,
+                  '  NULL,',
+                  '  Font%d_Packed,' % size,
+                  '  %s,' % ('Font_PackedMap' if len(keep) < 95 else 'NULL'),
+                  '};']
+    lines += ['', '#endif']
+    open(OUT, 'w', newline='\r\n').write('\n'.join(lines) + '\n')
+
+
+if __name__ == '__main__':
+    main()
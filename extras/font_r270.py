@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""
+Generates src/fonts/font_r270.cpp, the Font8-Font24 glyphs pre-rotated for
+Paint's 270 degree orientation.
+
+Each glyph is stored column by column (left to right). A column holds the
+glyph's rows top to bottom, MSB first, padded to whole bytes. Under
+ROTATE_270 a glyph column is one framebuffer row, so Paint_DrawChar can
+shift a column into place instead of plotting its pixels one by one.
+
+Run from the repository root after changing any font*.cpp table:
+    python3 extras/font_r270.py
+"""
+import os
+import re
+
+FONTS = [8, 12, 16, 20, 24]
+SRC = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src', 'fonts')
+OUT = os.path.join(SRC, 'font_r270.cpp')
+
+
+def load(size):
+    text = open(os.path.join(SRC, 'font%d.cpp' % size)).read()
+    body = re.search(r'Font%d_Table\s*\[\]\s*=\s*\{(.*?)\};' % size, text, re.S).group(1)
+    body = re.sub(r'//[^\n]*', '', body)
+    table = [int(b, 16) for b in re.findall(r'0x[0-9A-Fa-f]{2}', body)]
+    dims = re.search(r'sFONT\s+Font%d\s*=\s*\{\s*Font%d_Table\s*,\s*(\d+)\s*,[^\d]*(\d+)' % (size, size), text)
+    return table, int(dims.group(1)), int(dims.group(2))
+
+
+def rotate(table, width, height):
+    row_bytes = (width + 7) // 8
+    col_bytes = (height + 7) // 8
+    glyphs = len(table) // (height * row_bytes)
+    out = []
+    for g in range(glyphs):
+        rows = table[g * height * row_bytes:(g + 1) * height * row_bytes]
+        columns = []
+        for c in range(width):
+            bits = [(rows[r * row_bytes + c // 8] >> (7 - c % 8)) & 1 for r in range(height)]
+            bits += [0] * (col_bytes * 8 - height)
+            data = [sum(bits[b * 8 + i] << (7 - i) for i in range(8)) for b in range(col_bytes)]
+            columns.append((data, bits[:height]))
+        out.append(columns)
+    return out, col_bytes
+
+
+def main():
+    lines = [
+        '/**',
+        '  ******************************************************************************',
+        '  * @file    font_r270.cpp',
+        '  * @brief   Font8-Font24 glyphs pre-rotated for ROTATE_270, one column per line.',
+        '  *          Generated by extras/font_r270.py from the font*.cpp tables, do not edit.',
+        '  ******************************************************************************',
+        '  */',
+        '',
+        '/* Includes ------------------------------------------------------------------*/',
+        '#include "fonts.h"',
+    ]
+    for size in FONTS:
+        table, width, height = load(size)
+        glyphs, col_bytes = rotate(table, width, height)
+        lines += ['', '// %dx%d, %d byte(s) per column' % (width, height, col_bytes),
+                  'const uint8_t Font%d_Table_R270[] = ' % size, '{']
+        for g, columns in enumerate(glyphs):
+            lines.append("\t// @%d '%s' (%d columns)" % (g * width * col_bytes, chr(32 + g), width))
+            for data, bits in columns:
+                lines.append('\t' + ' '.join('0x%02X,' % b for b in data) + ' //' +
+                             ''.join('#' if b else ' ' for b in bits))
+            lines.append('')
+        lines[-1] = '};'
+    open(OUT, 'w', newline='\r\n').write('\n'.join(lines) + '\n')
+
+
+if __name__ == '__main__':
+    main()
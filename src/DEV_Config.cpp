@@ -28,7 +28,16 @@
 #
 ******************************************************************************/
 #include "DEV_Config.h"
+#if USE_HW_SPI
+#include "driver/spi_master.h"
 
+static spi_device_handle_t epd_spi = NULL;
+#endif
+static bool spi_hw_ready = false;
+
+// Bulk transfer accounting for throughput reporting
+static UDOUBLE spi_bulk_bytes = 0;
+static UDOUBLE spi_bulk_us = 0;
 
 void DEV_Delay_ms(unsigned int ms){
     if (ms == 0) return;
@@ -63,6 +72,8 @@ function:	Module Initialize, the BCM2835 library and initialize the pins, SPI pr
 parameter:
 Info:
 ******************************************************************************/
+static void DEV_SPI_Init(void);
+
 UBYTE DEV_Module_Init(void)
 {
 	//gpio
@@ -72,23 +83,52 @@ UBYTE DEV_Module_Init(void)
 	Serial.begin(115200);
 
 	// spi
-	// SPI.setDataMode(SPI_MODE0);
-	// SPI.setBitOrder(MSBFIRST);
-	// SPI.setClockDivider(SPI_CLOCK_DIV4);
-	// SPI.begin();
+	DEV_SPI_Init();
 
 	return 0;
 }
 
+/******************************************************************************
+function:	Attach the EPD pins to the SPI master, CS stays a GPIO owned by the EPD driver
+Info:		3-wire half duplex so DEV_SPI_ReadByte can turn MOSI around like the bit-bang path
+******************************************************************************/
+static void DEV_SPI_Init(void)
+{
+#if USE_HW_SPI
+    spi_bus_config_t bus = {};
+    bus.mosi_io_num = EPD_MOSI_PIN;
+    bus.miso_io_num = -1;
+    bus.sclk_io_num = EPD_SCK_PIN;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = EPD_SPI_MAX_CHUNK;
+
+    spi_device_interface_config_t dev = {};
+    dev.mode = 0;
+    dev.clock_speed_hz = EPD_SPI_CLOCK_HZ;
+    dev.spics_io_num = -1;
+    dev.flags = SPI_DEVICE_HALFDUPLEX | SPI_DEVICE_3WIRE;
+    dev.queue_size = EPD_SPI_QUEUE_DEPTH;
+
+    if (spi_bus_initialize(EPD_SPI_HOST, &bus, SPI_DMA_CH_AUTO) != ESP_OK) {
+        printf("DEV_SPI_Init: bus init failed, using bit-bang\r\n");
+        return;
+    }
+    if (spi_bus_add_device(EPD_SPI_HOST, &dev, &epd_spi) != ESP_OK) {
+        printf("DEV_SPI_Init: add device failed, using bit-bang\r\n");
+        return;
+    }
+    spi_hw_ready = true;
+#endif
+}
+
 /******************************************************************************
 function:
 			SPI read and write
 ******************************************************************************/
-void DEV_SPI_WriteByte(UBYTE data)
+// Clock one byte out on the GPIO pins, CS is left to the caller
+static void DEV_SPI_ShiftOut(UBYTE data)
 {
-    //SPI.beginTransaction(spi_settings);
-    digitalWrite(EPD_CS_PIN, GPIO_PIN_RESET);
-
     for (int i = 0; i < 8; i++)
     {
         if ((data & 0x80) == 0) digitalWrite(EPD_MOSI_PIN, GPIO_PIN_RESET); 
@@ -98,15 +138,40 @@ void DEV_SPI_WriteByte(UBYTE data)
         digitalWrite(EPD_SCK_PIN, GPIO_PIN_SET);     
         digitalWrite(EPD_SCK_PIN, GPIO_PIN_RESET);
     }
+}
 
-    //SPI.transfer(data);
+void DEV_SPI_WriteByte(UBYTE data)
+{
+    digitalWrite(EPD_CS_PIN, GPIO_PIN_RESET);
+#if USE_HW_SPI
+    if (spi_hw_ready) {
+        spi_transaction_t t = {};
+        t.flags = SPI_TRANS_USE_TXDATA;
+        t.length = 8;
+        t.tx_data[0] = data;
+        spi_device_polling_transmit(epd_spi, &t);
+        digitalWrite(EPD_CS_PIN, GPIO_PIN_SET);
+        return;
+    }
+#endif
+    DEV_SPI_ShiftOut(data);
     digitalWrite(EPD_CS_PIN, GPIO_PIN_SET);
-    //SPI.endTransaction();	
 }
 
 UBYTE DEV_SPI_ReadByte()
 {
     UBYTE j=0xff;
+#if USE_HW_SPI
+    if (spi_hw_ready) {
+        spi_transaction_t t = {};
+        t.flags = SPI_TRANS_USE_RXDATA;
+        t.rxlength = 8;
+        digitalWrite(EPD_CS_PIN, GPIO_PIN_RESET);
+        spi_device_polling_transmit(epd_spi, &t);
+        digitalWrite(EPD_CS_PIN, GPIO_PIN_SET);
+        return t.rx_data[0];
+    }
+#endif
     GPIO_Mode(EPD_MOSI_PIN, 0);
     digitalWrite(EPD_CS_PIN, GPIO_PIN_RESET);
     for (int i = 0; i < 8; i++)
@@ -125,12 +190,83 @@ UBYTE DEV_SPI_ReadByte()
 
 void DEV_SPI_Write_nByte(UBYTE *pData, UDOUBLE len)
 {
-    for (int i = 0; i < len; i++) {
-        DEV_SPI_WriteByte(pData[i]);
+    DEV_SPI_WriteBulk(pData, len);
+}
 
-        // Yield every 64 bytes to let other tasks run
-        if (i % 64 == 0) {
-            taskYIELD();
+/******************************************************************************
+function:	Stream len bytes with CS held low for the whole block
+parameter:
+    pData : Source bytes (copied through a DMA bounce buffer by the driver if in flash)
+    len   : Byte count
+Info:		Keeps EPD_SPI_QUEUE_DEPTH DMA transactions in flight so the next chunk
+			is already queued when the previous one completes
+******************************************************************************/
+void DEV_SPI_WriteBulk(const UBYTE *pData, UDOUBLE len)
+{
+    if (len == 0) return;
+    unsigned long start = micros();
+    digitalWrite(EPD_CS_PIN, GPIO_PIN_RESET);
+
+#if USE_HW_SPI
+    if (spi_hw_ready) {
+        static spi_transaction_t trans[EPD_SPI_QUEUE_DEPTH];
+        spi_transaction_t *done;
+        UDOUBLE offset = 0;
+        int queued = 0;
+        int slot = 0;
+
+        spi_device_acquire_bus(epd_spi, portMAX_DELAY);
+        while (offset < len) {
+            if (queued == EPD_SPI_QUEUE_DEPTH) {
+                spi_device_get_trans_result(epd_spi, &done, portMAX_DELAY);
+                --queued;
+            }
+            UDOUBLE chunk = len - offset;
+            if (chunk > EPD_SPI_MAX_CHUNK) chunk = EPD_SPI_MAX_CHUNK;
+
+            spi_transaction_t *t = &trans[slot];
+            memset(t, 0, sizeof(*t));
+            t->length = chunk * 8;
+            t->tx_buffer = pData + offset;
+            spi_device_queue_trans(epd_spi, t, portMAX_DELAY);
+            ++queued;
+            slot = (slot + 1) % EPD_SPI_QUEUE_DEPTH;
+            offset += chunk;
+        }
+        while (queued > 0) {
+            spi_device_get_trans_result(epd_spi, &done, portMAX_DELAY);
+            --queued;
+        }
+        spi_device_release_bus(epd_spi);
+    } else
+#endif
+    {
+        for (UDOUBLE i = 0; i < len; i++) {
+            DEV_SPI_ShiftOut(pData[i]);
+
+            // Yield now and then to let other tasks run
+            if ((i & 0xFF) == 0xFF) {
+                taskYIELD();
+            }
         }
     }
+
+    digitalWrite(EPD_CS_PIN, GPIO_PIN_SET);
+    spi_bulk_bytes += len;
+    spi_bulk_us += micros() - start;
+}
+
+/******************************************************************************
+function:	Bulk transfer throughput counters (bytes / microseconds since reset)
+******************************************************************************/
+void DEV_SPI_GetStats(UDOUBLE *bytes, UDOUBLE *us)
+{
+    if (bytes) *bytes = spi_bulk_bytes;
+    if (us) *us = spi_bulk_us;
+}
+
+void DEV_SPI_ResetStats(void)
+{
+    spi_bulk_bytes = 0;
+    spi_bulk_us = 0;
 }
@@ -63,6 +63,82 @@
 #define GPIO_PIN_SET   1
 #define GPIO_PIN_RESET 0
 
+/**
+ * SPI transport
+ * USE_HW_SPI 1 : ESP32 SPI master with DMA (falls back to bit-bang if init fails)
+ * USE_HW_SPI 0 : original bit-banged GPIO
+**/
+#ifndef USE_HW_SPI
+#define USE_HW_SPI          1
+#endif
+#define EPD_SPI_HOST        SPI2_HOST
+#define EPD_SPI_CLOCK_HZ    10000000    // SSD1677 write clock is rated to 20MHz
+#define EPD_SPI_MAX_CHUNK   4092        // Bytes per DMA transaction
+#define EPD_SPI_QUEUE_DEPTH 4           // Transactions kept in flight for bulk writes
+
+/**
+ * 4 gray framebuffer layout
+ * USE_NATIVE_4GRAY 1 : Scale 4 buffers hold the RAM 0x24 plane followed by the RAM 0x26 plane,
+ *                      pixel writes update both and refreshes stream them as is
+ * USE_NATIVE_4GRAY 0 : GUI_Paint 2bpp packed pixels, split into planes on every refresh
+**/
+#ifndef USE_NATIVE_4GRAY
+#define USE_NATIVE_4GRAY    0
+#endif
+
+/**
+ * Paint orientation
+ * USE_LANDSCAPE_PAINT 1 : canvases are 480x280 row major (ROTATE_0), text rows are sequential bytes,
+ *                         frames are rotated into panel order by an 8x8 bit transpose at transfer time
+ * USE_LANDSCAPE_PAINT 0 : canvases use the panel layout through a 270 degree Paint rotation
+**/
+#ifndef USE_LANDSCAPE_PAINT
+#define USE_LANDSCAPE_PAINT 0
+#endif
+
+/**
+ * Waveform timing per panel temperature band
+ * USE_TEMP_SCALED_LUTS 1 : LUT phases run at 150% below 5 C, 125% below 15 C, 85% from 22 C and
+ *                          70% from 30 C, timing not yet checked on every panel lot
+ * USE_TEMP_SCALED_LUTS 0 : stock timing at every temperature, the band is still read and logged
+**/
+#ifndef USE_TEMP_SCALED_LUTS
+#define USE_TEMP_SCALED_LUTS 0
+#endif
+
+/**
+ * Full page painting
+ * USE_BANDED_PAINT 1 : a page's draw calls are recorded once and replayed band by band by a worker
+ *                      task on each core, joined before the frame is sent
+ * USE_BANDED_PAINT 0 : pages are painted directly by the task that displays them
+**/
+#ifndef USE_BANDED_PAINT
+#define USE_BANDED_PAINT    0
+#endif
+
+/**
+ * Partial update frame
+ * USE_DERIVED_1GRAY 1 : no 1gray canvas, partial pages are painted BLACK/WHITE into the 4gray canvas
+ *                       and thresholded to 1bpp while the window is streamed, saves one plane of heap
+ * USE_DERIVED_1GRAY 0 : partial pages are painted into their own 1bpp canvas
+**/
+#ifndef USE_DERIVED_1GRAY
+#define USE_DERIVED_1GRAY   0
+#endif
+#if USE_DERIVED_1GRAY && USE_LANDSCAPE_PAINT
+#error "USE_DERIVED_1GRAY needs the panel layout canvas, USE_LANDSCAPE_PAINT must be 0"
+#endif
+
+/**
+ * ASCII font storage
+ * USE_PACKED_FONTS 1 : Font8-Font24 come from fonts/font_packed.cpp, glyph lines bit packed without
+ *                      padding (columns, or rows under USE_LANDSCAPE_PAINT) and decoded as they are drawn
+ * USE_PACKED_FONTS 0 : byte padded tables, rows in font*.cpp plus columns in font_r270.cpp
+**/
+#ifndef USE_PACKED_FONTS
+#define USE_PACKED_FONTS    0
+#endif
+
 /**
  * GPIO read and write
 **/
@@ -80,6 +156,9 @@ void GPIO_Mode(UWORD GPIO_Pin, UWORD Mode);
 void DEV_SPI_WriteByte(UBYTE data);
 UBYTE DEV_SPI_ReadByte();
 void DEV_SPI_Write_nByte(UBYTE *pData, UDOUBLE len);
+void DEV_SPI_WriteBulk(const UBYTE *pData, UDOUBLE len);
+void DEV_SPI_GetStats(UDOUBLE *bytes, UDOUBLE *us);
+void DEV_SPI_ResetStats(void);
 void DEV_Delay_ms(unsigned int ms);
 
 #endif
@@ -13,6 +13,23 @@
 #include "freertos/queue.h"
 
 #define POLL_MS 100
+#define TYPING_IDLE_MS 1500 // A2 typing mode ends this long after the last key
+// Ghosting scheduler, coarse grid over controller RAM (35 bytes x 480 rows)
+#define GHOST_TILE_BYTES 5
+#define GHOST_TILE_ROWS 40
+#define GHOST_TILES_X (EPD_3IN7_LINE_BYTES / GHOST_TILE_BYTES)
+#define GHOST_TILES_Y (EPD_3IN7_HEIGHT / GHOST_TILE_ROWS)
+// Partial diff, one hash per tile column of each strip of rows instead of a copy of the sent frame
+#define DIFF_STRIP_ROWS 8
+#define DIFF_STRIPS (EPD_3IN7_HEIGHT / DIFF_STRIP_ROWS)
+#define GHOST_TILE_MAX_UPDATES 60   // partial refreshes touching a tile before it is cleaned
+// Strip rewrites in a tile before it is cleaned, ~24 per strip, what 4 flips per pixel took with scrolling text
+#define GHOST_TILE_MAX_WRITES (GHOST_TILE_ROWS / DIFF_STRIP_ROWS * 24)
+#define GHOST_FULL_TILES (GHOST_TILES_X * GHOST_TILES_Y / 4) // saturated tiles before a full GC frame
+#define PAINT_BANDS 8 // memory row bands per banded repaint, claimed by the band workers in turn
+// Panel temperature is sampled on a full frame at most this often, it changes slowly
+#define TEMP_READ_INTERVAL_MS (5 * 60 * 1000)
+#define TEMP_READ_FRAMES 20 // or after this many full frames, whichever comes first
 
 // Public
 bool screen_on = false;
@@ -38,6 +55,15 @@ SignalData signal_data = {0};
 // Private
 // Screen
 static UBYTE *image_buf1 = NULL;
+static UBYTE *panel_buf1 = NULL;  // image_buf1 in controller layout, same buffer unless USE_LANDSCAPE_PAINT
+#if USE_DERIVED_1GRAY
+// No 1gray buffer, partial pages paint BLACK/WHITE into image_buf4 and are thresholded when sent
+#define FRAME1_BUF image_buf4
+#define FRAME1_BYTES (USE_NATIVE_4GRAY ? 1 : 2) // painted bytes per 1gray byte
+#else
+#define FRAME1_BUF panel_buf1
+#define FRAME1_BYTES 1
+#endif
 static UWORD image_size1 = 0;
 static UBYTE *image_buf4 = NULL;
 static UWORD image_size4 = 0;
@@ -53,10 +79,36 @@ static int idle_timeout_count = 0;
 static TickType_t last_activity_tick = 0;
 static uint32_t idle_page_tick_count = 0;
 static bool page_change_evt = false;
-static uint32_t partial_update_count = 0;
+static bool partial_ram_valid = false; // controller 0x24 holds the frame frame1_hash was taken of
+static uint32_t frame1_hash[DIFF_STRIPS][GHOST_TILES_X]; // FNV-1a of the 1gray frame in controller RAM
+// Ghosting
+typedef struct {
+    uint16_t updates;
+    uint16_t writes; // strips rewritten
+} GhostTile;
+static GhostTile ghost_tiles[GHOST_TILES_Y][GHOST_TILES_X];
+// Typing latency
+static volatile TickType_t last_key_tick = 0;
+static volatile bool key_seen = false; // last_key_tick is meaningless until the first key
+static bool typing_a2_dirty = false;
+static uint32_t typing_frames = 0;
+static uint32_t typing_latency_sum_ms = 0;
+static uint32_t typing_latency_max_ms = 0;
+// Panel temperature
+static bool temp_read = false; // a sensor reading is in effect
+static TickType_t temp_read_tick = 0;
+static uint32_t temp_frames = 0; // full frames since the last reading
 // Paint
 static char idle_c[2] = {0};
 
+#if USE_BANDED_PAINT
+static PAINT_LIST page_list;                // draw calls of the page being repainted
+static TaskHandle_t band_tasks[2] = {NULL, NULL}; // one band worker pinned to each core
+static SemaphoreHandle_t band_done = NULL;  // given by each worker once no bands are left
+static portMUX_TYPE band_mux = portMUX_INITIALIZER_UNLOCKED;
+static int band_next = 0;
+#endif
+
 
 // Public function for setting last activity tick in display loop for resetting idle timer
 void SetLastActivityTick(void) {
@@ -64,6 +116,12 @@ void SetLastActivityTick(void) {
     idle_timeout_count = 0; // Reset idle timeout count on activity
 }
 
+// Public function for keyboard task, marks a key press for the command page typing mode
+void SetLastKeyTick(void) {
+    last_key_tick = xTaskGetTickCount();
+    key_seen = true;
+}
+
 // Returns the image buffer size for a given gray mode
 static UWORD getImageSizeForMode(uint8_t gray) {
     if (gray == 4) {
@@ -80,6 +138,9 @@ static void paintConfigureForMode(uint8_t gray) {
     } else if (gray == 1 && image_buf1) {
         Paint_SelectImage(image_buf1);
         Paint_SetScale(2);
+    } else if (gray == 1 && USE_DERIVED_1GRAY && image_buf4) {
+        Paint_SelectImage(image_buf4);
+        Paint_SetScale(4);
     }
 }
 // Set the current page and update the last page
@@ -306,6 +367,7 @@ static void paintBootScreen(void) {
 // Paint the current page based on internal state using specifc paint function
 static void paintCurrentPage(void) {
     switch (current_page) {
+        case PAGE_BOOT:    paintBootScreen(); break;
         case PAGE_HOME:    paintHomeScreen(); break;
         case PAGE_IDLE:    paintBlankScreen(); break;
         case PAGE_COMMAND: paintCommandScreen(); break;
@@ -314,6 +376,330 @@ static void paintCurrentPage(void) {
     }
 }
 
+#if USE_BANDED_PAINT
+// Replays page_list into bands of the selected canvas until none are left, each band through its own PAINT copy
+static void paintBands(void) {
+    for (;;) {
+        taskENTER_CRITICAL(&band_mux);
+        int band = band_next++;
+        taskEXIT_CRITICAL(&band_mux);
+        if (band >= PAINT_BANDS) {
+            return;
+        }
+        PAINT ctx = Paint;
+        ctx.List = NULL;
+        PaintCtx_SetBand(&ctx, Paint.HeightMemory * band / PAINT_BANDS, Paint.HeightMemory * (band + 1) / PAINT_BANDS);
+        PaintCtx_Replay(&ctx, &page_list);
+    }
+}
+
+// Band worker, paints bands whenever a banded repaint is kicked off, runs indefinitely
+static void bandTask(void *pv) {
+    (void)pv;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        paintBands();
+        xSemaphoreGive(band_done);
+    }
+}
+
+// Start a band worker on each core, pages are painted directly if they cannot be created
+static void Display_StartBandTasks(void) {
+    if (!band_done && (band_done = xSemaphoreCreateCounting(2, 0)) == NULL) {
+        printf("ERROR: Failed to create band_done semaphore, painting pages directly\r\n");
+        return;
+    }
+    for (int core = 0; core < 2; core++) {
+        if (!band_tasks[core] && xTaskCreatePinnedToCore(bandTask, "paintBand", 4096, NULL, 2, &band_tasks[core], core) != pdPASS) {
+            band_tasks[core] = NULL;
+            printf("ERROR: Failed to start band worker on core %d, painting pages directly\r\n", core);
+        }
+    }
+}
+#endif
+
+// Paints the current page, banded across both cores when the band workers are running
+// The page is recorded once and replayed per band, pages that cannot be recorded whole are painted directly
+// Returns whether the page was banded
+static bool paintCurrentPageBanded(void) {
+#if USE_BANDED_PAINT
+    if (band_tasks[0] && band_tasks[1]) {
+        Paint_Record(&page_list);
+        paintCurrentPage();
+        Paint_Record(NULL);
+        if (!page_list.Incomplete) {
+            band_next = 0;
+            xTaskNotifyGive(band_tasks[0]);
+            xTaskNotifyGive(band_tasks[1]);
+            xSemaphoreTake(band_done, portMAX_DELAY);
+            xSemaphoreTake(band_done, portMAX_DELAY);
+            return true;
+        }
+        printf("Page %d does not fit a display list (%u ops), painting directly\r\n", current_page, page_list.Count);
+    }
+#endif
+    paintCurrentPage();
+    return false;
+}
+
+// Samples the panel sensor, the driver scales the waveform timing for its temperature band
+// Rate limited, the reading stays in effect for TEMP_READ_INTERVAL_MS or TEMP_READ_FRAMES full frames
+static void updatePanelTemperature(void) {
+    if (temp_read && ++temp_frames < TEMP_READ_FRAMES &&
+        (xTaskGetTickCount() - temp_read_tick) < pdMS_TO_TICKS(TEMP_READ_INTERVAL_MS)) {
+        return;
+    }
+    UBYTE band = EPD_3IN7_GetTempBand();
+    int temp = EPD_3IN7_ReadTemperature();
+    temp_read = temp != EPD_3IN7_TEMP_UNKNOWN; // retried on the next full frame after a timeout
+    temp_read_tick = xTaskGetTickCount();
+    temp_frames = 0;
+    if (temp == EPD_3IN7_TEMP_UNKNOWN) {
+        printf("Panel temperature: sensor read timed out, keeping band %u\r\n", band);
+    } else if (EPD_3IN7_GetTempBand() != band) {
+        printf("Panel temperature %d C: waveform band %u -> %u (%u%% timing)\r\n", temp, band,
+               EPD_3IN7_GetTempBand(), EPD_3IN7_TempBandScale(EPD_3IN7_GetTempBand()));
+    }
+}
+
+// Brings panel_buf1 up to date with what was painted into image_buf1
+static void syncPanelFrame1(void) {
+#if USE_LANDSCAPE_PAINT
+    EPD_3IN7_1Gray_FromLandscape(image_buf1, panel_buf1);
+#endif
+}
+
+// Returns n bytes of row y of the 1gray frame from byte bx, thresholded into tmp when derived
+static const UBYTE *frame1Row(int y, int bx, int n, UBYTE *tmp) {
+#if USE_DERIVED_1GRAY
+    EPD_3IN7_4Gray_ToMonoSpan(image_buf4, y, bx, n, tmp);
+    return tmp;
+#else
+    (void)n; (void)tmp;
+    return panel_buf1 + y * EPD_3IN7_LINE_BYTES + bx;
+#endif
+}
+
+// FNV-1a of each tile column of strip st of the 1gray frame, GHOST_TILES_X hashes into h
+static void hashFrame1Strip(int st, uint32_t *h) {
+    UBYTE row[EPD_3IN7_LINE_BYTES];
+    for (int tx = 0; tx < GHOST_TILES_X; tx++) h[tx] = 2166136261u;
+    for (int y = st * DIFF_STRIP_ROWS; y < (st + 1) * DIFF_STRIP_ROWS; y++) {
+        const UBYTE *cur = frame1Row(y, 0, EPD_3IN7_LINE_BYTES, row);
+        for (int tx = 0; tx < GHOST_TILES_X; tx++) {
+            uint32_t v = h[tx];
+            for (int i = 0; i < GHOST_TILE_BYTES; i++) v = (v ^ *cur++) * 16777619u;
+            h[tx] = v;
+        }
+    }
+}
+
+// Records the 1gray frame as what controller RAM holds, after all of it was sent
+static void hashFrame1(void) {
+    for (int st = 0; st < DIFF_STRIPS; st++) hashFrame1Strip(st, frame1_hash[st]);
+}
+
+// Paints the current page into image_buf4 and displays it with a full GC refresh, logs paint vs transfer cost
+// Pages without gray go through the 1gray GC waveform, one plane and a shorter waveform
+// The panel temperature is sampled first (rate limited) so the waveforms run with the timing of its band
+static void displayCurrentPageFull(void) {
+    UDOUBLE spi_bytes = 0, spi_us = 0, elided_cmds = 0, elided_bytes = 0;
+    UBYTE status;
+    updatePanelTemperature();
+    unsigned long t0 = micros();
+    bool banded = paintCurrentPageBanded();
+    bool mono = EPD_3IN7_4Gray_IsMono(image_buf4);
+    unsigned long t1 = micros();
+    DEV_SPI_ResetStats();
+    if (mono) {
+        EPD_3IN7_1Gray_SetWaveform(EPD_3IN7_LUT_1GRAY_GC);
+#if USE_DERIVED_1GRAY
+        status = EPD_3IN7_1Gray_Display_From4Gray_Start(image_buf4) | EPD_3IN7_WaitIdle();
+#else
+        EPD_3IN7_4Gray_ToMono(image_buf4, image_buf1);
+        syncPanelFrame1();
+        status = EPD_3IN7_1Gray_Display(panel_buf1);
+#endif
+        // Controller RAM now holds the 1gray frame, partial updates can diff against it
+        hashFrame1();
+        partial_ram_valid = true;
+    } else {
+#if USE_LANDSCAPE_PAINT
+        status = EPD_3IN7_4Gray_Display_Landscape(image_buf4);
+#else
+        status = EPD_3IN7_4Gray_Display(image_buf4);
+#endif
+        partial_ram_valid = false;
+    }
+    unsigned long t2 = micros();
+    // Full GC refresh, any A2 ghosting is gone
+    typing_a2_dirty = false;
+    memset(ghost_tiles, 0, sizeof(ghost_tiles));
+    EPD_3IN7_1Gray_SetWaveform(EPD_3IN7_LUT_1GRAY_DU);
+    DEV_SPI_GetStats(&spi_bytes, &spi_us);
+    EPD_3IN7_GetElidedStats(&elided_cmds, &elided_bytes);
+    printf("%s frame (%s): paint %lu us%s, transfer %lu B in %lu us (cache skipped %lu cmds / %lu B so far), busy %lu ms at band %u (%u%% timing), display total %lu us%s\r\n",
+           mono ? "1Gray GC" : "4Gray", USE_NATIVE_4GRAY ? "native" : "packed", t1 - t0, banded ? " banded" : "",
+           (unsigned long)spi_bytes, (unsigned long)spi_us,
+           (unsigned long)elided_cmds, (unsigned long)elided_bytes,
+           (unsigned long)EPD_3IN7_GetLastBusyTime(), EPD_3IN7_GetTempBand(),
+           EPD_3IN7_TempBandScale(EPD_3IN7_GetTempBand()), t2 - t1, status ? " (BUSY TIMEOUT)" : "");
+}
+
+// Pushes panel_buf1 as a 1gray partial frame, the waveform runs while the next frame is painted
+static void displayPartialFrame(void) {
+#if USE_DERIVED_1GRAY
+    UBYTE status = EPD_3IN7_1Gray_Display_From4Gray_Start(image_buf4);
+#else
+    UBYTE status = EPD_3IN7_1Gray_Display_Start(panel_buf1);
+#endif
+    hashFrame1();
+    if (status) {
+        printf("Partial frame: previous refresh hit BUSY timeout after %lu ms\r\n", (unsigned long)EPD_3IN7_GetLastBusyTime());
+    }
+    if (EPD_3IN7_1Gray_GetWaveform() == EPD_3IN7_LUT_1GRAY_GC) {
+        memset(ghost_tiles, 0, sizeof(ghost_tiles));
+    }
+    partial_ram_valid = true;
+}
+
+// Pushes a window of the 1gray frame in controller RAM coords (bytes/rows, inclusive)
+static void displayPartialWindow(int bx0, int y0, int bx1, int y1) {
+#if USE_DERIVED_1GRAY
+    UBYTE status = EPD_3IN7_1Gray_Display_Part_From4Gray_Start(image_buf4, bx0 * 8, y0, bx1 * 8 + 7, y1);
+#else
+    UBYTE status = EPD_3IN7_1Gray_Display_Part_Start(panel_buf1, bx0 * 8, y0, bx1 * 8 + 7, y1);
+#endif
+    if (status) {
+        printf("Partial window: previous refresh hit BUSY timeout after %lu ms\r\n", (unsigned long)EPD_3IN7_GetLastBusyTime());
+    }
+}
+
+// Inverts n bytes, a word at a time between the unaligned ends
+// Words go through memcpy rather than a uint32_t cast of the byte buffer, p is aligned by then
+static void invertBytes(UBYTE *p, int n) {
+    for (; n > 0 && ((uintptr_t)p & 3); n--) *p++ ^= 0xFF;
+    for (; n >= 4; n -= 4, p += 4) {
+        uint32_t w;
+        memcpy(&w, __builtin_assume_aligned(p, 4), sizeof(w));
+        w ^= 0xFFFFFFFF;
+        memcpy(__builtin_assume_aligned(p, 4), &w, sizeof(w));
+    }
+    for (; n > 0; n--) *p++ ^= 0xFF;
+}
+
+// Cleans ghosting in a RAM window without a full flash: DU the inverted window, then DU it back
+// A derived frame inverts its painted bytes, packed 2bpp XOR 0xFF flips every pixel's 0x24 bit
+static void cleanPartialWindow(int bx0, int y0, int bx1, int y1) {
+    UBYTE lut = EPD_3IN7_1Gray_GetWaveform();
+    EPD_3IN7_1Gray_SetWaveform(EPD_3IN7_LUT_1GRAY_DU);
+    for (int pass = 0; pass < 2; pass++) {
+        // Rows are contiguous, a window spanning whole rows is one run
+        if (bx0 == 0 && bx1 == EPD_3IN7_LINE_BYTES - 1) {
+            invertBytes(FRAME1_BUF + y0 * EPD_3IN7_LINE_BYTES * FRAME1_BYTES, (y1 - y0 + 1) * EPD_3IN7_LINE_BYTES * FRAME1_BYTES);
+        } else {
+            for (int y = y0; y <= y1; y++) {
+                invertBytes(FRAME1_BUF + (y * EPD_3IN7_LINE_BYTES + bx0) * FRAME1_BYTES, (bx1 - bx0 + 1) * FRAME1_BYTES);
+            }
+        }
+        // Start returns once the window is in controller RAM, safe to flip the buffer back
+        displayPartialWindow(bx0, y0, bx1, y1);
+    }
+    EPD_3IN7_1Gray_SetWaveform(lut);
+}
+
+// Diffs the painted 1gray frame against the last sent frame and refreshes only what changed
+// The diff compares per strip hashes, the window it sends is whole tile columns by whole strips
+// Per tile update/write counts decide when a region (or the whole screen) needs a cleanup
+// Byte columns below du_bx always go out with DU, only the rest gets the selected waveform
+// Returns true if anything was sent
+static bool schedulePartialFrame(int du_bx) {
+    syncPanelFrame1();
+    // Rest of controller RAM is stale after a 4gray frame or sleep, send everything once
+    if (!partial_ram_valid) {
+        UBYTE lut = EPD_3IN7_1Gray_GetWaveform();
+        if (du_bx > 0) EPD_3IN7_1Gray_SetWaveform(EPD_3IN7_LUT_1GRAY_DU);
+        displayPartialFrame();
+        EPD_3IN7_1Gray_SetWaveform(lut);
+        return true;
+    }
+
+    uint16_t writes[GHOST_TILES_Y][GHOST_TILES_X] = {0};
+    int changed = 0;
+    int tx0 = GHOST_TILES_X, tx1 = -1, st0 = DIFF_STRIPS, st1 = -1;
+    uint32_t h[GHOST_TILES_X];
+    for (int st = 0; st < DIFF_STRIPS; st++) {
+        hashFrame1Strip(st, h);
+        for (int tx = 0; tx < GHOST_TILES_X; tx++) {
+            if (h[tx] == frame1_hash[st][tx]) continue;
+            // Every path below sends at least this strip
+            frame1_hash[st][tx] = h[tx];
+            writes[st * DIFF_STRIP_ROWS / GHOST_TILE_ROWS][tx]++;
+            changed++;
+            if (tx < tx0) tx0 = tx;
+            if (tx > tx1) tx1 = tx;
+            if (st < st0) st0 = st;
+            st1 = st;
+        }
+    }
+    // Untouched, nothing to refresh
+    if (changed == 0) return false;
+
+    int saturated = 0;
+    int sx0 = GHOST_TILES_X, sx1 = -1, sy0 = GHOST_TILES_Y, sy1 = -1;
+    for (int ty = 0; ty < GHOST_TILES_Y; ty++) {
+        for (int tx = 0; tx < GHOST_TILES_X; tx++) {
+            GhostTile *t = &ghost_tiles[ty][tx];
+            if (writes[ty][tx]) {
+                t->updates++;
+                t->writes += writes[ty][tx];
+            }
+            if (t->updates >= GHOST_TILE_MAX_UPDATES || t->writes >= GHOST_TILE_MAX_WRITES) {
+                ++saturated;
+                if (tx < sx0) sx0 = tx;
+                if (tx > sx1) sx1 = tx;
+                if (ty < sy0) sy0 = ty;
+                if (ty > sy1) sy1 = ty;
+            }
+        }
+    }
+
+    // Ghosting everywhere, one flashing GC frame is cheaper than many local cleanups
+    if (saturated >= GHOST_FULL_TILES) {
+        UBYTE lut = EPD_3IN7_1Gray_GetWaveform();
+        printf("Ghosting: %d/%d tiles saturated, full GC refresh\r\n", saturated, GHOST_TILES_X * GHOST_TILES_Y);
+        EPD_3IN7_1Gray_SetWaveform(EPD_3IN7_LUT_1GRAY_GC);
+        displayPartialFrame();
+        EPD_3IN7_1Gray_SetWaveform(lut);
+        return true;
+    }
+
+    int bx0 = tx0 * GHOST_TILE_BYTES, bx1 = (tx1 + 1) * GHOST_TILE_BYTES - 1;
+    int y0 = st0 * DIFF_STRIP_ROWS, y1 = (st1 + 1) * DIFF_STRIP_ROWS - 1;
+    if (bx0 < du_bx) {
+        UBYTE lut = EPD_3IN7_1Gray_GetWaveform();
+        EPD_3IN7_1Gray_SetWaveform(EPD_3IN7_LUT_1GRAY_DU);
+        displayPartialWindow(bx0, y0, bx1 < du_bx ? bx1 : du_bx - 1, y1);
+        EPD_3IN7_1Gray_SetWaveform(lut);
+    }
+    if (bx1 >= du_bx) {
+        displayPartialWindow(bx0 > du_bx ? bx0 : du_bx, y0, bx1, y1);
+    }
+
+    // Local cleanup of the saturated tiles only
+    if (saturated) {
+        cleanPartialWindow(sx0 * GHOST_TILE_BYTES, sy0 * GHOST_TILE_ROWS,
+                           (sx1 + 1) * GHOST_TILE_BYTES - 1, (sy1 + 1) * GHOST_TILE_ROWS - 1);
+        for (int ty = sy0; ty <= sy1; ty++) {
+            for (int tx = sx0; tx <= sx1; tx++) {
+                ghost_tiles[ty][tx].updates = 0;
+                ghost_tiles[ty][tx].writes = 0;
+            }
+        }
+    }
+    return true;
+}
+
 // Wakes screen from sleep and gets ready for painting and displaying
 static void Display_Wake(void) {
     if (screen_on) {
@@ -325,20 +711,15 @@ static void Display_Wake(void) {
         setPage(last_page); // GRAY_MODE should correlate...
     }
 
-    // Somehow working where I initilize 1 gray and can do 4 gray updates? Im just going with it since its faster.
-    // Init 1Gray
+    // The driver switches gray mode per refresh, either init works
     if (GRAY_MODE == 1) {
         printf("Initializing 1Gray mode wake\r\n");
         EPD_3IN7_1Gray_Init();
-        DEV_Delay_ms(10);
     } else {
-        // Init 4Gray
-        //printf("Initializing 4Gray mode not\r\n");
-        printf("Initializing 1Gray mode wake supposed to be 4\r\n");
-        EPD_3IN7_1Gray_Init();
-        //EPD_3IN7_4Gray_Init(); 
-        DEV_Delay_ms(10);
+        printf("Initializing 4Gray mode wake\r\n");
+        EPD_3IN7_4Gray_Init();
     }
+    DEV_Delay_ms(10);
 
     screen_on = true;
     printf("Woke display\r\n");
@@ -353,6 +734,7 @@ static void Display_Sleep(bool clear_screen) {
         setPage(PAGE_NONE);
     }
     EPD_3IN7_Sleep();
+    partial_ram_valid = false;
     DEV_Delay_ms(50);
     printf("Slept display\r\n");
     screen_on = false;
@@ -405,19 +787,7 @@ void Display_ClearCommandHistory(void) {
 // Paint the current screen again in 4gray
 static void Display_UpdateFullScreen(void) {
     printf("Display_UpdateFullScreen\r\n");
-    if (GRAY_MODE == 1){
-        //printf("Initializing 4Gray mode not\r\n");
-        //EPD_3IN7_4Gray_Init();
-        //DEV_Delay_ms(20);
-    }
-    paintCurrentPage();
-    EPD_3IN7_4Gray_Display(image_buf4);
-
-    if (GRAY_MODE == 1){
-        printf("Initializing 1Gray mode UFS\r\n");
-        EPD_3IN7_1Gray_Init();
-        DEV_Delay_ms(10);
-    }
+    displayCurrentPageFull();
 }
 
 // Paints 4gray background image then gets ready for partial update if needed
@@ -425,21 +795,12 @@ static void Display_HandleScreenChange(void) {
     //printf("Display_HandleScreenChange\r\n");
     if (current_page == PAGE_NONE) return;
 
-    paintCurrentPage();
-    EPD_3IN7_4Gray_Display(image_buf4);
+    displayCurrentPageFull();
     
-    // Start partial updates if needed
+    // Start partial updates if needed, the driver switches to 1 gray on the first partial frame
     if (current_page == PAGE_IDLE || current_page == PAGE_COMMAND) {
-        // Switch to 1 gray for partial updates
-        printf("Initializing 1Gray mode HSC\r\n");
-        EPD_3IN7_1Gray_Init();
-        DEV_Delay_ms(10);
         GRAY_MODE = 1;
     } else {
-        // Init 4Gray
-        //printf("Initializing 4Gray mode not\r\n");
-        //EPD_3IN7_4Gray_Init(); 
-        //DEV_Delay_ms(20);
         GRAY_MODE = 4;
     }
 }
@@ -533,8 +894,39 @@ static void HandlePartialUpdate_command(void) {
         offset += 30;
     }
     
-    // Display final image :)    
-    EPD_3IN7_1Gray_Display(image_buf1);
+    // Display final image :) the scheduler sends only what changed
+    TickType_t key_tick = last_key_tick;
+    bool typing = key_seen && (xTaskGetTickCount() - key_tick) < pdMS_TO_TICKS(TYPING_IDLE_MS);
+
+    if (typing) {
+        // Keys arriving: A2 for the input lines, history above them (text rows are panel byte columns) stays DU
+        // History ends 6 rows above the input, a byte column holding any of it goes with the history
+        EPD_3IN7_1Gray_SetWaveform(EPD_3IN7_LUT_1GRAY_A2);
+        if (schedulePartialFrame((input_y - history_shift - 6) / 8 + 1)) {
+            typing_a2_dirty = true;
+            uint32_t latency_ms = (xTaskGetTickCount() - key_tick) * portTICK_PERIOD_MS;
+            typing_latency_sum_ms += latency_ms;
+            if (latency_ms > typing_latency_max_ms) typing_latency_max_ms = latency_ms;
+            ++typing_frames;
+        }
+    } else if (typing_a2_dirty) {
+        // Typing paused: GC the whole frame to clear A2 ghosting
+        EPD_3IN7_1Gray_SetWaveform(EPD_3IN7_LUT_1GRAY_GC);
+        syncPanelFrame1();
+        displayPartialFrame();
+        typing_a2_dirty = false;
+        if (typing_frames) {
+            printf("Typing: %lu A2 frames, key to frame sent avg %lu ms max %lu ms, last waveform %lu ms\r\n",
+                   (unsigned long)typing_frames, (unsigned long)(typing_latency_sum_ms / typing_frames),
+                   (unsigned long)typing_latency_max_ms, (unsigned long)EPD_3IN7_GetLastBusyTime());
+        }
+        typing_frames = 0;
+        typing_latency_sum_ms = 0;
+        typing_latency_max_ms = 0;
+    } else {
+        EPD_3IN7_1Gray_SetWaveform(EPD_3IN7_LUT_1GRAY_DU);
+        schedulePartialFrame(0);
+    }
 }
 
 // Clear screen, small pseudo random animation to prevent burn in during idle
@@ -630,45 +1022,8 @@ static void HandlePartialUpdate_idle(void) {
     //DEBUG
     //Paint_DrawRectangle(0, 0, display_w, display_h, BLACK, DOT_PIXEL_1X1, DRAW_FILL_FULL);
     
-    // Display final image
-    // Allocate region buffer'
-    /*
-    UWORD region_h = dy1 - dy0 + 1;
-    UWORD region_w = dx1 - dx0 + 1;
-    UWORD region_bytes_per_row = (region_w + 7) / 8;
-    UWORD full_bytes_per_row = (display_w + 7) / 8;
-    UBYTE region_buf[region_bytes_per_row * region_h];
-    memset(region_buf, 0, region_bytes_per_row * region_h);
-    // Copy region from main image buffer to region buffer
-    for (UWORD y = 0; y < region_h; y++) {
-        for (UWORD x = 0; x < region_w; x++) {
-            UWORD src_x = dx0 + y;
-            UWORD src_y = dy0 + x;
-
-            UWORD src_byte = src_x * full_bytes_per_row + (src_y / 8);
-            UBYTE src_bit = 7 - (src_y % 8);
-            UBYTE pixel = (image_buf1[src_byte] >> src_bit) & 0x01;
-
-            UWORD dst_byte = y * region_bytes_per_row + (x / 8);
-            UBYTE dst_bit = 7 - (x % 8);
-            if (pixel)
-                region_buf[dst_byte] |= (1 << dst_bit);
-        }
-    }
-    */
-    
-    // DEBUG
-    EPD_3IN7_1Gray_Display(image_buf1);
-    //EPD_3IN7_1Gray_Display(region_buf);
-    //EPD_3IN7_1Gray_Display_Part(image_buf1, dx0, dy0, dx1, dy1);
-    //EPD_3IN7_1Gray_Display_Part(image_buf1, dy0, dx0, dy1, dx1);
-    //EPD_3IN7_1Gray_Display_Part(region_buf, dy0, dx0, dy1, dx1);
-    //EPD_3IN7_1Gray_Display_Part(region_buf, dy0, display_w - 1 - dx1, dy1, display_w - 1 - dx0); //90
-    //EPD_3IN7_1Gray_Display_Part(region_buf, dy0, display_w - 1 - dx1, dy1, display_w - 1 - dx0); //270
-    //EPD_3IN7_1Gray_Display_Part(region_buf, 0, display_w - 1 - 64, 64, display_w - 1 - 0); //270 regularized
-    //EPD_3IN7_1Gray_Display_Part(region_buf, 0, 0, 64, 64);
-    // Rotate 180 degrees from 270 since the api regularizes axis to 90 degree rotation for this function? :)
-    //EPD_3IN7_1Gray_Display_Part(region_buf, display_w - 1 - dx1, display_h - 1 - dy1, display_w - 1 - dx0, display_h - 1 - dy0); //180
+    // Display final image, the scheduler sends only the moved box
+    schedulePartialFrame(0);
     
     // save previous position for next clear
     ++idle_page_tick_count;
@@ -777,7 +1132,7 @@ static void displayTask(void *pv) {
             }
 
             // Handle screen wake & changes
-            if (image_buf1 && image_buf4) {
+            if (image_buf4 && FRAME1_BUF) {
                 // Chirp screen awake
                 if(!screen_on) Display_Wake();
                 // Switch screen or update current fullsscreen
@@ -789,24 +1144,15 @@ static void displayTask(void *pv) {
                 } else {
                     Display_UpdateFullScreen();
                 }
-                partial_update_count = 0;
             }
             xSemaphoreGive(epd_mutex);
         }
 
         
-        //Partial update every 500ms (internal epd limit for 1gray_display) or repaint for ghosting every ~2 minutes
+        //Partial update every poll, schedulePartialFrame skips unchanged frames and cleans ghosting
         if (GRAY_MODE == 1 && screen_on) {
             if (xSemaphoreTake(epd_mutex, pdMS_TO_TICKS(2000)) == pdTRUE) {
-                if (partial_update_count >= 120) {
-                    if (current_page == PAGE_IDLE) {
-                        Display_UpdateFullScreen();
-                    }
-                    partial_update_count = 0;
-                } else {
-                    Display_HandlePartialUpdate();
-                    ++partial_update_count;
-                }
+                Display_HandlePartialUpdate();
                 xSemaphoreGive(epd_mutex);
             }
             SetLastActivityTick();
@@ -895,22 +1241,42 @@ void Display_Init(void) {
         free(image_buf4);
         return;
     }
+#if !USE_DERIVED_1GRAY
     if ((image_buf1 = (UBYTE *)malloc(image_size1)) == NULL) {
         printf("ERROR: Failed to allocate image_buf1 (%u bytes)\r\n", image_size1);
         free(image_buf1);
         return;
     }
+#endif
+#if USE_LANDSCAPE_PAINT
+    if ((panel_buf1 = (UBYTE *)malloc(image_size1)) == NULL) {
+        printf("ERROR: Failed to allocate panel_buf1 (%u bytes)\r\n", image_size1);
+        return;
+    }
+#else
+    panel_buf1 = image_buf1;
+#endif
     // Initilize two empty canvass so paint APIs are ready to use
+#if USE_LANDSCAPE_PAINT
+    // Row major 480x280, rotated into panel order when frames are sent
+    Paint_NewImage(image_buf4, EPD_3IN7_HEIGHT, EPD_3IN7_WIDTH, ROTATE_0, WHITE);
+    Paint_NewImage(image_buf1, EPD_3IN7_HEIGHT, EPD_3IN7_WIDTH, ROTATE_0, WHITE);
+#else
     Paint_NewImage(image_buf4, EPD_3IN7_WIDTH, EPD_3IN7_HEIGHT, 270, WHITE);
+#if !USE_DERIVED_1GRAY
     Paint_NewImage(image_buf1, EPD_3IN7_WIDTH, EPD_3IN7_HEIGHT, 270, WHITE);
+#endif
+#endif
     display_w = EPD_3IN7_HEIGHT;
     display_h = EPD_3IN7_WIDTH;
+#if USE_BANDED_PAINT
+    Display_StartBandTasks();
+#endif
     DEV_Delay_ms(200);
 
     // Start with displaying boot screen manually
     setPage(PAGE_BOOT);
-    paintBootScreen();
-    EPD_3IN7_4Gray_Display(image_buf4);
+    displayCurrentPageFull();
     DEV_Delay_ms(1000);
 
     // create queue & task
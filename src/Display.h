@@ -152,6 +152,7 @@ void Display_Event_ShowDynamicWindow(void);
 // Update internal display ds
 void Display_ClearCommandHistory(void);
 void SetLastActivityTick(void);
+void SetLastKeyTick(void);
 void SignalData_Reset(void);
 void ResetGlobalModeState(void);
 
@@ -31,8 +31,30 @@
 #include "EPD_3in7.h"
 #include "Debug.h"
 
-static const UBYTE lut_4Gray_GC[] =
+/******************************************************************************
+Command scripts: opcode, flags, length, payload[length], [delay], ... END
+    EPD_3IN7_SCR_DELAY : one more byte after the payload, delay in 10 ms units
+    EPD_3IN7_SCR_BUSY  : wait for BUSY after the command
+Scripts are constexpr so their layout is checked at compile time and the
+byte stream can be replayed off target.
+******************************************************************************/
+#define EPD_3IN7_SCR_BUSY  0x01
+#define EPD_3IN7_SCR_DELAY 0x02
+#define EPD_3IN7_SCR_END   0xFF // NOP opcode on the SSD1677, never sent
+
+// Walks a script and checks that END is its last byte
+static constexpr bool EPD_3IN7_ScriptOk(const UBYTE *s, UDOUBLE n, UDOUBLE i = 0)
 {
+    return i >= n ? false :
+           s[i] == EPD_3IN7_SCR_END ? i == n - 1 :
+           i + 2 >= n ? false :
+           EPD_3IN7_ScriptOk(s, n, i + 3 + s[i + 2] + ((s[i + 1] & EPD_3IN7_SCR_DELAY) ? 1 : 0));
+}
+#define EPD_3IN7_SCRIPT_CHECK(s) static_assert(EPD_3IN7_ScriptOk(s, sizeof(s)), #s " is malformed")
+
+static constexpr UBYTE lut_4Gray_GC[] =
+{
+0x32,0x00,105, // write LUT register
 0x2A,0x06,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//1
 0x28,0x06,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//2
 0x20,0x06,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//3
@@ -43,11 +65,13 @@ static const UBYTE lut_4Gray_GC[] =
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//8
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//9
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//10
-0x22,0x22,0x22,0x22,0x22
+0x22,0x22,0x22,0x22,0x22,
+EPD_3IN7_SCR_END
 };	
 
-static const UBYTE lut_1Gray_GC[] =
+static constexpr UBYTE lut_1Gray_GC[] =
 {
+0x32,0x00,105, // write LUT register
 0x2A,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//1
 0x05,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//2
 0x2A,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//3
@@ -58,11 +82,13 @@ static const UBYTE lut_1Gray_GC[] =
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//8
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//9
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//10
-0x22,0x22,0x22,0x22,0x22
+0x22,0x22,0x22,0x22,0x22,
+EPD_3IN7_SCR_END
 };  
 
-static const UBYTE lut_1Gray_DU[] =
+static constexpr UBYTE lut_1Gray_DU[] =
 {
+0x32,0x00,105, // write LUT register
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//1
 0x01,0x2A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 0x0A,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//3
@@ -73,11 +99,13 @@ static const UBYTE lut_1Gray_DU[] =
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,//9
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x22,0x22,0x22,0x22,0x22
+0x22,0x22,0x22,0x22,0x22,
+EPD_3IN7_SCR_END
 }; 
 
-static const UBYTE lut_1Gray_A2[] =
+static constexpr UBYTE lut_1Gray_A2[] =
 {
+0x32,0x00,105, // write LUT register
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, //1
 0x0A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, //2
 0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, //3
@@ -88,21 +116,244 @@ static const UBYTE lut_1Gray_A2[] =
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, //8
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, //9
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, //10
-0x22,0x22,0x22,0x22,0x22
-}; 
+0x22,0x22,0x22,0x22,0x22,
+EPD_3IN7_SCR_END
+};
+EPD_3IN7_SCRIPT_CHECK(lut_4Gray_GC);
+EPD_3IN7_SCRIPT_CHECK(lut_1Gray_GC);
+EPD_3IN7_SCRIPT_CHECK(lut_1Gray_DU);
+EPD_3IN7_SCRIPT_CHECK(lut_1Gray_A2);
+
+/******************************************************************************
+Temperature bands: the phase lengths (TP A-D of the 10 groups) are scaled per
+band of the 0x1B sensor reading, repeat counts and frame rates are left alone.
+The tables above are the 100% (15-21 C) timing. Neither the longer cold nor the
+shorter warm timing has been checked on every panel lot, they are only used with
+USE_TEMP_SCALED_LUTS, otherwise every band keeps the stock timing.
+******************************************************************************/
+#define EPD_3IN7_LUT_TP_OFFSET 50 // first group timing byte in a 105 byte LUT
+#define EPD_3IN7_LUT_TP_GROUPS 10
+#define EPD_3IN7_LUT_SCRIPT_BYTES (3 + 105 + 1)
+
+typedef struct {
+    int8_t min_c;   // band starts at this temperature
+    UBYTE scale;    // phase length in % of the stock tables
+} EPD_3IN7_TEMP_BAND;
+
+static constexpr EPD_3IN7_TEMP_BAND temp_bands[EPD_3IN7_TEMP_BANDS] =
+{
+#if USE_TEMP_SCALED_LUTS
+    {-128, 150}, // below 5 C, particles are slow to move
+    {   5, 125},
+    {  15, 100}, // stock timing
+    {  22,  85}, // room temperature
+    {  30,  70},
+#else
+    {-128, 100},
+    {   5, 100},
+    {  15, 100},
+    {  22, 100},
+    {  30, 100},
+#endif
+};
+
+// Bands start at -128, ascend, and one of them is the stock timing
+static constexpr bool EPD_3IN7_TempBandsOk(UBYTE i = 0, bool stock = false)
+{
+    return i == EPD_3IN7_TEMP_BANDS ? stock :
+           (i == 0 ? temp_bands[0].min_c == -128 : temp_bands[i].min_c > temp_bands[i - 1].min_c) &&
+           temp_bands[i].scale > 0 &&
+           EPD_3IN7_TempBandsOk(i + 1, stock || temp_bands[i].scale == 100);
+}
+static_assert(EPD_3IN7_TempBandsOk(), "temp_bands is malformed");
+static_assert(temp_bands[EPD_3IN7_TEMP_BAND_STOCK].scale == 100, "EPD_3IN7_TEMP_BAND_STOCK is not the 100% band");
+
+// Power on defaults after a hardware reset, RAM cleared to white
+static constexpr UBYTE script_init[] =
+{
+0x12, EPD_3IN7_SCR_DELAY, 0, 30,                // software reset, 300 ms
+0x46, EPD_3IN7_SCR_BUSY, 1, 0xF7,               // auto write 0x26 RAM white
+0x47, EPD_3IN7_SCR_BUSY, 1, 0xF7,               // auto write 0x24 RAM white
+0x01, 0, 3, 0xDF, 0x01, 0x00,                   // setting gate number
+0x03, 0, 1, 0x00,                               // set gate voltage
+0x04, 0, 3, 0x41, 0xA8, 0x32,                   // set source voltage
+0x11, 0, 1, 0x03,                               // set data entry sequence
+0x3C, 0, 1, 0x00,                               // set border
+0x0C, 0, 5, 0xAE, 0xC7, 0xC3, 0xC0, 0xC0,       // set booster strength
+0x18, 0, 1, 0x80,                               // set internal sensor on
+0x2C, 0, 1, 0x44,                               // set vcom value
+EPD_3IN7_SCR_END
+};
+EPD_3IN7_SCRIPT_CHECK(script_init);
+
+// Full RAM window and update control, follows the display option in the init sequence
+static constexpr UBYTE script_init_window[] =
+{
+0x44, 0, 4, 0x00, 0x00, 0x17, 0x01,             // setting X direction start/end position of RAM
+0x45, 0, 4, 0x00, 0x00, 0xDF, 0x01,             // setting Y direction start/end position of RAM
+0x22, 0, 1, 0xCF,                               // Display Update Control 2
+EPD_3IN7_SCR_END
+};
+EPD_3IN7_SCRIPT_CHECK(script_init_window);
+
+// Display option (0x37), these setting turn on previous function
+static constexpr UBYTE script_option_4Gray[] =
+{
+0x37, 0, 10, 0x00,0x00,0x00,0x00,0x00, 0x00,0x00,0x00,0x00,0x00,
+EPD_3IN7_SCR_END
+};
+static constexpr UBYTE script_option_1Gray[] =
+{
+0x37, 0, 10, 0x00,0xFF,0xFF,0xFF,0xFF, 0x4F,0xFF,0xFF,0xFF,0xFF, // can switch 1 gray or 4 gray
+EPD_3IN7_SCR_END
+};
+EPD_3IN7_SCRIPT_CHECK(script_option_4Gray);
+EPD_3IN7_SCRIPT_CHECK(script_option_1Gray); 
+
+static volatile TaskHandle_t busy_waiter = NULL;
+static volatile bool busy_edge_seen = false;
+static volatile TickType_t busy_edge_tick = 0;
+static bool busy_irq_attached = false;
+static TickType_t busy_start = 0;
+static UDOUBLE last_busy_ms = 0;
+static bool refresh_pending = false;
+static bool busy_timeout_latched = false; // a command waited out a refresh that timed out, not yet reported
+
+// Shadow of controller registers, lets the display routines skip commands already in effect
+typedef struct {
+    bool  valid;        // false after reset/sleep, everything below is unknown
+    UBYTE lut;          // 0x32 table index
+    UBYTE lut_band;     // temperature band the loaded table was scaled for
+    UBYTE gray;         // 0x37 display option, 1 or 4
+    UBYTE ctrl2;        // 0x22 display update control 2
+    UWORD win[4];       // 0x44/0x45 Xstart, Xend, Ystart, Yend
+} EPD_3IN7_STATE;
+static EPD_3IN7_STATE epd_state = {};
+static UDOUBLE elided_cmds = 0;
+static UDOUBLE elided_bytes = 0;
+static UBYTE partial_lut = EPD_3IN7_LUT_1GRAY_DU; // waveform for 1 gray display routines
+static UBYTE temp_band = EPD_3IN7_TEMP_BAND_STOCK;  // stock timing until the sensor is read
+static int temp_last = EPD_3IN7_TEMP_UNKNOWN;
+
+// BUSY falling edge: stamp the end of the wait and wake the waiting task
+static void IRAM_ATTR EPD_3IN7_BusyISR(void)
+{
+    busy_edge_tick = xTaskGetTickCountFromISR();
+    busy_edge_seen = true;
+    TaskHandle_t waiter = busy_waiter;
+    if (waiter) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(waiter, &woken);
+        if (woken) portYIELD_FROM_ISR();
+    }
+}
+
+/******************************************************************************
+function :	Start timing a BUSY period, the calling task gets the BUSY edge notification
+parameter:
+******************************************************************************/
+static void EPD_3IN7_BusyArm(void)
+{
+    if (!busy_irq_attached) {
+        attachInterrupt(digitalPinToInterrupt(EPD_BUSY_PIN), EPD_3IN7_BusyISR, FALLING);
+        busy_irq_attached = true;
+    }
+    busy_waiter = xTaskGetCurrentTaskHandle();
+    busy_edge_seen = false;
+    busy_start = xTaskGetTickCount();
+    ulTaskNotifyTake(pdTRUE, 0); // drop an edge left over from a previous wait
+}
+
+/******************************************************************************
+function :	Block on the BUSY edge interrupt until the armed BUSY period ends
+parameter:
+Info:
+    Returns 0 when the panel is idle, 1 after EPD_3IN7_BUSY_TIMEOUT_MS
+    The measured period is kept for EPD_3IN7_GetLastBusyTime
+******************************************************************************/
+static UBYTE EPD_3IN7_BusyWait(void)
+{
+    const TickType_t timeout = pdMS_TO_TICKS(EPD_3IN7_BUSY_TIMEOUT_MS);
+    busy_waiter = xTaskGetCurrentTaskHandle();
+
+    // The notification latches, so an edge between the read and the take is not lost
+    while (DEV_Digital_Read(EPD_BUSY_PIN)) {
+        TickType_t elapsed = xTaskGetTickCount() - busy_start;
+        if (elapsed >= timeout) {
+            busy_waiter = NULL;
+            last_busy_ms = elapsed * portTICK_PERIOD_MS;
+            Debug("EPD busy TIMEOUT\r\n");
+            return 1;
+        }
+        ulTaskNotifyTake(pdTRUE, timeout - elapsed);
+    }
+    busy_waiter = NULL;
+    TickType_t end = busy_edge_seen ? busy_edge_tick : xTaskGetTickCount();
+    last_busy_ms = (end - busy_start) * portTICK_PERIOD_MS;
+    return 0;
+}
+
+static UBYTE EPD_3IN7_ReadBusy_HIGH(void)
+{
+    Debug("EPD busy\r\n");
+    EPD_3IN7_BusyArm();
+    UBYTE status = EPD_3IN7_BusyWait();
+    Debug("EPD release\r\n");
+    return status;
+}
+
+/******************************************************************************
+function :	Wait for a refresh started by a *_Start routine to finish
+parameter:
+Info:
+    Returns 0 when idle (or nothing pending), 1 on BUSY timeout. A timeout
+    a command hit while waiting out the refresh is reported here once too
+******************************************************************************/
+UBYTE EPD_3IN7_WaitIdle(void)
+{
+    UBYTE status = busy_timeout_latched;
+    busy_timeout_latched = false;
+    if (!refresh_pending) return status;
+    status |= EPD_3IN7_BusyWait();
+    refresh_pending = false;
+    return status;
+}
+
+/******************************************************************************
+function :	Whether a started refresh is still running its waveform
+parameter:
+******************************************************************************/
+UBYTE EPD_3IN7_IsBusy(void)
+{
+    return refresh_pending && DEV_Digital_Read(EPD_BUSY_PIN);
+}
+
+/******************************************************************************
+function :	Duration of the last BUSY period in ms
+parameter:
+******************************************************************************/
+UDOUBLE EPD_3IN7_GetLastBusyTime(void)
+{
+    return last_busy_ms;
+}
 
 /******************************************************************************
 function :	Software reset
 parameter:
+Info:
+    Returns 1 if the refresh it waited out hit the BUSY timeout
 ******************************************************************************/
-static void EPD_3IN7_Reset(void)
+static UBYTE EPD_3IN7_Reset(void)
 {
+    UBYTE status = EPD_3IN7_WaitIdle();
+    epd_state.valid = false;
     DEV_Digital_Write(EPD_RST_PIN, 1);
     DEV_Delay_ms(300);
     DEV_Digital_Write(EPD_RST_PIN, 0);
     DEV_Delay_ms(3);
     DEV_Digital_Write(EPD_RST_PIN, 1);
     DEV_Delay_ms(300);
+    return status;
 }
 
 /******************************************************************************
@@ -112,12 +363,25 @@ parameter:
 ******************************************************************************/
 static void EPD_3IN7_SendCommand(UBYTE Reg)
 {
+    // The controller ignores the bus while a waveform runs, a timeout is kept for the next WaitIdle caller
+    if (refresh_pending && EPD_3IN7_WaitIdle()) busy_timeout_latched = true;
     DEV_Digital_Write(EPD_DC_PIN, 0);
     DEV_Digital_Write(EPD_CS_PIN, 0);
     DEV_SPI_WriteByte(Reg);
     DEV_Digital_Write(EPD_CS_PIN, 1);
 }
 
+/******************************************************************************
+function :	Master activation, returns while the waveform runs
+parameter:
+******************************************************************************/
+static void EPD_3IN7_TurnOnDisplay(void)
+{
+    EPD_3IN7_SendCommand(0x20);
+    EPD_3IN7_BusyArm();
+    refresh_pending = true;
+}
+
 /******************************************************************************
 function :	send data
 parameter:
@@ -131,451 +395,902 @@ static void EPD_3IN7_SendData(UBYTE Data)
     DEV_Digital_Write(EPD_CS_PIN, 1);
 }
 
-static void EPD_3IN7_ReadBusy_HIGH(void)
+/******************************************************************************
+function :	send a block of data in one data phase
+parameter:
+    pData : Write data
+    len   : Byte count
+******************************************************************************/
+static void EPD_3IN7_SendDataBlock(const UBYTE *pData, UDOUBLE len)
 {
-    Debug("EPD busy\r\n");
-    UBYTE busy;
-    int loops = 0;
-    const int maxLoops = 1000; // 1000 * 10ms = 6s timeout
-    do {
-        busy = DEV_Digital_Read(EPD_BUSY_PIN);
-        if (busy) { DEV_Delay_ms(10); }
-        if (++loops >= maxLoops) {
-            Debug("EPD busy TIMEOUT after 10 seconds\r\n");
-            loops = 0;
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    DEV_SPI_WriteBulk(pData, len);
+}
+
+/******************************************************************************
+function :	Fill a whole RAM plane on the controller, no SPI payload
+parameter:
+    Reg   : 0x47 for the 0x24 (B/W) RAM, 0x46 for the 0x26 RAM
+    White : 1 fills with 1 bits (white), 0 with 0 bits (black)
+******************************************************************************/
+static UBYTE EPD_3IN7_AutoWrite(UBYTE Reg, UBYTE White)
+{
+    EPD_3IN7_SendCommand(Reg);
+    EPD_3IN7_SendData(White ? 0xF7 : 0x77); // bit 7 value, full height/width step pattern
+    return EPD_3IN7_ReadBusy_HIGH();
+}
+
+/******************************************************************************
+function :	set the RAM address counter
+parameter:
+    X : Source (pixel) address
+    Y : Gate address
+******************************************************************************/
+static void EPD_3IN7_SetCursor(UWORD X, UWORD Y)
+{
+    UBYTE x[2] = { (UBYTE)(X & 0xff), (UBYTE)((X >> 8) & 0x03) };
+    UBYTE y[2] = { (UBYTE)(Y & 0xff), (UBYTE)((Y >> 8) & 0x03) };
+
+    EPD_3IN7_SendCommand(0x4E);
+    EPD_3IN7_SendDataBlock(x, 2);
+    EPD_3IN7_SendCommand(0x4F);
+    EPD_3IN7_SendDataBlock(y, 2);
+}
+
+/******************************************************************************
+function :	Stream a command script, one bulk data phase per command
+parameter:
+    script : EPD_3IN7_SCR_END terminated script
+******************************************************************************/
+static UBYTE EPD_3IN7_RunScript(const UBYTE *script)
+{
+    UBYTE status = 0;
+    while (script[0] != EPD_3IN7_SCR_END) {
+        UBYTE flags = script[1];
+        UBYTE len = script[2];
+        EPD_3IN7_SendCommand(script[0]);
+        if (len) EPD_3IN7_SendDataBlock(script + 3, len);
+        script += 3 + len;
+        if (flags & EPD_3IN7_SCR_DELAY) DEV_Delay_ms(10 * (*script++));
+        if (flags & EPD_3IN7_SCR_BUSY) status |= EPD_3IN7_ReadBusy_HIGH();
+    }
+    return status;
+}
+
+/******************************************************************************
+function :	Count a command (plus its data bytes) the state cache did not send
+parameter:
+******************************************************************************/
+static void EPD_3IN7_Elide(UDOUBLE data_len)
+{
+    elided_cmds++;
+    elided_bytes += 1 + data_len;
+}
+
+/******************************************************************************
+function :	set the RAM window (0x44/0x45) unless already in effect
+parameter:
+    Xstart/Xend : Source (pixel) range, inclusive
+    Ystart/Yend : Gate range, inclusive
+******************************************************************************/
+static void EPD_3IN7_SetWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    if (epd_state.valid && epd_state.win[0] == Xstart && epd_state.win[1] == Xend &&
+        epd_state.win[2] == Ystart && epd_state.win[3] == Yend) {
+        EPD_3IN7_Elide(4);
+        EPD_3IN7_Elide(4);
+        return;
+    }
+    UBYTE x[4] = { (UBYTE)(Xstart & 0xff), (UBYTE)((Xstart>>8) & 0x03), (UBYTE)(Xend & 0xff), (UBYTE)((Xend>>8) & 0x03) };
+    UBYTE y[4] = { (UBYTE)(Ystart & 0xff), (UBYTE)((Ystart>>8) & 0x03), (UBYTE)(Yend & 0xff), (UBYTE)((Yend>>8) & 0x03) };
+
+    EPD_3IN7_SendCommand(0x44); // setting X direction start/end position of RAM
+    EPD_3IN7_SendDataBlock(x, 4);
+    EPD_3IN7_SendCommand(0x45); // setting Y direction start/end position of RAM
+    EPD_3IN7_SendDataBlock(y, 4);
+    epd_state.win[0] = Xstart;
+    epd_state.win[1] = Xend;
+    epd_state.win[2] = Ystart;
+    epd_state.win[3] = Yend;
+}
+
+/******************************************************************************
+function :	set the display option (0x37) for 1 gray or 4 gray unless already in effect
+parameter:
+******************************************************************************/
+static void EPD_3IN7_SetGrayMode(UBYTE gray)
+{
+    if (epd_state.valid && epd_state.gray == gray) {
+        EPD_3IN7_Elide(10);
+        return;
+    }
+    EPD_3IN7_RunScript(gray == 4 ? script_option_4Gray : script_option_1Gray);
+    epd_state.gray = gray;
+}
+
+/******************************************************************************
+function :	set Display Update Control 2 (0x22) unless already in effect
+parameter:
+******************************************************************************/
+static void EPD_3IN7_SetUpdateControl(UBYTE ctrl)
+{
+    if (epd_state.valid && epd_state.ctrl2 == ctrl) {
+        EPD_3IN7_Elide(1);
+        return;
+    }
+    EPD_3IN7_SendCommand(0x22); // Display Update Control 2
+    EPD_3IN7_SendData(ctrl);
+    epd_state.ctrl2 = ctrl;
+}
+
+/******************************************************************************
+function :	Number of commands and bytes the state cache skipped since boot
+parameter:
+******************************************************************************/
+void EPD_3IN7_GetElidedStats(UDOUBLE *cmds, UDOUBLE *bytes)
+{
+    if (cmds) *cmds = elided_cmds;
+    if (bytes) *bytes = elided_bytes;
+}
+
+/******************************************************************************
+function :	Temperature band for a sensor reading
+parameter:
+    temp_c : Panel temperature in C
+******************************************************************************/
+UBYTE EPD_3IN7_TempBand(int temp_c)
+{
+    UBYTE band = 0;
+    while (band + 1 < EPD_3IN7_TEMP_BANDS && temp_c >= temp_bands[band + 1].min_c)
+        band++;
+    return band;
+}
+
+/******************************************************************************
+function :	Phase length of a temperature band, in % of the stock tables
+parameter:
+******************************************************************************/
+UBYTE EPD_3IN7_TempBandScale(UBYTE band)
+{
+    return band < EPD_3IN7_TEMP_BANDS ? temp_bands[band].scale : 100;
+}
+
+/******************************************************************************
+function :	Scale the phase lengths of a 105 byte LUT
+parameter:
+    Lut   : 105 byte table (0x32 data phase)
+    Scale : Phase length in %
+    Out   : 105 byte result, may be Lut
+Info:
+    Phases that are used stay at least 1 frame long, unused (0) phases stay off
+******************************************************************************/
+void EPD_3IN7_ScaleLUT(const UBYTE *Lut, UBYTE Scale, UBYTE *Out)
+{
+    if (Out != Lut) memcpy(Out, Lut, 105);
+    for (UBYTE g = 0; g < EPD_3IN7_LUT_TP_GROUPS; g++) {
+        UBYTE *tp = Out + EPD_3IN7_LUT_TP_OFFSET + 5 * g; // TP A, B, C, D, repeat count
+        for (UBYTE i = 0; i < 4; i++) {
+            if (tp[i] == 0) continue;
+            UDOUBLE v = ((UDOUBLE)tp[i] * Scale + 50) / 100;
+            tp[i] = v == 0 ? 1 : v > 0xFF ? 0xFF : (UBYTE)v;
         }
-    } while(busy);
-    DEV_Delay_ms(200);
-    Debug("EPD release\r\n");
+    }
+}
+
+/******************************************************************************
+function :	Read the internal temperature sensor and pick the waveform band
+parameter:
+Info:
+    Returns the temperature in C, EPD_3IN7_TEMP_UNKNOWN on a BUSY timeout
+    LUTs loaded after this use the new band
+******************************************************************************/
+int EPD_3IN7_ReadTemperature(void)
+{
+    EPD_3IN7_SetUpdateControl(0xA1); // clock on, load temperature, clock off
+    EPD_3IN7_SendCommand(0x20);
+    if (EPD_3IN7_ReadBusy_HIGH()) return EPD_3IN7_TEMP_UNKNOWN;
+
+    EPD_3IN7_SendCommand(0x1B); // 12 bit reading, integer C in the first byte
+    DEV_Digital_Write(EPD_DC_PIN, 1);
+    UBYTE whole = DEV_SPI_ReadByte();
+    DEV_SPI_ReadByte(); // 1/16 C fraction in the high nibble
+    temp_last = (int8_t)whole;
+    temp_band = EPD_3IN7_TempBand(temp_last);
+    return temp_last;
+}
+
+/******************************************************************************
+function :	Last sensor reading and the band the LUTs are scaled for
+parameter:
+******************************************************************************/
+int EPD_3IN7_GetTemperature(void)
+{
+    return temp_last;
+}
+
+UBYTE EPD_3IN7_GetTempBand(void)
+{
+    return temp_band;
 }
 
 /******************************************************************************
 function :	set the look-up tables
 parameter:
+Info:
+    The table is scaled for the current temperature band
 ******************************************************************************/
 void EPD_3IN7_Load_LUT(UBYTE lut)
 {
-  UWORD i;
-  EPD_3IN7_SendCommand(0x32);
-  for (i = 0; i < 105; i++)
-  {
-    if(lut == 0)
-        EPD_3IN7_SendData(lut_4Gray_GC[i]);
-    else if(lut == 1)
-        EPD_3IN7_SendData(lut_1Gray_GC[i]);
-    else if(lut == 2)
-        EPD_3IN7_SendData(lut_1Gray_DU[i]);
-    else if(lut == 3)
-        EPD_3IN7_SendData(lut_1Gray_A2[i]);  
-    else
-        Debug("There is no such lut \r\n");
+  const UBYTE *table;
+  if(lut == EPD_3IN7_LUT_4GRAY_GC)
+      table = lut_4Gray_GC;
+  else if(lut == EPD_3IN7_LUT_1GRAY_GC)
+      table = lut_1Gray_GC;
+  else if(lut == EPD_3IN7_LUT_1GRAY_DU)
+      table = lut_1Gray_DU;
+  else if(lut == EPD_3IN7_LUT_1GRAY_A2)
+      table = lut_1Gray_A2;
+  else {
+      Debug("There is no such lut \r\n");
+      return;
+  }
+  UBYTE scale = EPD_3IN7_TempBandScale(temp_band);
+  if (epd_state.valid && epd_state.lut == lut && EPD_3IN7_TempBandScale(epd_state.lut_band) == scale) {
+      EPD_3IN7_Elide(105);
+      return;
   }
+  if (scale == 100) {
+      EPD_3IN7_RunScript(table);
+  } else {
+      static UBYTE scaled[EPD_3IN7_LUT_SCRIPT_BYTES];
+      memcpy(scaled, table, sizeof(scaled));
+      EPD_3IN7_ScaleLUT(scaled + 3, scale, scaled + 3);
+      EPD_3IN7_RunScript(scaled);
+  }
+  epd_state.lut = lut;
+  epd_state.lut_band = temp_band;
+}
+
+/******************************************************************************
+function :	Select the waveform for the next refresh: display option, LUT, update control
+parameter:
+    gray : 1 or 4
+    lut  : EPD_3IN7_Load_LUT index
+******************************************************************************/
+static void EPD_3IN7_SelectWaveform(UBYTE gray, UBYTE lut)
+{
+    EPD_3IN7_SetGrayMode(gray);
+    EPD_3IN7_Load_LUT(lut);
+    EPD_3IN7_SetUpdateControl(gray == 4 ? 0xC7 : 0xCF);
 }
 
 /******************************************************************************
 function :	Initialize the e-Paper register
 parameter:
+    gray : display option to start in, 1 or 4
 ******************************************************************************/
-void EPD_3IN7_4Gray_Init(void)
+static UBYTE EPD_3IN7_Init(UBYTE gray)
 {
-    EPD_3IN7_Reset();
-    
-    EPD_3IN7_SendCommand(0x12);
-    DEV_Delay_ms(300);
-    
-    EPD_3IN7_SendCommand(0x46); 
-    EPD_3IN7_SendData(0xF7);
-    EPD_3IN7_ReadBusy_HIGH();
-    EPD_3IN7_SendCommand(0x47);
-    EPD_3IN7_SendData(0xF7);
-    EPD_3IN7_ReadBusy_HIGH(); 
-    
-    EPD_3IN7_SendCommand(0x01); // setting gaet number
-    EPD_3IN7_SendData(0xDF);
-    EPD_3IN7_SendData(0x01);
-    EPD_3IN7_SendData(0x00);
+    UBYTE status = EPD_3IN7_Reset();
+    status |= EPD_3IN7_RunScript(script_init);
+    EPD_3IN7_SetGrayMode(gray);
+    status |= EPD_3IN7_RunScript(script_init_window);
 
-    EPD_3IN7_SendCommand(0x03); // set gate voltage
-    EPD_3IN7_SendData(0x00);
+    // Registers the scripts left behind
+    epd_state.ctrl2 = 0xCF;
+    epd_state.win[0] = 0;
+    epd_state.win[1] = EPD_3IN7_WIDTH - 1;
+    epd_state.win[2] = 0;
+    epd_state.win[3] = EPD_3IN7_HEIGHT - 1;
+    epd_state.lut = 0xFF; // OTP waveform until the first Load_LUT
+    epd_state.valid = true;
+    return status;
+}
 
-    EPD_3IN7_SendCommand(0x04); // set source voltage
-    EPD_3IN7_SendData(0x41);
-    EPD_3IN7_SendData(0xA8);
-    EPD_3IN7_SendData(0x32);
+/******************************************************************************
+function :	Initialize the e-Paper register for 4 gray
+parameter:
+******************************************************************************/
+UBYTE EPD_3IN7_4Gray_Init(void)
+{
+    return EPD_3IN7_Init(4);
+}
 
-    EPD_3IN7_SendCommand(0x11); // set data entry sequence
-    EPD_3IN7_SendData(0x03);
+/******************************************************************************
+function :	Initialize the e-Paper register for 1 gray
+parameter:
+Info:
+    Either init is enough, the display routines switch the gray mode on demand
+******************************************************************************/
+UBYTE EPD_3IN7_1Gray_Init(void)
+{
+    return EPD_3IN7_Init(1);
+}
 
-    EPD_3IN7_SendCommand(0x3C); // set border 
+/******************************************************************************
+function :	Fill the screen with white or black
+parameter:
+    White : 1 white, 0 black
+Info:
+    Both planes are filled by the controller (0x46/0x47), nothing is streamed
+******************************************************************************/
+UBYTE EPD_3IN7_4Gray_Fill(UBYTE White)
+{
+    UBYTE status = 0;
+    EPD_3IN7_SendCommand(0x49);
     EPD_3IN7_SendData(0x00);
 
-    EPD_3IN7_SendCommand(0x0C); // set booster strength
-    EPD_3IN7_SendData(0xAE);
-    EPD_3IN7_SendData(0xC7);
-    EPD_3IN7_SendData(0xC3);
-    EPD_3IN7_SendData(0xC0);
-    EPD_3IN7_SendData(0xC0);  
-
-    EPD_3IN7_SendCommand(0x18); // set internal sensor on
-    EPD_3IN7_SendData(0x80);
-     
-    EPD_3IN7_SendCommand(0x2C); // set vcom value
-    EPD_3IN7_SendData(0x44);
-    
-    EPD_3IN7_SendCommand(0x37); // set display option, these setting turn on previous function
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);  
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);  
+    EPD_3IN7_SetWindow(0, 0, EPD_3IN7_WIDTH - 1, EPD_3IN7_HEIGHT - 1);
+    status |= EPD_3IN7_AutoWrite(0x47, White);
+    status |= EPD_3IN7_AutoWrite(0x46, White);
+      
+    EPD_3IN7_SelectWaveform(4, EPD_3IN7_LUT_4GRAY_GC);
 
-    EPD_3IN7_SendCommand(0x44); // setting X direction start/end position of RAM
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x17);
-    EPD_3IN7_SendData(0x01);
+    EPD_3IN7_TurnOnDisplay();
+    return status | EPD_3IN7_WaitIdle();
+}
 
-    EPD_3IN7_SendCommand(0x45); // setting Y direction start/end position of RAM
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0xDF);
-    EPD_3IN7_SendData(0x01);
+/******************************************************************************
+function :	Clear screen
+parameter:
+******************************************************************************/
+UBYTE EPD_3IN7_4Gray_Clear(void)
+{
+    return EPD_3IN7_4Gray_Fill(1);
+}
 
-    EPD_3IN7_SendCommand(0x22); // Display Update Control 2
-    EPD_3IN7_SendData(0xCF);
+/******************************************************************************
+function :  Fill the screen with white or black
+parameter:
+    White : 1 white, 0 black
+******************************************************************************/
+UBYTE EPD_3IN7_1Gray_Fill(UBYTE White)
+{
+  UBYTE status = 0;
+  EPD_3IN7_SetWindow(0, 0, EPD_3IN7_WIDTH - 1, EPD_3IN7_HEIGHT - 1);
+  status |= EPD_3IN7_AutoWrite(0x47, White);
+  
+  EPD_3IN7_SelectWaveform(1, EPD_3IN7_LUT_1GRAY_DU);
+  
+  EPD_3IN7_TurnOnDisplay();
+  return status | EPD_3IN7_WaitIdle();
 }
 
 /******************************************************************************
-function :  Initialize the e-Paper register
+function :  Clear screen
 parameter:
 ******************************************************************************/
-void EPD_3IN7_1Gray_Init(void)
+UBYTE EPD_3IN7_1Gray_Clear(void)
 {
-    EPD_3IN7_Reset();
-    
-    EPD_3IN7_SendCommand(0x12);
-    DEV_Delay_ms(300);
-    
-    EPD_3IN7_SendCommand(0x46); 
-    EPD_3IN7_SendData(0xF7);
-    EPD_3IN7_ReadBusy_HIGH();
-    EPD_3IN7_SendCommand(0x47);
-    EPD_3IN7_SendData(0xF7);
-    EPD_3IN7_ReadBusy_HIGH(); 
-    
-    EPD_3IN7_SendCommand(0x01); // setting gaet number
-    EPD_3IN7_SendData(0xDF);
-    EPD_3IN7_SendData(0x01);
-    EPD_3IN7_SendData(0x00);
+  return EPD_3IN7_1Gray_Fill(1);
+}
 
-    EPD_3IN7_SendCommand(0x03); // set gate voltage
-    EPD_3IN7_SendData(0x00);
+// Staging bands for frames converted on the way out
+static UBYTE band24[EPD_3IN7_BAND_ROWS * EPD_3IN7_LINE_BYTES];
+static UBYTE band26[EPD_3IN7_BAND_ROWS * EPD_3IN7_LINE_BYTES];
 
-    EPD_3IN7_SendCommand(0x04); // set source voltage
-    EPD_3IN7_SendData(0x41);
-    EPD_3IN7_SendData(0xA8);
-    EPD_3IN7_SendData(0x32);
+#if !USE_NATIVE_4GRAY
+/******************************************************************************
+function :	Split one 2bpp source byte (4 pixels) into its controller plane bits
+parameter:
+    b : 4 packed pixels, 0xC0 white, 0x80 gray1, 0x40 gray2, 0x00 black
+Info:
+    High nibble: RAM 0x24 bits (pixel bit 0, set for white and gray2)
+    Low nibble : RAM 0x26 bits (pixel bit 1, set for white and gray1)
+******************************************************************************/
+static constexpr UBYTE EPD_3IN7_SplitGray(UBYTE b)
+{
+    return (UBYTE)(((b & 0x40) << 1) | ((b & 0x10) << 2) | ((b & 0x04) << 3) | ((b & 0x01) << 4) |
+                   ((b & 0x80) >> 4) | ((b & 0x20) >> 3) | ((b & 0x08) >> 2) | ((b & 0x02) >> 1));
+}
 
-    EPD_3IN7_SendCommand(0x11); // set data entry sequence
-    EPD_3IN7_SendData(0x03);
+#define GRAY_SPLIT4(n)  EPD_3IN7_SplitGray(n), EPD_3IN7_SplitGray(n + 1), EPD_3IN7_SplitGray(n + 2), EPD_3IN7_SplitGray(n + 3)
+#define GRAY_SPLIT16(n) GRAY_SPLIT4(n), GRAY_SPLIT4(n + 4), GRAY_SPLIT4(n + 8), GRAY_SPLIT4(n + 12)
+#define GRAY_SPLIT64(n) GRAY_SPLIT16(n), GRAY_SPLIT16(n + 16), GRAY_SPLIT16(n + 32), GRAY_SPLIT16(n + 48)
 
-    EPD_3IN7_SendCommand(0x3C); // set border 
-    EPD_3IN7_SendData(0x00);
+static constexpr UBYTE gray_split[256] = {
+    GRAY_SPLIT64(0x00), GRAY_SPLIT64(0x40), GRAY_SPLIT64(0x80), GRAY_SPLIT64(0xC0)
+};
 
-    EPD_3IN7_SendCommand(0x0C); // set booster strength
-    EPD_3IN7_SendData(0xAE);
-    EPD_3IN7_SendData(0xC7);
-    EPD_3IN7_SendData(0xC3);
-    EPD_3IN7_SendData(0xC0);
-    EPD_3IN7_SendData(0xC0);  
-
-    EPD_3IN7_SendCommand(0x18); // set internal sensor on
-    EPD_3IN7_SendData(0x80);
-     
-    EPD_3IN7_SendCommand(0x2C); // set vcom value
-    EPD_3IN7_SendData(0x44);
-    
-    EPD_3IN7_SendCommand(0x37); // set display option, these setting turn on previous function
-    EPD_3IN7_SendData(0x00);     //can switch 1 gray or 4 gray
-    EPD_3IN7_SendData(0xFF);
-    EPD_3IN7_SendData(0xFF);
-    EPD_3IN7_SendData(0xFF);
-    EPD_3IN7_SendData(0xFF);  
-    EPD_3IN7_SendData(0x4F);
-    EPD_3IN7_SendData(0xFF);
-    EPD_3IN7_SendData(0xFF);
-    EPD_3IN7_SendData(0xFF);
-    EPD_3IN7_SendData(0xFF);  
+// The word kernels below load 4 source bytes at a time, byte 0 in the low bits
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "2bpp word kernels assume a little endian core");
 
-    EPD_3IN7_SendCommand(0x44); // setting X direction start/end position of RAM
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x17);
-    EPD_3IN7_SendData(0x01);
+// 4 source bytes through memcpy, no aliasing a UBYTE buffer as words. The callers
+// align p first, so this is a single 32 bit load
+static inline UDOUBLE EPD_3IN7_Load32(const UBYTE *p)
+{
+    UDOUBLE w;
+    memcpy(&w, __builtin_assume_aligned(p, 4), sizeof(w));
+    return w;
+}
 
-    EPD_3IN7_SendCommand(0x45); // setting Y direction start/end position of RAM
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0xDF);
-    EPD_3IN7_SendData(0x01);
+/******************************************************************************
+function :	Split 4 packed 2bpp bytes into plane nibbles, gray_split on a word
+parameter:
+    x : 4 source bytes as loaded from memory
+Info:
+    Two bit swap stages per byte. Each byte ends up with its pixels' bit 1
+    (RAM 0x26) in the high nibble and bit 0 (RAM 0x24) in the low nibble
+******************************************************************************/
+static inline UDOUBLE EPD_3IN7_Unzip2bpp(UDOUBLE x)
+{
+    UDOUBLE t;
+    t = (x ^ (x >> 1)) & 0x22222222;  x = x ^ t ^ (t << 1);
+    t = (x ^ (x >> 2)) & 0x0C0C0C0C;  x = x ^ t ^ (t << 2);
+    return x;
+}
 
-    EPD_3IN7_SendCommand(0x22); // Display Update Control 2
-    EPD_3IN7_SendData(0xCF);
+/******************************************************************************
+function :	Pair the RAM 0x24 nibbles of an unzipped word into 2 plane bytes
+parameter:
+    x : EPD_3IN7_Unzip2bpp output
+Info:
+    Plane byte 0 in bits 0-7, plane byte 1 in bits 16-23
+******************************************************************************/
+static inline UDOUBLE EPD_3IN7_Plane24(UDOUBLE x)
+{
+    x &= 0x0F0F0F0F;
+    return (x << 4) | (x >> 8);
 }
 
 /******************************************************************************
-function :	Clear screen
+function :	Pair the RAM 0x26 nibbles of an unzipped word into 2 plane bytes
 parameter:
+    x : EPD_3IN7_Unzip2bpp output
+Info:
+    Plane byte 0 in bits 0-7, plane byte 1 in bits 16-23
 ******************************************************************************/
-void EPD_3IN7_4Gray_Clear(void)
+static inline UDOUBLE EPD_3IN7_Plane26(UDOUBLE x)
 {
-    UWORD Width, Height;
-    Width = (EPD_3IN7_WIDTH % 8 == 0)? (EPD_3IN7_WIDTH / 8 ): (EPD_3IN7_WIDTH / 8 + 1);
-    Height = EPD_3IN7_HEIGHT;
+    x &= 0xF0F0F0F0;
+    return x | (x >> 12);
+}
+
+/******************************************************************************
+function :	Convert 2bpp rows into both controller planes in a single pass
+parameter:
+    Src   : 2bpp source, 2 bytes per plane byte
+    P24   : RAM 0x24 plane output
+    P26   : RAM 0x26 plane output
+    Bytes : Plane bytes to produce
+Info:
+    Through gray_split until Src is word aligned, then 16 pixels per word
+******************************************************************************/
+static void EPD_3IN7_4Gray_Split(const UBYTE *Src, UBYTE *P24, UBYTE *P26, UDOUBLE Bytes)
+{
+    UDOUBLE i = 0;
+    for (; i < Bytes && ((uintptr_t)(Src + 2 * i) & 3); i++) {
+        UBYTE a = gray_split[Src[2 * i]];
+        UBYTE b = gray_split[Src[2 * i + 1]];
+        P24[i] = (a & 0xF0) | (b >> 4);
+        P26[i] = (UBYTE)(a << 4) | (b & 0x0F);
+    }
+    for (; i + 2 <= Bytes; i += 2) {
+        UDOUBLE x = EPD_3IN7_Unzip2bpp(EPD_3IN7_Load32(Src + 2 * i));
+        UDOUBLE p24 = EPD_3IN7_Plane24(x), p26 = EPD_3IN7_Plane26(x);
+        P24[i] = (UBYTE)p24; P24[i + 1] = (UBYTE)(p24 >> 16);
+        P26[i] = (UBYTE)p26; P26[i + 1] = (UBYTE)(p26 >> 16);
+    }
+    for (; i < Bytes; i++) {
+        UBYTE a = gray_split[Src[2 * i]];
+        UBYTE b = gray_split[Src[2 * i + 1]];
+        P24[i] = (a & 0xF0) | (b >> 4);
+        P26[i] = (UBYTE)(a << 4) | (b & 0x0F);
+    }
+}
+#endif
+
+/******************************************************************************
+function :	Sends the image buffer in RAM to e-Paper and starts the refresh
+parameter:
+Info:
+    USE_NATIVE_4GRAY: Image already holds the 0x24 plane then the 0x26 plane
+    otherwise       : converted a band of rows at a time, each band is written to 0x24 and 0x26
+    Returns as soon as the frame is in controller RAM, Image may be repainted
+    while the waveform runs. The status is that of the previous refresh.
+******************************************************************************/
+UBYTE EPD_3IN7_4Gray_Display_Start(const UBYTE *Image)
+{
+    UBYTE status = EPD_3IN7_WaitIdle();
 
     EPD_3IN7_SendCommand(0x49);
     EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendCommand(0x4E);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendCommand(0x4F);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    
+    EPD_3IN7_SetWindow(0, 0, EPD_3IN7_WIDTH - 1, EPD_3IN7_HEIGHT - 1);
+
+#if USE_NATIVE_4GRAY
+    EPD_3IN7_SetCursor(0, 0);
     EPD_3IN7_SendCommand(0x24);
-    for (UWORD j = 0; j < Height; j++) {
-       for (UWORD i = 0; i < Width; i++) {
-           EPD_3IN7_SendData(0xff);
-       }
-    }
-    
-    EPD_3IN7_SendCommand(0x4E);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-     
-    EPD_3IN7_SendCommand(0x4F);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    
+    EPD_3IN7_SendDataBlock(Image, EPD_3IN7_PLANE_BYTES);
+
+    // new  data
+    EPD_3IN7_SetCursor(0, 0);
     EPD_3IN7_SendCommand(0x26);
-    for (UWORD j = 0; j < Height; j++) {
-       for (UWORD i = 0; i < Width; i++) {
-           EPD_3IN7_SendData(0xff);
-       }
+    EPD_3IN7_SendDataBlock(Image + EPD_3IN7_PLANE_BYTES, EPD_3IN7_PLANE_BYTES);
+#else
+    for (UWORD row = 0; row < EPD_3IN7_HEIGHT; row += EPD_3IN7_BAND_ROWS) {
+        UWORD rows = (EPD_3IN7_HEIGHT - row < EPD_3IN7_BAND_ROWS) ? (EPD_3IN7_HEIGHT - row) : EPD_3IN7_BAND_ROWS;
+        UDOUBLE bytes = (UDOUBLE)rows * EPD_3IN7_LINE_BYTES;
+
+        EPD_3IN7_4Gray_Split(Image + (UDOUBLE)row * EPD_3IN7_LINE_BYTES * 2, band24, band26, bytes);
+
+        EPD_3IN7_SetCursor(0, row);
+        EPD_3IN7_SendCommand(0x24);
+        EPD_3IN7_SendDataBlock(band24, bytes);
+
+        // new  data
+        EPD_3IN7_SetCursor(0, row);
+        EPD_3IN7_SendCommand(0x26);
+        EPD_3IN7_SendDataBlock(band26, bytes);
     }
-      
-    EPD_3IN7_Load_LUT(0);
-    EPD_3IN7_SendCommand(0x22);
-    EPD_3IN7_SendData(0xC7);
+#endif
 
-    EPD_3IN7_SendCommand(0x20);
-    EPD_3IN7_ReadBusy_HIGH();     
+    EPD_3IN7_SelectWaveform(4, EPD_3IN7_LUT_4GRAY_GC);
+    EPD_3IN7_TurnOnDisplay();
+    return status;
 }
 
 /******************************************************************************
-function :  Clear screen
+function :	Sends the image buffer in RAM to e-Paper and displays
 parameter:
 ******************************************************************************/
-void EPD_3IN7_1Gray_Clear(void)
+UBYTE EPD_3IN7_4Gray_Display(const UBYTE *Image)
 {
-  UWORD i;
-  UWORD IMAGE_COUNTER = EPD_3IN7_WIDTH * EPD_3IN7_HEIGHT / 8;
+    UBYTE status = EPD_3IN7_4Gray_Display_Start(Image);
+    return status | EPD_3IN7_WaitIdle();
+}
 
-  EPD_3IN7_SendCommand(0x4E);
-  EPD_3IN7_SendData(0x00);
-  EPD_3IN7_SendData(0x00);
-  EPD_3IN7_SendCommand(0x4F);
-  EPD_3IN7_SendData(0x00);
-  EPD_3IN7_SendData(0x00);
+/******************************************************************************
+function :	Transpose an 8x8 bit block (MSB is column 0)
+parameter:
+    A : 8 source rows, m bytes apart
+    B : 8 destination rows, n bytes apart (may be negative)
+Info:
+    B[j] bit (7-i) = A[i] bit (7-j), three swap stages on two 32 bit halves
+******************************************************************************/
+static inline void EPD_3IN7_Transpose8(const UBYTE *A, int m, UBYTE *B, int n)
+{
+    UDOUBLE x = ((UDOUBLE)A[0] << 24) | ((UDOUBLE)A[m] << 16) | ((UDOUBLE)A[2 * m] << 8) | A[3 * m];
+    UDOUBLE y = ((UDOUBLE)A[4 * m] << 24) | ((UDOUBLE)A[5 * m] << 16) | ((UDOUBLE)A[6 * m] << 8) | A[7 * m];
+    UDOUBLE t;
 
-  EPD_3IN7_SendCommand(0x24);
-  for (i = 0; i < IMAGE_COUNTER; i++)
-  {
-    EPD_3IN7_SendData(0xff);
-  }
-  
-  EPD_3IN7_Load_LUT(2);
-  
-  EPD_3IN7_SendCommand(0x20);
-  EPD_3IN7_ReadBusy_HIGH();    
+    t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+
+    B[0] = x >> 24;     B[n] = x >> 16;     B[2 * n] = x >> 8; B[3 * n] = x;
+    B[4 * n] = y >> 24; B[5 * n] = y >> 16; B[6 * n] = y >> 8; B[7 * n] = y;
 }
 
 /******************************************************************************
-function :	Sends the image buffer in RAM to e-Paper and displays
+function :	Rotate one 1bpp landscape byte column into 8 panel gate rows
+parameter:
+    Land : landscape plane (EPD_3IN7_LAND_LINE_BYTES per row, 280 rows)
+    c    : byte column, covers logical x = 8c..8c+7
+    Dst  : panel row holding logical x = 8c (gate 479 - 8c), rows below it follow at -LINE_BYTES
+Info:
+    Rotation 270: panel source X = logical y, panel gate Y = 479 - logical x
+******************************************************************************/
+static void EPD_3IN7_RotateColumn(const UBYTE *Land, UWORD c, UBYTE *Dst)
+{
+    for (UWORD r = 0; r < EPD_3IN7_LINE_BYTES; r++) {
+        EPD_3IN7_Transpose8(Land + (UDOUBLE)8 * r * EPD_3IN7_LAND_LINE_BYTES + c, EPD_3IN7_LAND_LINE_BYTES,
+                            Dst + r, -EPD_3IN7_LINE_BYTES);
+    }
+}
+
+/******************************************************************************
+function :	Rotate a 1bpp landscape canvas into the panel layout
+parameter:
+    Land  : 480x280 row major frame
+    Panel : EPD_3IN7_PLANE_BYTES output in controller layout
+******************************************************************************/
+void EPD_3IN7_1Gray_FromLandscape(const UBYTE *Land, UBYTE *Panel)
+{
+    for (UWORD c = 0; c < EPD_3IN7_LAND_LINE_BYTES; c++) {
+        EPD_3IN7_RotateColumn(Land, c, Panel + (UDOUBLE)(EPD_3IN7_HEIGHT - 1 - 8 * c) * EPD_3IN7_LINE_BYTES);
+    }
+}
+
+/******************************************************************************
+function :	Sends a 4 gray landscape canvas to e-Paper and starts the refresh
 parameter:
+Info:
+    USE_NATIVE_4GRAY: Image holds two 1bpp landscape planes, each one is transposed
+    otherwise       : 2bpp landscape pixels, each 8x8 block is split into planes then transposed
+    Rotated a band of gate rows at a time, same contract as EPD_3IN7_4Gray_Display_Start
 ******************************************************************************/
-void EPD_3IN7_4Gray_Display(const UBYTE *Image)
+UBYTE EPD_3IN7_4Gray_Display_Landscape_Start(const UBYTE *Image)
 {
-    UDOUBLE i,j,k;
-    UBYTE temp1,temp2,temp3;
-    
+    const UWORD band_rows = EPD_3IN7_BAND_ROWS / 8 * 8;
+    UBYTE status = EPD_3IN7_WaitIdle();
+
     EPD_3IN7_SendCommand(0x49);
     EPD_3IN7_SendData(0x00);
+    EPD_3IN7_SetWindow(0, 0, EPD_3IN7_WIDTH - 1, EPD_3IN7_HEIGHT - 1);
 
-    
-    EPD_3IN7_SendCommand(0x4E);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    
-    
-    EPD_3IN7_SendCommand(0x4F);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    
-    EPD_3IN7_SendCommand(0x24);
-    for(i=0;i<16800;i++){
-        temp3=0;
-        for(j=0; j<2; j++) {
-            temp1 = Image[i*2+j];
-            for(k=0; k<2; k++) {
-                temp2 = temp1&0xC0;
-                if(temp2 == 0xC0)
-                    temp3 |= 0x01;//white
-                else if(temp2 == 0x00)
-                    temp3 |= 0x00;  //black
-                else if(temp2 == 0x80)
-                    temp3 |= 0x00;  //gray1
-                else //0x40
-                    temp3 |= 0x01; //gray2
-                temp3 <<= 1;
-
-                temp1 <<= 2;
-                temp2 = temp1&0xC0 ;
-                if(temp2 == 0xC0)  //white
-                    temp3 |= 0x01;
-                else if(temp2 == 0x00) //black
-                    temp3 |= 0x00;
-                else if(temp2 == 0x80)
-                    temp3 |= 0x00; //gray1
-                else    //0x40
-                    temp3 |= 0x01;	//gray2
-                if(j!=1 || k!=1)
-                    temp3 <<= 1;
-
-                temp1 <<= 2;
-            }
+    for (UWORD row = 0; row < EPD_3IN7_HEIGHT; row += band_rows) {
+        UWORD rows = (EPD_3IN7_HEIGHT - row < band_rows) ? (EPD_3IN7_HEIGHT - row) : band_rows;
 
-        }
-        EPD_3IN7_SendData(temp3);
-    }
-    // new  data
-    EPD_3IN7_SendCommand(0x4E);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-     
-    
-    EPD_3IN7_SendCommand(0x4F);
-    EPD_3IN7_SendData(0x00);
-    EPD_3IN7_SendData(0x00);
-    
-    EPD_3IN7_SendCommand(0x26);
-    for(i=0; i<16800; i++) {
-        temp3=0;
-        for(j=0; j<2; j++) {
-            temp1 = Image[i*2+j];
-            for(k=0; k<2; k++) {
-                temp2 = temp1&0xC0 ;
-                if(temp2 == 0xC0)
-                    temp3 |= 0x01;//white
-                else if(temp2 == 0x00)
-                    temp3 |= 0x00;  //black
-                else if(temp2 == 0x80)
-                    temp3 |= 0x01;  //gray1
-                else //0x40
-                    temp3 |= 0x00; //gray2
-                temp3 <<= 1;
-
-                temp1 <<= 2;
-                temp2 = temp1&0xC0 ;
-                if(temp2 == 0xC0)  //white
-                    temp3 |= 0x01;
-                else if(temp2 == 0x00) //black
-                    temp3 |= 0x00;
-                else if(temp2 == 0x80)
-                    temp3 |= 0x01; //gray1
-                else    //0x40
-                    temp3 |= 0x00;	//gray2
-                if(j!=1 || k!=1)
-                    temp3 <<= 1;
-
-                temp1 <<= 2;
+        for (UWORD g = row; g < row + rows; g += 8) {
+            UWORD c = (EPD_3IN7_HEIGHT - 8 - g) / 8;
+            UDOUBLE top = (UDOUBLE)(g - row + 7) * EPD_3IN7_LINE_BYTES;
+#if USE_NATIVE_4GRAY
+            EPD_3IN7_RotateColumn(Image, c, band24 + top);
+            EPD_3IN7_RotateColumn(Image + EPD_3IN7_PLANE_BYTES, c, band26 + top);
+#else
+            for (UWORD r = 0; r < EPD_3IN7_LINE_BYTES; r++) {
+                UBYTE p24[8], p26[8];
+                const UBYTE *src = Image + (UDOUBLE)8 * r * EPD_3IN7_LAND_LINE_BYTES * 2 + 2 * c;
+                for (UBYTE i = 0; i < 8; i++, src += EPD_3IN7_LAND_LINE_BYTES * 2) {
+                    UBYTE a = gray_split[src[0]];
+                    UBYTE b = gray_split[src[1]];
+                    p24[i] = (a & 0xF0) | (b >> 4);
+                    p26[i] = (UBYTE)(a << 4) | (b & 0x0F);
+                }
+                EPD_3IN7_Transpose8(p24, 1, band24 + top + r, -EPD_3IN7_LINE_BYTES);
+                EPD_3IN7_Transpose8(p26, 1, band26 + top + r, -EPD_3IN7_LINE_BYTES);
             }
+#endif
         }
-        EPD_3IN7_SendData(temp3);
+
+        UDOUBLE bytes = (UDOUBLE)rows * EPD_3IN7_LINE_BYTES;
+        EPD_3IN7_SetCursor(0, row);
+        EPD_3IN7_SendCommand(0x24);
+        EPD_3IN7_SendDataBlock(band24, bytes);
+
+        // new  data
+        EPD_3IN7_SetCursor(0, row);
+        EPD_3IN7_SendCommand(0x26);
+        EPD_3IN7_SendDataBlock(band26, bytes);
     }
 
-    EPD_3IN7_Load_LUT(0);
-    
-    EPD_3IN7_SendCommand(0x22);
-    EPD_3IN7_SendData(0xC7);
-    
-    EPD_3IN7_SendCommand(0x20);
-    
-    EPD_3IN7_ReadBusy_HIGH(); 
+    EPD_3IN7_SelectWaveform(4, EPD_3IN7_LUT_4GRAY_GC);
+    EPD_3IN7_TurnOnDisplay();
+    return status;
 }
 
 /******************************************************************************
-function :  Sends the image buffer in RAM to e-Paper and displays
+function :	Sends a 4 gray landscape canvas to e-Paper and displays
 parameter:
 ******************************************************************************/
-void EPD_3IN7_1Gray_Display(const UBYTE *Image)
+UBYTE EPD_3IN7_4Gray_Display_Landscape(const UBYTE *Image)
 {
-  UWORD i;
-  UWORD IMAGE_COUNTER = EPD_3IN7_WIDTH * EPD_3IN7_HEIGHT / 8;
+    UBYTE status = EPD_3IN7_4Gray_Display_Landscape_Start(Image);
+    return status | EPD_3IN7_WaitIdle();
+}
 
-  EPD_3IN7_SendCommand(0x4E);
-  EPD_3IN7_SendData(0x00);
-  EPD_3IN7_SendData(0x00);
-  EPD_3IN7_SendCommand(0x4F);
-  EPD_3IN7_SendData(0x00);
-  EPD_3IN7_SendData(0x00);
+/******************************************************************************
+function :	Whether a 4 gray image only uses black and white
+parameter:
+Info:
+    A pixel is gray when its two bits differ (GRAY2 = 01, GRAY3 = 10)
+    Such frames can go through the faster 1 gray routines, see EPD_3IN7_4Gray_ToMono
+******************************************************************************/
+UBYTE EPD_3IN7_4Gray_IsMono(const UBYTE *Image)
+{
+#if USE_NATIVE_4GRAY
+    return memcmp(Image, Image + EPD_3IN7_PLANE_BYTES, EPD_3IN7_PLANE_BYTES) == 0;
+#else
+    // A word at a time once aligned, the two bits of a pixel never straddle a byte
+    UDOUBLE i = 0, n = EPD_3IN7_PLANE_BYTES * 2;
+    for (; i < n && ((uintptr_t)(Image + i) & 3); i++) {
+        if ((Image[i] ^ (Image[i] >> 1)) & 0x55) return 0;
+    }
+    for (; i + 4 <= n; i += 4) {
+        UDOUBLE w = EPD_3IN7_Load32(Image + i);
+        if ((w ^ (w >> 1)) & 0x55555555) return 0;
+    }
+    for (; i < n; i++) {
+        if ((Image[i] ^ (Image[i] >> 1)) & 0x55) return 0;
+    }
+    return 1;
+#endif
+}
 
+/******************************************************************************
+function :	Threshold a run of a 4 gray image into 1 gray bytes
+parameter:
+    Image : 4 gray image
+    Row   : Gate row the run starts on
+    Xbyte : 1 gray byte of the row the run starts at
+    Bytes : 1 gray bytes to produce, may carry on into the following rows
+    Mono  : Output
+Info:
+    A pixel is white when its RAM 0x24 bit is set, black and white pixels
+    keep their color. This is what a 1 gray refresh of a 4 gray image shows
+******************************************************************************/
+void EPD_3IN7_4Gray_ToMonoSpan(const UBYTE *Image, UWORD Row, UWORD Xbyte, UDOUBLE Bytes, UBYTE *Mono)
+{
+    UDOUBLE Start = (UDOUBLE)Row * EPD_3IN7_LINE_BYTES + Xbyte;
+#if USE_NATIVE_4GRAY
+    memcpy(Mono, Image + Start, Bytes);
+#else
+    // The 0x24 half of the split, through gray_split until Src is word aligned
+    const UBYTE *Src = Image + 2 * Start;
+    UDOUBLE i = 0;
+    for (; i < Bytes && ((uintptr_t)(Src + 2 * i) & 3); i++) {
+        Mono[i] = (gray_split[Src[2 * i]] & 0xF0) | (gray_split[Src[2 * i + 1]] >> 4);
+    }
+    for (; i + 2 <= Bytes; i += 2) {
+        UDOUBLE m = EPD_3IN7_Plane24(EPD_3IN7_Unzip2bpp(EPD_3IN7_Load32(Src + 2 * i)));
+        Mono[i] = (UBYTE)m; Mono[i + 1] = (UBYTE)(m >> 16);
+    }
+    for (; i < Bytes; i++) {
+        Mono[i] = (gray_split[Src[2 * i]] & 0xF0) | (gray_split[Src[2 * i + 1]] >> 4);
+    }
+#endif
+}
+
+/******************************************************************************
+function :	Convert a black and white 4 gray image to a 1 gray frame
+parameter:
+    Image : 4 gray image, EPD_3IN7_4Gray_IsMono must hold
+    Mono  : EPD_3IN7_PLANE_BYTES output in controller layout
+Info:
+    Both planes are equal without gray, see EPD_3IN7_4Gray_ToMonoSpan
+******************************************************************************/
+void EPD_3IN7_4Gray_ToMono(const UBYTE *Image, UBYTE *Mono)
+{
+    EPD_3IN7_4Gray_ToMonoSpan(Image, 0, 0, EPD_3IN7_PLANE_BYTES, Mono);
+}
+
+/******************************************************************************
+function :  Sends the image buffer in RAM to e-Paper and starts the refresh
+parameter:
+Info:
+    Same contract as EPD_3IN7_4Gray_Display_Start
+******************************************************************************/
+UBYTE EPD_3IN7_1Gray_Display_Start(const UBYTE *Image)
+{
+  UBYTE status = EPD_3IN7_WaitIdle();
+
+  EPD_3IN7_SetWindow(0, 0, EPD_3IN7_WIDTH - 1, EPD_3IN7_HEIGHT - 1);
+  EPD_3IN7_SetCursor(0, 0);
   EPD_3IN7_SendCommand(0x24);
-  for (i = 0; i < IMAGE_COUNTER; i++)
-  {
-    EPD_3IN7_SendData(Image[i]);
-  }
+  EPD_3IN7_SendDataBlock(Image, EPD_3IN7_PLANE_BYTES);
 
-  EPD_3IN7_Load_LUT(2);
-  EPD_3IN7_SendCommand(0x20);
-  EPD_3IN7_ReadBusy_HIGH();  
+  EPD_3IN7_SelectWaveform(1, partial_lut);
+  EPD_3IN7_TurnOnDisplay();
+  return status;
 }
 
 /******************************************************************************
 function :  Sends the image buffer in RAM to e-Paper and displays
 parameter:
 ******************************************************************************/
-void EPD_3IN7_1Gray_Display_Part(const UBYTE *Image, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+UBYTE EPD_3IN7_1Gray_Display(const UBYTE *Image)
+{
+  UBYTE status = EPD_3IN7_1Gray_Display_Start(Image);
+  return status | EPD_3IN7_WaitIdle();
+}
+
+/******************************************************************************
+function :  Sends one window of a frame to e-Paper and starts the refresh
+parameter:
+    Image       : Full frame
+    Gray        : 1 for a 1 gray frame in controller layout, 4 for a 4 gray image
+    Xstart/Xend : Source (pixel) range, inclusive, widened to whole bytes
+    Ystart/Yend : Gate range, inclusive
+Info:
+    Only the window rows/bytes are extracted and sent, the rest of 0x24 keeps
+    the previous frame. 4 gray rows are thresholded as they are extracted
+******************************************************************************/
+static UBYTE EPD_3IN7_1Gray_SendPart(const UBYTE *Image, UBYTE Gray, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
-  UWORD i, Width;
-  Width = (Xend-Xstart)%8 == 0 ? (Xend-Xstart)/8 : (Xend-Xstart)/8+1;
-  UWORD IMAGE_COUNTER = Width * (Yend-Ystart);
+  static UBYTE band[EPD_3IN7_CHUNK_BYTES];
+  UBYTE status = EPD_3IN7_WaitIdle();
 
-  EPD_3IN7_SendCommand(0x44);
-  EPD_3IN7_SendData(Xstart & 0xff);
-  EPD_3IN7_SendData((Xstart>>8) & 0x03);
-  EPD_3IN7_SendData(Xend & 0xff);
-  EPD_3IN7_SendData((Xend>>8) & 0x03);
-  EPD_3IN7_SendCommand(0x45);
-  EPD_3IN7_SendData(Ystart & 0xff);
-  EPD_3IN7_SendData((Ystart>>8) & 0x03);
-  EPD_3IN7_SendData(Yend & 0xff);
-  EPD_3IN7_SendData((Yend>>8) & 0x03);
+  if (Xend >= EPD_3IN7_WIDTH) Xend = EPD_3IN7_WIDTH - 1;
+  if (Yend >= EPD_3IN7_HEIGHT) Yend = EPD_3IN7_HEIGHT - 1;
+  if (Xstart > Xend || Ystart > Yend) return status;
 
+  UWORD Xbyte = Xstart / 8;
+  UWORD Width = Xend / 8 - Xbyte + 1;
+  UWORD Rows = EPD_3IN7_CHUNK_BYTES / Width;
+
+  EPD_3IN7_SetWindow(Xbyte * 8, Ystart, Xbyte * 8 + Width * 8 - 1, Yend);
+  EPD_3IN7_SetCursor(Xbyte * 8, Ystart);
   EPD_3IN7_SendCommand(0x24);
-  for (i = 0; i < IMAGE_COUNTER; i++)
-  {
-    EPD_3IN7_SendData(Image[i]);
+  for (UWORD row = Ystart; row <= Yend; row += Rows) {
+    UWORD n = (Yend - row + 1 < Rows) ? (Yend - row + 1) : Rows;
+    if (Gray == 4 && Width == EPD_3IN7_LINE_BYTES) {
+      // Whole rows are contiguous, threshold the chunk as one run
+      EPD_3IN7_4Gray_ToMonoSpan(Image, row, 0, (UDOUBLE)n * Width, band);
+    } else {
+      for (UWORD j = 0; j < n; j++) {
+        if (Gray == 4) {
+          EPD_3IN7_4Gray_ToMonoSpan(Image, row + j, Xbyte, Width, band + (UDOUBLE)j * Width);
+        } else {
+          memcpy(band + (UDOUBLE)j * Width, Image + (UDOUBLE)(row + j) * EPD_3IN7_LINE_BYTES + Xbyte, Width);
+        }
+      }
+    }
+    EPD_3IN7_SendDataBlock(band, (UDOUBLE)n * Width);
   }
-  
-  EPD_3IN7_Load_LUT(2);
-  EPD_3IN7_SendCommand(0x20);
-  EPD_3IN7_ReadBusy_HIGH();    
+
+  EPD_3IN7_SelectWaveform(1, partial_lut);
+  EPD_3IN7_TurnOnDisplay();
+  return status;
+}
+
+/******************************************************************************
+function :  Sends one window of the image buffer to e-Paper and starts the refresh
+parameter:
+    Image       : Full frame in controller layout (EPD_3IN7_LINE_BYTES per gate row)
+    Xstart/Xend : Source (pixel) range, inclusive, widened to whole bytes
+    Ystart/Yend : Gate range, inclusive
+Info:
+    Only the window rows/bytes are extracted and sent, the rest of 0x24 keeps
+    the previous frame.
+******************************************************************************/
+UBYTE EPD_3IN7_1Gray_Display_Part_Start(const UBYTE *Image, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+  return EPD_3IN7_1Gray_SendPart(Image, 1, Xstart, Ystart, Xend, Yend);
+}
+
+/******************************************************************************
+function :  Sends one window of a 4 gray image as a 1 gray frame and starts the refresh
+parameter:
+    Image : 4 gray image, thresholded while it is streamed (EPD_3IN7_4Gray_ToMonoSpan)
+Info:
+    Same window and contract as EPD_3IN7_1Gray_Display_Part_Start, no 1 gray
+    copy of the image is needed
+******************************************************************************/
+UBYTE EPD_3IN7_1Gray_Display_Part_From4Gray_Start(const UBYTE *Image, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+  return EPD_3IN7_1Gray_SendPart(Image, 4, Xstart, Ystart, Xend, Yend);
+}
+
+/******************************************************************************
+function :  Sends a 4 gray image as a 1 gray frame and starts the refresh
+parameter:
+    Image : 4 gray image, thresholded while it is streamed
+Info:
+    Same contract as EPD_3IN7_1Gray_Display_Start
+******************************************************************************/
+UBYTE EPD_3IN7_1Gray_Display_From4Gray_Start(const UBYTE *Image)
+{
+  return EPD_3IN7_1Gray_SendPart(Image, 4, 0, 0, EPD_3IN7_WIDTH - 1, EPD_3IN7_HEIGHT - 1);
+}
+
+/******************************************************************************
+function :  Sends one window of the image buffer to e-Paper and displays
+parameter:
+******************************************************************************/
+UBYTE EPD_3IN7_1Gray_Display_Part(const UBYTE *Image, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+  UBYTE status = EPD_3IN7_1Gray_Display_Part_Start(Image, Xstart, Ystart, Xend, Yend);
+  return status | EPD_3IN7_WaitIdle();
+}
+
+/******************************************************************************
+function :  Choose the waveform used by the 1 gray display routines
+parameter:
+    lut : EPD_3IN7_LUT_1GRAY_GC, EPD_3IN7_LUT_1GRAY_DU or EPD_3IN7_LUT_1GRAY_A2
+Info:
+    A2 only drives black/white transitions and ghosts, follow a run of A2
+    frames with a GC or DU frame to clean up
+******************************************************************************/
+void EPD_3IN7_1Gray_SetWaveform(UBYTE lut)
+{
+  if (lut != EPD_3IN7_LUT_1GRAY_GC && lut != EPD_3IN7_LUT_1GRAY_DU && lut != EPD_3IN7_LUT_1GRAY_A2) {
+      Debug("There is no such 1 gray lut \r\n");
+      return;
+  }
+  partial_lut = lut;
+}
+
+/******************************************************************************
+function :  Waveform currently used by the 1 gray display routines
+parameter:
+******************************************************************************/
+UBYTE EPD_3IN7_1Gray_GetWaveform(void)
+{
+  return partial_lut;
 }
 
 /******************************************************************************
@@ -586,4 +1301,5 @@ void EPD_3IN7_Sleep(void)
 {
     EPD_3IN7_SendCommand(0X10);  	//deep sleep
     EPD_3IN7_SendData(0x03);
+    epd_state.valid = false; // woken by reset only, registers reload from defaults
 }
@@ -36,15 +36,63 @@
 // Display resolution
 #define EPD_3IN7_WIDTH       280
 #define EPD_3IN7_HEIGHT      480 
+#define EPD_3IN7_LINE_BYTES  (EPD_3IN7_WIDTH / 8)
+#define EPD_3IN7_PLANE_BYTES (EPD_3IN7_LINE_BYTES * EPD_3IN7_HEIGHT)
+#define EPD_3IN7_LAND_LINE_BYTES (EPD_3IN7_HEIGHT / 8) // 1bpp row of a landscape (480 wide) canvas
 
-void EPD_3IN7_4Gray_Clear(void);
-void EPD_3IN7_4Gray_Init(void);
-void EPD_3IN7_4Gray_Display(const UBYTE *Image);
+// Staging buffer size for computed/filled data phases
+#define EPD_3IN7_CHUNK_BYTES 1024
+#define EPD_3IN7_BAND_ROWS   (EPD_3IN7_CHUNK_BYTES / EPD_3IN7_LINE_BYTES)
 
-void EPD_3IN7_1Gray_Clear(void);
-void EPD_3IN7_1Gray_Init(void);
-void EPD_3IN7_1Gray_Display(const UBYTE *Image);
-void EPD_3IN7_1Gray_Display_Part(const UBYTE *Image, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+// Waveform tables for EPD_3IN7_Load_LUT / EPD_3IN7_1Gray_SetWaveform
+#define EPD_3IN7_LUT_4GRAY_GC 0
+#define EPD_3IN7_LUT_1GRAY_GC 1 // full flashing update, clears ghosting
+#define EPD_3IN7_LUT_1GRAY_DU 2 // direct update, default for partial frames
+#define EPD_3IN7_LUT_1GRAY_A2 3 // fastest, black/white only, ghosts
+
+// Temperature bands the LUT timing is scaled for, see EPD_3IN7_ReadTemperature
+#define EPD_3IN7_TEMP_BANDS      5
+#define EPD_3IN7_TEMP_BAND_STOCK 2    // unscaled tables, used until the sensor is read
+#define EPD_3IN7_TEMP_UNKNOWN    -128
+
+// BUSY wait limit, routines that wait on the panel return 1 once it is exceeded
+#define EPD_3IN7_BUSY_TIMEOUT_MS 10000
+
+UBYTE EPD_3IN7_4Gray_Clear(void);
+UBYTE EPD_3IN7_4Gray_Fill(UBYTE White);
+UBYTE EPD_3IN7_4Gray_Init(void);
+UBYTE EPD_3IN7_4Gray_Display(const UBYTE *Image);
+UBYTE EPD_3IN7_4Gray_Display_Start(const UBYTE *Image);
+UBYTE EPD_3IN7_4Gray_IsMono(const UBYTE *Image);
+void EPD_3IN7_4Gray_ToMono(const UBYTE *Image, UBYTE *Mono);
+void EPD_3IN7_4Gray_ToMonoSpan(const UBYTE *Image, UWORD Row, UWORD Xbyte, UDOUBLE Bytes, UBYTE *Mono);
+UBYTE EPD_3IN7_4Gray_Display_Landscape(const UBYTE *Image);
+UBYTE EPD_3IN7_4Gray_Display_Landscape_Start(const UBYTE *Image);
+void EPD_3IN7_1Gray_FromLandscape(const UBYTE *Land, UBYTE *Panel);
+
+UBYTE EPD_3IN7_1Gray_Clear(void);
+UBYTE EPD_3IN7_1Gray_Fill(UBYTE White);
+UBYTE EPD_3IN7_1Gray_Init(void);
+UBYTE EPD_3IN7_1Gray_Display(const UBYTE *Image);
+UBYTE EPD_3IN7_1Gray_Display_Start(const UBYTE *Image);
+UBYTE EPD_3IN7_1Gray_Display_Part(const UBYTE *Image, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+UBYTE EPD_3IN7_1Gray_Display_Part_Start(const UBYTE *Image, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+UBYTE EPD_3IN7_1Gray_Display_From4Gray_Start(const UBYTE *Image);
+UBYTE EPD_3IN7_1Gray_Display_Part_From4Gray_Start(const UBYTE *Image, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void EPD_3IN7_1Gray_SetWaveform(UBYTE lut);
+UBYTE EPD_3IN7_1Gray_GetWaveform(void);
+
+UBYTE EPD_3IN7_WaitIdle(void);
+UBYTE EPD_3IN7_IsBusy(void);
+UDOUBLE EPD_3IN7_GetLastBusyTime(void);
+void EPD_3IN7_GetElidedStats(UDOUBLE *cmds, UDOUBLE *bytes);
+
+int EPD_3IN7_ReadTemperature(void);
+int EPD_3IN7_GetTemperature(void);
+UBYTE EPD_3IN7_GetTempBand(void);
+UBYTE EPD_3IN7_TempBand(int temp_c);
+UBYTE EPD_3IN7_TempBandScale(UBYTE band);
+void EPD_3IN7_ScaleLUT(const UBYTE *Lut, UBYTE Scale, UBYTE *Out);
 
 void EPD_3IN7_Sleep(void);
 
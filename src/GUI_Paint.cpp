@@ -85,6 +85,12 @@
 
 PAINT Paint;
 
+// Packed glyph lines are columns for the 270 degree canvas, rows for the landscape one
+#define PAINT_PACKED_COLUMNS (!USE_LANDSCAPE_PAINT)
+#define PAINT_GLYPH_BYTES    (4 * 32) // largest glyph the pixel path unpacks, 32x32
+
+static void Paint_SelectWriter(PAINT *ctx);
+
 /******************************************************************************
 function: Create Image
 parameter:
@@ -93,30 +99,33 @@ parameter:
     Height  :   The height of the picture
     Color   :   Whether the picture is inverted
 ******************************************************************************/
-void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
+void PaintCtx_NewImage(PAINT *ctx, UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
 {
-    Paint.Image = NULL;
-    Paint.Image = image;
+    ctx->Image = NULL;
+    ctx->Image = image;
 
-    Paint.WidthMemory = Width;
-    Paint.HeightMemory = Height;
-    Paint.Color = Color;    
-    Paint.Scale = 2;
-    Paint.WidthByte = (Width % 8 == 0)? (Width / 8 ): (Width / 8 + 1);
-    Paint.HeightByte = Height;    
-//    printf("WidthByte = %d, HeightByte = %d\r\n", Paint.WidthByte, Paint.HeightByte);
+    ctx->WidthMemory = Width;
+    ctx->HeightMemory = Height;
+    ctx->Color = Color;    
+    ctx->Scale = 2;
+    ctx->WidthByte = (Width % 8 == 0)? (Width / 8 ): (Width / 8 + 1);
+    ctx->HeightByte = Height;    
+//    printf("WidthByte = %d, HeightByte = %d\r\n", ctx->WidthByte, ctx->HeightByte);
 //    printf(" EPD_WIDTH / 8 = %d\r\n",  122 / 8);
    
-    Paint.Rotate = Rotate;
-    Paint.Mirror = MIRROR_NONE;
+    ctx->Rotate = Rotate;
+    ctx->Mirror = MIRROR_NONE;
     
     if(Rotate == ROTATE_0 || Rotate == ROTATE_180) {
-        Paint.Width = Width;
-        Paint.Height = Height;
+        ctx->Width = Width;
+        ctx->Height = Height;
     } else {
-        Paint.Width = Height;
-        Paint.Height = Width;
+        ctx->Width = Height;
+        ctx->Height = Width;
     }
+    ctx->List = NULL;
+    PaintCtx_ResetClip(ctx);
+    Paint_SelectWriter(ctx);
 }
 
 /******************************************************************************
@@ -124,9 +133,143 @@ function: Select Image
 parameter:
     image : Pointer to the image cache
 ******************************************************************************/
-void Paint_SelectImage(UBYTE *image)
+void PaintCtx_SelectImage(PAINT *ctx, UBYTE *image)
+{
+    ctx->Image = image;
+    Paint_SelectWriter(ctx);
+}
+
+/******************************************************************************
+function: Restrict drawing to a rectangle
+parameter:
+    Xstart, Ystart : Top left corner
+    Xend, Yend     : Bottom right corner, exclusive
+Info:
+    Intersected with the image. Primitives reject or trim their spans and
+    glyphs against it up front, pixels outside it are dropped silently
+******************************************************************************/
+void PaintCtx_SetClip(PAINT *ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    ctx->ClipXstart = Xstart < ctx->Width ? Xstart : ctx->Width;
+    ctx->ClipYstart = Ystart < ctx->Height ? Ystart : ctx->Height;
+    ctx->ClipXend = Xend < ctx->Width ? Xend : ctx->Width;
+    ctx->ClipYend = Yend < ctx->Height ? Yend : ctx->Height;
+}
+
+/******************************************************************************
+function: Clip to the whole image
+parameter:
+******************************************************************************/
+void PaintCtx_ResetClip(PAINT *ctx)
 {
-    Paint.Image = image;
+    PaintCtx_SetClip(ctx, 0, 0, ctx->Width, ctx->Height);
+}
+
+/******************************************************************************
+function: Clip to the logical area that lands in a band of memory rows
+parameter:
+    Ystart : First memory row
+    Yend   : Last memory row, exclusive
+Info:
+    Contexts banded over disjoint rows of the same image write disjoint
+    bytes, so they can be drawn into from different tasks at once
+******************************************************************************/
+void PaintCtx_SetBand(PAINT *ctx, UWORD Ystart, UWORD Yend)
+{
+    if (Yend > ctx->HeightMemory)
+        Yend = ctx->HeightMemory;
+    if (Ystart > Yend)
+        Ystart = Yend;
+    if (ctx->Mirror == MIRROR_VERTICAL || ctx->Mirror == MIRROR_ORIGIN) {
+        UWORD Y = Ystart;
+        Ystart = ctx->HeightMemory - Yend;
+        Yend = ctx->HeightMemory - Y;
+    }
+
+    switch (ctx->Rotate) {
+    case ROTATE_0:
+        PaintCtx_SetClip(ctx, 0, Ystart, ctx->Width, Yend);
+        break;
+    case ROTATE_90:
+        PaintCtx_SetClip(ctx, Ystart, 0, Yend, ctx->Height);
+        break;
+    case ROTATE_180:
+        PaintCtx_SetClip(ctx, 0, ctx->HeightMemory - Yend, ctx->Width, ctx->HeightMemory - Ystart);
+        break;
+    case ROTATE_270:
+        PaintCtx_SetClip(ctx, ctx->HeightMemory - Yend, 0, ctx->HeightMemory - Ystart, ctx->Height);
+        break;
+    }
+}
+
+/******************************************************************************
+function: Start or stop recording draw calls into a display list
+parameter:
+    List : Emptied and recorded into, NULL draws again
+Info:
+    While recording, Clear, ClearWindows, the shapes, characters, strings and
+    numbers are appended to List instead of drawn. Calls that write pixels or
+    image bytes directly mark the list Incomplete, as does running out of room
+******************************************************************************/
+void PaintCtx_Record(PAINT *ctx, PAINT_LIST *List)
+{
+    if (List) {
+        List->Count = 0;
+        List->TextUsed = 0;
+        List->Incomplete = false;
+    }
+    ctx->List = List;
+}
+
+/******************************************************************************
+function: Append an operation to the list being recorded
+parameter:
+    Type : PAINT_OP_TYPE
+Info:
+    Returns NULL and marks the list Incomplete once it is full
+******************************************************************************/
+static PAINT_OP *Paint_RecordOp(PAINT *ctx, UBYTE Type)
+{
+    PAINT_LIST *List = ctx->List;
+    if (List->Incomplete || List->Count >= PAINT_LIST_OPS) {
+        List->Incomplete = true;
+        return NULL;
+    }
+    PAINT_OP *Op = &List->Ops[List->Count++];
+    memset(Op, 0, sizeof(PAINT_OP));
+    Op->Type = Type;
+    return Op;
+}
+
+/******************************************************************************
+function: Copy a string into the list being recorded
+parameter:
+    pString : String to keep
+Info:
+    Returns its offset in Text, or -1 and marks the list Incomplete
+******************************************************************************/
+static int32_t Paint_RecordText(PAINT *ctx, const char *pString)
+{
+    PAINT_LIST *List = ctx->List;
+    size_t Len = strlen(pString) + 1;
+    if (List->Incomplete || List->TextUsed + Len > PAINT_LIST_TEXT) {
+        List->Incomplete = true;
+        return -1;
+    }
+    memcpy(List->Text + List->TextUsed, pString, Len);
+    List->TextUsed += Len;
+    return List->TextUsed - Len;
+}
+
+/******************************************************************************
+function: Whether a box lies entirely outside the clip rectangle
+parameter:
+    Xstart, Ystart, Xend, Yend : Box corners, inclusive
+******************************************************************************/
+static bool Paint_Clipped(PAINT *ctx, int Xstart, int Ystart, int Xend, int Yend)
+{
+    return Xend < ctx->ClipXstart || Xstart >= ctx->ClipXend ||
+           Yend < ctx->ClipYstart || Ystart >= ctx->ClipYend;
 }
 
 /******************************************************************************
@@ -134,11 +277,12 @@ function: Select Image Rotate
 parameter:
     Rotate : 0,90,180,270
 ******************************************************************************/
-void Paint_SetRotate(UWORD Rotate)
+void PaintCtx_SetRotate(PAINT *ctx, UWORD Rotate)
 {
     if(Rotate == ROTATE_0 || Rotate == ROTATE_90 || Rotate == ROTATE_180 || Rotate == ROTATE_270) {
         // Debug("Set image Rotate %d\r\n", Rotate);
-        Paint.Rotate = Rotate;
+        ctx->Rotate = Rotate;
+        Paint_SelectWriter(ctx);
     } else {
         Debug("rotate = 0, 90, 180, 270\r\n");
     }
@@ -149,145 +293,388 @@ function:	Select Image mirror
 parameter:
     mirror   :Not mirror,Horizontal mirror,Vertical mirror,Origin mirror
 ******************************************************************************/
-void Paint_SetMirroring(UBYTE mirror)
+void PaintCtx_SetMirroring(PAINT *ctx, UBYTE mirror)
 {
     if(mirror == MIRROR_NONE || mirror == MIRROR_HORIZONTAL || 
         mirror == MIRROR_VERTICAL || mirror == MIRROR_ORIGIN) {
         // Debug("mirror image x:%s, y:%s\r\n",(mirror & 0x01)? "mirror":"none", ((mirror >> 1) & 0x01)? "mirror":"none");
-        Paint.Mirror = mirror;
+        ctx->Mirror = mirror;
+        Paint_SelectWriter(ctx);
     } else {
         Debug("mirror should be MIRROR_NONE, MIRROR_HORIZONTAL, \
         MIRROR_VERTICAL or MIRROR_ORIGIN\r\n");
     }    
 }
 
-void Paint_SetScale(UBYTE scale)
+void PaintCtx_SetScale(PAINT *ctx, UBYTE scale)
 {
     if(scale == 2){
-        Paint.Scale = scale;
-        Paint.WidthByte = (Paint.WidthMemory % 8 == 0)? (Paint.WidthMemory / 8 ): (Paint.WidthMemory / 8 + 1);
+        ctx->Scale = scale;
+        ctx->WidthByte = (ctx->WidthMemory % 8 == 0)? (ctx->WidthMemory / 8 ): (ctx->WidthMemory / 8 + 1);
     }
 	else if(scale == 4) {
-        Paint.Scale = scale;
-        Paint.WidthByte = (Paint.WidthMemory % 4 == 0)? (Paint.WidthMemory / 4 ): (Paint.WidthMemory / 4 + 1);
+        ctx->Scale = scale;
+#if USE_NATIVE_4GRAY
+        // Two 1bpp planes back to back, WidthByte is the stride of one plane
+        ctx->WidthByte = (ctx->WidthMemory % 8 == 0)? (ctx->WidthMemory / 8 ): (ctx->WidthMemory / 8 + 1);
+#else
+        ctx->WidthByte = (ctx->WidthMemory % 4 == 0)? (ctx->WidthMemory / 4 ): (ctx->WidthMemory / 4 + 1);
+#endif
     }
 	else if(scale == 7) {//Only applicable with 5in65 e-Paper
-		Paint.Scale = 7;
-		Paint.WidthByte = (Paint.WidthMemory % 2 == 0)? (Paint.WidthMemory / 2 ): (Paint.WidthMemory / 2 + 1);
+		ctx->Scale = 7;
+		ctx->WidthByte = (ctx->WidthMemory % 2 == 0)? (ctx->WidthMemory / 2 ): (ctx->WidthMemory / 2 + 1);
 	}
 	else {
         Debug("Set Scale Input parameter error\r\n");
         Debug("Scale Only support: 2 4 7\r\n");
     }
+    Paint_SelectWriter(ctx);
 }
 /******************************************************************************
-function: Draw Pixels
+function: Draw Pixels through the writer selected for the current image
 parameter:
     Xpoint : At point X
     Ypoint : At point Y
     Color  : Painted colors
 ******************************************************************************/
-void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+void PaintCtx_SetPixel(PAINT *ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    if (ctx->List) {
+        ctx->List->Incomplete = true;
+        return;
+    }
+    ctx->WritePixel(ctx, Xpoint, Ypoint, Color);
+}
+
+/******************************************************************************
+function: Draw Pixels, any rotation, mirror and scale
+parameter:
+    Xpoint : At point X
+    Ypoint : At point Y
+    Color  : Painted colors
+******************************************************************************/
+static void Paint_SetPixelAny(PAINT *ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color)
 {
-    if(Xpoint > Paint.Width || Ypoint > Paint.Height){
-        Debug("Exceeding display boundaries\r\n");
+    if(Xpoint < ctx->ClipXstart || Xpoint >= ctx->ClipXend ||
+       Ypoint < ctx->ClipYstart || Ypoint >= ctx->ClipYend)
         return;
-    }      
+
     UWORD X, Y;
-    switch(Paint.Rotate) {
+    switch(ctx->Rotate) {
     case 0:
         X = Xpoint;
         Y = Ypoint;  
         break;
     case 90:
-        X = Paint.WidthMemory - Ypoint - 1;
+        X = ctx->WidthMemory - Ypoint - 1;
         Y = Xpoint;
         break;
     case 180:
-        X = Paint.WidthMemory - Xpoint - 1;
-        Y = Paint.HeightMemory - Ypoint - 1;
+        X = ctx->WidthMemory - Xpoint - 1;
+        Y = ctx->HeightMemory - Ypoint - 1;
         break;
     case 270:
         X = Ypoint;
-        Y = Paint.HeightMemory - Xpoint - 1;
+        Y = ctx->HeightMemory - Xpoint - 1;
         break;
     default:
         return;
     }
     
-    switch(Paint.Mirror) {
+    switch(ctx->Mirror) {
     case MIRROR_NONE:
         break;
     case MIRROR_HORIZONTAL:
-        X = Paint.WidthMemory - X - 1;
+        X = ctx->WidthMemory - X - 1;
         break;
     case MIRROR_VERTICAL:
-        Y = Paint.HeightMemory - Y - 1;
+        Y = ctx->HeightMemory - Y - 1;
         break;
     case MIRROR_ORIGIN:
-        X = Paint.WidthMemory - X - 1;
-        Y = Paint.HeightMemory - Y - 1;
+        X = ctx->WidthMemory - X - 1;
+        Y = ctx->HeightMemory - Y - 1;
         break;
     default:
         return;
     }
 
-    if(X > Paint.WidthMemory || Y > Paint.HeightMemory){
-        Debug("Exceeding display boundaries\r\n");
+    if(X >= ctx->WidthMemory || Y >= ctx->HeightMemory)
         return;
-    }
     
-    if(Paint.Scale == 2){
-        UDOUBLE Addr = X / 8 + Y * Paint.WidthByte;
-        UBYTE Rdata = Paint.Image[Addr];
+    if(ctx->Scale == 2){
+        UDOUBLE Addr = X / 8 + Y * ctx->WidthByte;
+        UBYTE Rdata = ctx->Image[Addr];
         if(Color == BLACK)
-            Paint.Image[Addr] = Rdata & ~(0x80 >> (X % 8));
+            ctx->Image[Addr] = Rdata & ~(0x80 >> (X % 8));
         else
-            Paint.Image[Addr] = Rdata | (0x80 >> (X % 8));
-    }else if(Paint.Scale == 4){
-        UDOUBLE Addr = X / 4 + Y * Paint.WidthByte;
+            ctx->Image[Addr] = Rdata | (0x80 >> (X % 8));
+    }else if(ctx->Scale == 4){
         Color = Color % 4;//Guaranteed color scale is 4  --- 0~3
-        UBYTE Rdata = Paint.Image[Addr];
+#if USE_NATIVE_4GRAY
+        // Color bit 0 -> RAM 0x24 plane, bit 1 -> RAM 0x26 plane
+        UDOUBLE Addr = X / 8 + Y * ctx->WidthByte;
+        UBYTE *Plane26 = ctx->Image + (UDOUBLE)ctx->WidthByte * ctx->HeightMemory;
+        UBYTE Mask = 0x80 >> (X % 8);
+        if(Color & 0x01)
+            ctx->Image[Addr] |= Mask;
+        else
+            ctx->Image[Addr] &= ~Mask;
+        if(Color & 0x02)
+            Plane26[Addr] |= Mask;
+        else
+            Plane26[Addr] &= ~Mask;
+#else
+        UDOUBLE Addr = X / 4 + Y * ctx->WidthByte;
+        UBYTE Rdata = ctx->Image[Addr];
         
         Rdata = Rdata & (~(0xC0 >> ((X % 4)*2)));
-        Paint.Image[Addr] = Rdata | ((Color << 6) >> ((X % 4)*2));
-    }else if(Paint.Scale == 7 || Paint.Scale == 16){
-		UDOUBLE Addr = X / 2  + Y * Paint.WidthByte;
-		UBYTE Rdata = Paint.Image[Addr];
+        ctx->Image[Addr] = Rdata | ((Color << 6) >> ((X % 4)*2));
+#endif
+    }else if(ctx->Scale == 7 || ctx->Scale == 16){
+		UDOUBLE Addr = X / 2  + Y * ctx->WidthByte;
+		UBYTE Rdata = ctx->Image[Addr];
 		Rdata = Rdata & (~(0xF0 >> ((X % 2)*4)));//Clear first, then set value
-		Paint.Image[Addr] = Rdata | ((Color << 4) >> ((X % 2)*4));
+		ctx->Image[Addr] = Rdata | ((Color << 4) >> ((X % 2)*4));
 		// printf("Add =  %d ,data = %d\r\n",Addr,Rdata);	
     }
 }
 
+/******************************************************************************
+function: Draw Pixels, specialized for one rotation and scale without mirroring
+parameter:
+    Xpoint : At point X
+    Ypoint : At point Y
+    Color  : Painted colors
+Info:
+    Rotate and Scale are compile time constants, so the rotation and the
+    scale branch fold away and the clip check is left
+******************************************************************************/
+template <UWORD Rotate, UBYTE Scale>
+static void Paint_SetPixelFixed(PAINT *ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    if(Xpoint < ctx->ClipXstart || Xpoint >= ctx->ClipXend ||
+       Ypoint < ctx->ClipYstart || Ypoint >= ctx->ClipYend)
+        return;
+    UWORD X, Y;
+    if(Rotate == ROTATE_0) {
+        X = Xpoint;
+        Y = Ypoint;
+    } else if(Rotate == ROTATE_90) {
+        X = ctx->WidthMemory - Ypoint - 1;
+        Y = Xpoint;
+    } else if(Rotate == ROTATE_180) {
+        X = ctx->WidthMemory - Xpoint - 1;
+        Y = ctx->HeightMemory - Ypoint - 1;
+    } else {
+        X = Ypoint;
+        Y = ctx->HeightMemory - Xpoint - 1;
+    }
+
+    if(Scale == 2) {
+        UBYTE *Pixel = ctx->Image + X / 8 + (UDOUBLE)Y * ctx->WidthByte;
+        UBYTE Mask = 0x80 >> (X % 8);
+        if(Color == BLACK)
+            *Pixel &= ~Mask;
+        else
+            *Pixel |= Mask;
+    } else {
+#if USE_NATIVE_4GRAY
+        UDOUBLE Addr = X / 8 + (UDOUBLE)Y * ctx->WidthByte;
+        UBYTE *Plane26 = ctx->Image + (UDOUBLE)ctx->WidthByte * ctx->HeightMemory;
+        UBYTE Mask = 0x80 >> (X % 8);
+        if(Color & 0x01)
+            ctx->Image[Addr] |= Mask;
+        else
+            ctx->Image[Addr] &= ~Mask;
+        if(Color & 0x02)
+            Plane26[Addr] |= Mask;
+        else
+            Plane26[Addr] &= ~Mask;
+#else
+        UBYTE *Pixel = ctx->Image + X / 4 + (UDOUBLE)Y * ctx->WidthByte;
+        UBYTE Shift = 6 - (X % 4) * 2;
+        *Pixel = (*Pixel & ~(0x03 << Shift)) | ((Color & 0x03) << Shift);
+#endif
+    }
+}
+
+/******************************************************************************
+function: Pick the pixel writer for the current rotation, mirror and scale
+parameter:
+Info:
+    Called whenever one of them or the image changes, the primitives then
+    call ctx->WritePixel without re-deciding per pixel
+******************************************************************************/
+static void Paint_SelectWriter(PAINT *ctx)
+{
+    static void (*const Fixed[4][2])(PAINT *, UWORD, UWORD, UWORD) = {
+        {Paint_SetPixelFixed<ROTATE_0,   2>, Paint_SetPixelFixed<ROTATE_0,   4>},
+        {Paint_SetPixelFixed<ROTATE_90,  2>, Paint_SetPixelFixed<ROTATE_90,  4>},
+        {Paint_SetPixelFixed<ROTATE_180, 2>, Paint_SetPixelFixed<ROTATE_180, 4>},
+        {Paint_SetPixelFixed<ROTATE_270, 2>, Paint_SetPixelFixed<ROTATE_270, 4>},
+    };
+    ctx->WritePixel = Paint_SetPixelAny;
+    if(ctx->Mirror != MIRROR_NONE || (ctx->Scale != 2 && ctx->Scale != 4) || ctx->Rotate % 90 != 0 || ctx->Rotate > ROTATE_270)
+        return;
+    ctx->WritePixel = Fixed[ctx->Rotate / 90][ctx->Scale == 4];
+}
+
+/******************************************************************************
+function: Fill a rectangle of one image plane in memory coordinates
+parameter:
+    Plane   : Start of the plane
+    Bpp     : Bits per pixel, 1 or 2
+    X0, X1  : Memory columns, X1 exclusive
+    Y0, Y1  : Memory rows, Y1 exclusive
+    Pattern : The fill value replicated over a whole byte
+Info:
+    Whole bytes are stored, the partial bytes at either edge are masked
+******************************************************************************/
+static void Paint_FillPlane(PAINT *ctx, UBYTE *Plane, UBYTE Bpp, UWORD X0, UWORD Y0, UWORD X1, UWORD Y1, UBYTE Pattern)
+{
+    UBYTE PerByte = 8 / Bpp;
+    UWORD B0 = X0 / PerByte, B1 = (X1 - 1) / PerByte;
+    UBYTE M0 = 0xFF >> ((X0 % PerByte) * Bpp);
+    UBYTE M1 = (UBYTE)(0xFF << ((PerByte - 1 - (X1 - 1) % PerByte) * Bpp));
+    if (B0 == B1) {
+        M0 &= M1;
+        M1 = 0;
+    }
+    for (UWORD Y = Y0; Y < Y1; Y++) {
+        UBYTE *Row = Plane + (UDOUBLE)Y * ctx->WidthByte;
+        Row[B0] = (Row[B0] & ~M0) | (Pattern & M0);
+        if (M1) {
+            if (B1 > B0 + 1)
+                memset(Row + B0 + 1, Pattern, B1 - B0 - 1);
+            Row[B1] = (Row[B1] & ~M1) | (Pattern & M1);
+        }
+    }
+}
+
+/******************************************************************************
+function: Fill a rectangle with horizontal/vertical spans
+parameter:
+    Xstart, Xend : x range, Xend exclusive
+    Ystart, Yend : y range, Yend exclusive
+    Color        : Painted color
+Info:
+    Clipped to the clip rectangle. The rectangle is rotated to memory
+    coordinates once and filled a byte at a time, mirrored images and scale 7
+    fall back to the pixel writer
+******************************************************************************/
+static void Paint_FillArea(PAINT *ctx, int Xstart, int Ystart, int Xend, int Yend, UWORD Color)
+{
+    if (Xstart < ctx->ClipXstart) Xstart = ctx->ClipXstart;
+    if (Ystart < ctx->ClipYstart) Ystart = ctx->ClipYstart;
+    if (Xend > ctx->ClipXend) Xend = ctx->ClipXend;
+    if (Yend > ctx->ClipYend) Yend = ctx->ClipYend;
+    if (Xstart >= Xend || Ystart >= Yend)
+        return;
+
+    if (ctx->Mirror != MIRROR_NONE || (ctx->Scale != 2 && ctx->Scale != 4)) {
+        for (int Y = Ystart; Y < Yend; Y++)
+            for (int X = Xstart; X < Xend; X++)
+                ctx->WritePixel(ctx, X, Y, Color);
+        return;
+    }
+
+    int X0, X1, Y0, Y1;
+    switch (ctx->Rotate) {
+    case ROTATE_0:
+        X0 = Xstart; X1 = Xend;
+        Y0 = Ystart; Y1 = Yend;
+        break;
+    case ROTATE_90:
+        X0 = ctx->WidthMemory - Yend; X1 = ctx->WidthMemory - Ystart;
+        Y0 = Xstart; Y1 = Xend;
+        break;
+    case ROTATE_180:
+        X0 = ctx->WidthMemory - Xend; X1 = ctx->WidthMemory - Xstart;
+        Y0 = ctx->HeightMemory - Yend; Y1 = ctx->HeightMemory - Ystart;
+        break;
+    case ROTATE_270:
+        X0 = Ystart; X1 = Yend;
+        Y0 = ctx->HeightMemory - Xend; Y1 = ctx->HeightMemory - Xstart;
+        break;
+    default:
+        return;
+    }
+    if (X0 < 0) X0 = 0;
+    if (Y0 < 0) Y0 = 0;
+    if (X1 > ctx->WidthMemory) X1 = ctx->WidthMemory;
+    if (Y1 > ctx->HeightMemory) Y1 = ctx->HeightMemory;
+    if (X0 >= X1 || Y0 >= Y1)
+        return;
+
+    if (ctx->Scale == 2) {
+        Paint_FillPlane(ctx, ctx->Image, 1, X0, Y0, X1, Y1, Color == BLACK ? 0x00 : 0xFF);
+    } else {
+        Color = Color % 4;
+#if USE_NATIVE_4GRAY
+        UBYTE *Plane26 = ctx->Image + (UDOUBLE)ctx->WidthByte * ctx->HeightMemory;
+        Paint_FillPlane(ctx, ctx->Image, 1, X0, Y0, X1, Y1, (Color & 0x01) ? 0xFF : 0x00);
+        Paint_FillPlane(ctx, Plane26, 1, X0, Y0, X1, Y1, (Color & 0x02) ? 0xFF : 0x00);
+#else
+        Paint_FillPlane(ctx, ctx->Image, 2, X0, Y0, X1, Y1, Color * 0x55);
+#endif
+    }
+}
+
+/******************************************************************************
+function: Fill what Paint_DrawPoint (DOT_FILL_AROUND) draws for every point
+          of a block of points
+parameter:
+    Xstart, Xend : Point columns, inclusive, any order
+    Ystart, Yend : Point rows, inclusive, any order
+    Color        : Painted color
+    Dot_Pixel    : point size
+Info:
+    Same footprint as drawing the points one at a time: a point covers
+    X - Dot_Pixel .. X + Dot_Pixel - 2 (same for Y), points outside the
+    image or whose first row is above it are skipped
+******************************************************************************/
+static void Paint_FillPoints(PAINT *ctx, int Xstart, int Ystart, int Xend, int Yend, UWORD Color, DOT_PIXEL Dot_Pixel)
+{
+    int Tmp;
+    if (Xstart > Xend) { Tmp = Xstart; Xstart = Xend; Xend = Tmp; }
+    if (Ystart > Yend) { Tmp = Ystart; Ystart = Yend; Yend = Tmp; }
+    if (Xstart < 0) Xstart = 0;
+    if (Ystart < Dot_Pixel) Ystart = Dot_Pixel;
+    if (Xend > ctx->Width) Xend = ctx->Width;
+    if (Yend > ctx->Height) Yend = ctx->Height;
+    if (Xstart > Xend || Ystart > Yend)
+        return;
+    Paint_FillArea(ctx, Xstart - Dot_Pixel, Ystart - Dot_Pixel, Xend + Dot_Pixel - 1, Yend + Dot_Pixel - 1, Color);
+}
+
 /******************************************************************************
 function: Clear the color of the picture
 parameter:
     Color : Painted colors
 ******************************************************************************/
-void Paint_Clear(UWORD Color)
+void PaintCtx_Clear(PAINT *ctx, UWORD Color)
 {
-    if(Paint.Scale == 2) {
-		for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
-				UDOUBLE Addr = X + Y*Paint.WidthByte;
-				Paint.Image[Addr] = Color;
-			}
-		}
-    }else if(Paint.Scale == 4) {
-        for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-            for (UWORD X = 0; X < Paint.WidthByte; X++ ) {
-                UDOUBLE Addr = X + Y*Paint.WidthByte;
-                Paint.Image[Addr] = (Color<<6)|(Color<<4)|(Color<<2)|Color;
-            }
-        }
-    }else if(Paint.Scale == 7 || Paint.Scale == 16) {
-		for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-			for (UWORD X = 0; X < Paint.WidthByte; X++ ) {
-				UDOUBLE Addr = X + Y*Paint.WidthByte;
-				Paint.Image[Addr] = (Color<<4)|Color;
-			}
-		}		
+    if (ctx->List) {
+        PAINT_OP *Op = Paint_RecordOp(ctx, PAINT_OP_CLEAR);
+        if (Op)
+            Op->Color = Color;
+        return;
+    }
+
+    // The byte pattern is worked out once, memset stores it a word at a time
+    UDOUBLE Size = (UDOUBLE)ctx->WidthByte * ctx->HeightByte;
+    if(ctx->Scale == 2) {
+        memset(ctx->Image, (UBYTE)Color, Size);//8 pixel =  1 byte
+    }else if(ctx->Scale == 4) {
+#if USE_NATIVE_4GRAY
+        memset(ctx->Image, (Color & 0x01) ? 0xFF : 0x00, Size);
+        memset(ctx->Image + Size, (Color & 0x02) ? 0xFF : 0x00, Size);
+#else
+        memset(ctx->Image, (UBYTE)((Color<<6)|(Color<<4)|(Color<<2)|Color), Size);
+#endif
+    }else if(ctx->Scale == 7 || ctx->Scale == 16) {
+        memset(ctx->Image, (UBYTE)((Color<<4)|Color), Size);
 	}
 }
 
@@ -300,14 +687,17 @@ parameter:
     Yend   : y end point
     Color  : Painted colors
 ******************************************************************************/
-void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+void PaintCtx_ClearWindows(PAINT *ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
 {
-    UWORD X, Y;
-    for (Y = Ystart; Y < Yend; Y++) {
-        for (X = Xstart; X < Xend; X++) {//8 pixel =  1 byte
-            Paint_SetPixel(X, Y, Color);
+    if (ctx->List) {
+        PAINT_OP *Op = Paint_RecordOp(ctx, PAINT_OP_CLEAR_WINDOWS);
+        if (Op) {
+            Op->X0 = Xstart; Op->Y0 = Ystart; Op->X1 = Xend; Op->Y1 = Yend;
+            Op->Color = Color;
         }
+        return;
     }
+    Paint_FillArea(ctx, Xstart, Ystart, Xend, Yend, Color);
 }
 
 /******************************************************************************
@@ -319,30 +709,24 @@ parameter:
     Dot_Pixel	: point size
     Dot_Style	: point Style
 ******************************************************************************/
-void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color,
+void PaintCtx_DrawPoint(PAINT *ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color,
                      DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
 {
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Debug("Paint_DrawPoint Input exceeds the normal display range\r\n");
+    if (ctx->List) {
+        PAINT_OP *Op = Paint_RecordOp(ctx, PAINT_OP_POINT);
+        if (Op) {
+            Op->X0 = Xpoint; Op->Y0 = Ypoint;
+            Op->Color = Color; Op->Width = Dot_Pixel; Op->Style = Dot_Style;
+        }
         return;
     }
+    if (Xpoint > ctx->Width || Ypoint > ctx->Height)
+        return;
 
-    int16_t XDir_Num , YDir_Num;
     if (Dot_Style == DOT_FILL_AROUND) {
-        for (XDir_Num = 0; XDir_Num < 2 * Dot_Pixel - 1; XDir_Num++) {
-            for (YDir_Num = 0; YDir_Num < 2 * Dot_Pixel - 1; YDir_Num++) {
-                if(Xpoint + XDir_Num - Dot_Pixel < 0 || Ypoint + YDir_Num - Dot_Pixel < 0)
-                    break;
-                // printf("x = %d, y = %d\r\n", Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel);
-                Paint_SetPixel(Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel, Color);
-            }
-        }
+        Paint_FillPoints(ctx, Xpoint, Ypoint, Xpoint, Ypoint, Color, Dot_Pixel);
     } else {
-        for (XDir_Num = 0; XDir_Num <  Dot_Pixel; XDir_Num++) {
-            for (YDir_Num = 0; YDir_Num <  Dot_Pixel; YDir_Num++) {
-                Paint_SetPixel(Xpoint + XDir_Num - 1, Ypoint + YDir_Num - 1, Color);
-            }
-        }
+        Paint_FillArea(ctx, Xpoint - 1, Ypoint - 1, Xpoint + Dot_Pixel - 1, Ypoint + Dot_Pixel - 1, Color);
     }
 }
 
@@ -357,15 +741,32 @@ parameter:
     Line_width : Line width
     Line_Style: Solid and dotted lines
 ******************************************************************************/
-void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+void PaintCtx_DrawLine(PAINT *ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
                     UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
 {
-    if (Xstart > Paint.Width || Ystart > Paint.Height ||
-        Xend > Paint.Width || Yend > Paint.Height) {
-        Debug("Paint_DrawLine Input exceeds the normal display range\r\n");
+    if (ctx->List) {
+        PAINT_OP *Op = Paint_RecordOp(ctx, PAINT_OP_LINE);
+        if (Op) {
+            Op->X0 = Xstart; Op->Y0 = Ystart; Op->X1 = Xend; Op->Y1 = Yend;
+            Op->Color = Color; Op->Width = Line_width; Op->Style = Line_Style;
+        }
+        return;
+    }
+    if (Xstart > ctx->Width || Ystart > ctx->Height ||
+        Xend > ctx->Width || Yend > ctx->Height)
+        return;
+
+    // Horizontal and vertical lines are one block of points
+    if (Line_Style == LINE_STYLE_SOLID && (Xstart == Xend || Ystart == Yend)) {
+        Paint_FillPoints(ctx, Xstart, Ystart, Xend, Yend, Color, Line_width);
         return;
     }
 
+    // Points cover Line_width - 1 pixels before and Line_width - 2 after
+    if (Paint_Clipped(ctx, (Xstart < Xend ? Xstart : Xend) - Line_width, (Ystart < Yend ? Ystart : Yend) - Line_width,
+                      (Xstart < Xend ? Xend : Xstart) + Line_width - 2, (Ystart < Yend ? Yend : Ystart) + Line_width - 2))
+        return;
+
     UWORD Xpoint = Xstart;
     UWORD Ypoint = Ystart;
     int dx = (int)Xend - (int)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
@@ -384,10 +785,10 @@ void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
         //Painted dotted line, 2 point is really virtual
         if (Line_Style == LINE_STYLE_DOTTED && Dotted_Len % 3 == 0) {
             //Debug("LINE_DOTTED\r\n");
-            Paint_DrawPoint(Xpoint, Ypoint, IMAGE_BACKGROUND, Line_width, DOT_STYLE_DFT);
+            PaintCtx_DrawPoint(ctx, Xpoint, Ypoint, IMAGE_BACKGROUND, Line_width, DOT_STYLE_DFT);
             Dotted_Len = 0;
         } else {
-            Paint_DrawPoint(Xpoint, Ypoint, Color, Line_width, DOT_STYLE_DFT);
+            PaintCtx_DrawPoint(ctx, Xpoint, Ypoint, Color, Line_width, DOT_STYLE_DFT);
         }
         if (2 * Esp >= dy) {
             if (Xpoint == Xend)
@@ -415,25 +816,30 @@ parameter:
     Line_width: Line width
     Draw_Fill : Whether to fill the inside of the rectangle
 ******************************************************************************/
-void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+void PaintCtx_DrawRectangle(PAINT *ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
                          UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
 {
-    if (Xstart > Paint.Width || Ystart > Paint.Height ||
-        Xend > Paint.Width || Yend > Paint.Height) {
-        Debug("Input exceeds the normal display range\r\n");
+    if (ctx->List) {
+        PAINT_OP *Op = Paint_RecordOp(ctx, PAINT_OP_RECTANGLE);
+        if (Op) {
+            Op->X0 = Xstart; Op->Y0 = Ystart; Op->X1 = Xend; Op->Y1 = Yend;
+            Op->Color = Color; Op->Width = Line_width; Op->Style = Draw_Fill;
+        }
         return;
     }
+    if (Xstart > ctx->Width || Ystart > ctx->Height ||
+        Xend > ctx->Width || Yend > ctx->Height)
+        return;
 
     if (Draw_Fill) {
-        UWORD Ypoint;
-        for(Ypoint = Ystart; Ypoint < Yend; Ypoint++) {
-            Paint_DrawLine(Xstart, Ypoint, Xend, Ypoint, Color , Line_width, LINE_STYLE_SOLID);
-        }
+        // One horizontal line per row from Ystart to Yend - 1
+        if (Ystart < Yend)
+            Paint_FillPoints(ctx, Xstart, Ystart, Xend, Yend - 1, Color, Line_width);
     } else {
-        Paint_DrawLine(Xstart, Ystart, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xstart, Ystart, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xend, Yend, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xend, Yend, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
+        PaintCtx_DrawLine(ctx, Xstart, Ystart, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
+        PaintCtx_DrawLine(ctx, Xstart, Ystart, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
+        PaintCtx_DrawLine(ctx, Xend, Yend, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
+        PaintCtx_DrawLine(ctx, Xend, Yend, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
     }
 }
 
@@ -448,13 +854,22 @@ parameter:
     Line_width: Line width
     Draw_Fill : Whether to fill the inside of the Circle
 ******************************************************************************/
-void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
+void PaintCtx_DrawCircle(PAINT *ctx, UWORD X_Center, UWORD Y_Center, UWORD Radius,
                       UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
 {
-    if (X_Center > Paint.Width || Y_Center >= Paint.Height) {
-        Debug("Paint_DrawCircle Input exceeds the normal display range\r\n");
+    if (ctx->List) {
+        PAINT_OP *Op = Paint_RecordOp(ctx, PAINT_OP_CIRCLE);
+        if (Op) {
+            Op->X0 = X_Center; Op->Y0 = Y_Center; Op->X1 = Radius;
+            Op->Color = Color; Op->Width = Line_width; Op->Style = Draw_Fill;
+        }
         return;
     }
+    if (X_Center > ctx->Width || Y_Center >= ctx->Height)
+        return;
+    if (Paint_Clipped(ctx, X_Center - Radius - Line_width, Y_Center - Radius - Line_width,
+                      X_Center + Radius + Line_width, Y_Center + Radius + Line_width))
+        return;
 
     //Draw a circle from(0, R) as a starting point
     int16_t XCurrent, YCurrent;
@@ -464,19 +879,17 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
     //Cumulative error,judge the next point of the logo
     int16_t Esp = 3 - (Radius << 1 );
 
-    int16_t sCountY;
     if (Draw_Fill == DRAW_FILL_FULL) {
         while (XCurrent <= YCurrent ) { //Realistic circles
-            for (sCountY = XCurrent; sCountY <= YCurrent; sCountY ++ ) {
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//1
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//2
-                Paint_DrawPoint(X_Center - sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//3
-                Paint_DrawPoint(X_Center - sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//4
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//5
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//6
-                Paint_DrawPoint(X_Center + sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//7
-                Paint_DrawPoint(X_Center + sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            }
+            // Points XCurrent..YCurrent of the eight octants, each run is a span
+            Paint_FillPoints(ctx, X_Center + XCurrent, Y_Center + XCurrent, X_Center + XCurrent, Y_Center + YCurrent, Color, DOT_PIXEL_DFT);//1
+            Paint_FillPoints(ctx, X_Center - XCurrent, Y_Center + XCurrent, X_Center - XCurrent, Y_Center + YCurrent, Color, DOT_PIXEL_DFT);//2
+            Paint_FillPoints(ctx, X_Center - XCurrent, Y_Center + XCurrent, X_Center - YCurrent, Y_Center + XCurrent, Color, DOT_PIXEL_DFT);//3
+            Paint_FillPoints(ctx, X_Center - XCurrent, Y_Center - XCurrent, X_Center - YCurrent, Y_Center - XCurrent, Color, DOT_PIXEL_DFT);//4
+            Paint_FillPoints(ctx, X_Center - XCurrent, Y_Center - XCurrent, X_Center - XCurrent, Y_Center - YCurrent, Color, DOT_PIXEL_DFT);//5
+            Paint_FillPoints(ctx, X_Center + XCurrent, Y_Center - XCurrent, X_Center + XCurrent, Y_Center - YCurrent, Color, DOT_PIXEL_DFT);//6
+            Paint_FillPoints(ctx, X_Center + XCurrent, Y_Center - XCurrent, X_Center + YCurrent, Y_Center - XCurrent, Color, DOT_PIXEL_DFT);//7
+            Paint_FillPoints(ctx, X_Center + XCurrent, Y_Center + XCurrent, X_Center + YCurrent, Y_Center + XCurrent, Color, DOT_PIXEL_DFT);
             if (Esp < 0 )
                 Esp += 4 * XCurrent + 6;
             else {
@@ -487,14 +900,14 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
         }
     } else { //Draw a hollow circle
         while (XCurrent <= YCurrent ) {
-            Paint_DrawPoint(X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//1
-            Paint_DrawPoint(X_Center - XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//2
-            Paint_DrawPoint(X_Center - YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//3
-            Paint_DrawPoint(X_Center - YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//4
-            Paint_DrawPoint(X_Center - XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//5
-            Paint_DrawPoint(X_Center + XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//6
-            Paint_DrawPoint(X_Center + YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//7
-            Paint_DrawPoint(X_Center + YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//0
+            PaintCtx_DrawPoint(ctx, X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//1
+            PaintCtx_DrawPoint(ctx, X_Center - XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT);//2
+            PaintCtx_DrawPoint(ctx, X_Center - YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//3
+            PaintCtx_DrawPoint(ctx, X_Center - YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//4
+            PaintCtx_DrawPoint(ctx, X_Center - XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//5
+            PaintCtx_DrawPoint(ctx, X_Center + XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT);//6
+            PaintCtx_DrawPoint(ctx, X_Center + YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT);//7
+            PaintCtx_DrawPoint(ctx, X_Center + YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT);//0
 
             if (Esp < 0 )
                 Esp += 4 * XCurrent + 6;
@@ -507,6 +920,204 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
     }
 }
 
+/******************************************************************************
+function: Blend one glyph line into a memory row
+parameter:
+    Y      : Memory row
+    X      : Memory column of the first pixel
+    Src    : Glyph line, MSB first
+    Bits   : Pixels in the line, at most 25
+    Keep   : Line pixels inside the clip rectangle, MSB first
+    Fg, Bg : Foreground and background colors
+    Opaque : 0 leaves the background pixels as they are
+Info:
+    The line is shifted into place in a 32 bit word and merged a byte
+    (8 pixels) at a time, the kept pixels must lie inside the image
+******************************************************************************/
+static const UBYTE Paint_Spread2[16] = { // 4 pixel mask, 1bpp -> 2bpp
+    0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+    0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF,
+};
+
+static inline UBYTE Paint_Blend(UBYTE Old, UBYTE Mask, UBYTE Set, UBYTE Fg, UBYTE Bg)
+{
+    return (Old & ~Mask) | (Fg & Set) | (Bg & Mask & ~Set);
+}
+
+static void Paint_BlitBits(PAINT *ctx, UWORD Y, UWORD X, UDOUBLE Line, UBYTE Bits, UDOUBLE Keep,
+                           UWORD Fg, UWORD Bg, bool Opaque)
+{
+    UBYTE Shift = X % 8;
+    UDOUBLE Mask = Keep >> Shift;
+    UDOUBLE Set = (Line >> Shift) & Mask;
+    if (!Opaque)
+        Mask = Set;
+
+    UBYTE Count = (Shift + Bits + 7) / 8;
+    UWORD Group = X / 8;
+    UBYTE *Row = ctx->Image + (UDOUBLE)Y * ctx->WidthByte;
+    if (ctx->Scale == 2) {
+        UBYTE FgPat = Fg == BLACK ? 0x00 : 0xFF, BgPat = Bg == BLACK ? 0x00 : 0xFF;
+        for (UBYTE k = 0; k < Count; k++) {
+            UBYTE M = Mask >> (24 - 8 * k), S = Set >> (24 - 8 * k);
+            if (M)
+                Row[Group + k] = Paint_Blend(Row[Group + k], M, S, FgPat, BgPat);
+        }
+        return;
+    }
+    Fg = Fg % 4;
+    Bg = Bg % 4;
+#if USE_NATIVE_4GRAY
+    UBYTE *Row26 = Row + (UDOUBLE)ctx->WidthByte * ctx->HeightMemory;
+    for (UBYTE k = 0; k < Count; k++) {
+        UBYTE M = Mask >> (24 - 8 * k), S = Set >> (24 - 8 * k);
+        if (!M)
+            continue;
+        Row[Group + k] = Paint_Blend(Row[Group + k], M, S, (Fg & 0x01) ? 0xFF : 0x00, (Bg & 0x01) ? 0xFF : 0x00);
+        Row26[Group + k] = Paint_Blend(Row26[Group + k], M, S, (Fg & 0x02) ? 0xFF : 0x00, (Bg & 0x02) ? 0xFF : 0x00);
+    }
+#else
+    UBYTE FgPat = Fg * 0x55, BgPat = Bg * 0x55;
+    for (UBYTE k = 0; k < Count; k++) {
+        UBYTE M = Mask >> (24 - 8 * k), S = Set >> (24 - 8 * k);
+        UBYTE *Pixel = Row + 2 * (Group + k);
+        if (M >> 4)
+            Pixel[0] = Paint_Blend(Pixel[0], Paint_Spread2[M >> 4], Paint_Spread2[S >> 4], FgPat, BgPat);
+        if (M & 0x0F)
+            Pixel[1] = Paint_Blend(Pixel[1], Paint_Spread2[M & 0x0F], Paint_Spread2[S & 0x0F], FgPat, BgPat);
+    }
+#endif
+}
+
+static void Paint_BlitLine(PAINT *ctx, UWORD Y, UWORD X, const UBYTE *Src, UBYTE Bits, UDOUBLE Keep,
+                           UWORD Fg, UWORD Bg, bool Opaque)
+{
+    UDOUBLE Line = 0;
+    for (UBYTE i = 0; i < (Bits + 7) / 8; i++)
+        Line |= (UDOUBLE)Src[i] << (24 - 8 * i);
+    Paint_BlitBits(ctx, Y, X, Line, Bits, Keep, Fg, Bg, Opaque);
+}
+
+/******************************************************************************
+function: Read one line of a packed glyph
+parameter:
+    Stream : Font->packed
+    Bit    : Stream offset of the line
+    Bits   : Pixels in the line, at most 25
+Info:
+    Returns the line MSB first in a 32 bit word. A line never spans more
+    than 4 bytes and extras/font_pack.py pads the stream, so 4 bytes are
+    always read
+******************************************************************************/
+static inline UDOUBLE Paint_PackedBits(const UBYTE *Stream, UDOUBLE Bit, UBYTE Bits)
+{
+    const UBYTE *p = Stream + Bit / 8;
+    UDOUBLE Word = ((UDOUBLE)p[0] << 24) | ((UDOUBLE)p[1] << 16) | ((UDOUBLE)p[2] << 8) | p[3];
+    return (Word << (Bit % 8)) & (0xFFFFFFFFu << (32 - Bits));
+}
+
+/******************************************************************************
+function: Stream offset of a packed glyph
+parameter:
+    Index : Character - ' '
+******************************************************************************/
+static inline UDOUBLE Paint_PackedGlyph(const sFONT *Font, int Index)
+{
+    UDOUBLE Slot = Font->packed_map ? Font->packed_map[Index] : Index;
+    return Slot * Font->Width * Font->Height;
+}
+
+/******************************************************************************
+function: Unpack a glyph into the byte padded row layout of Font->table
+parameter:
+    Index : Character - ' '
+    Glyph : Output, PAINT_GLYPH_BYTES
+Info:
+    For the pixel path and blits that do not match the packed orientation
+******************************************************************************/
+static void Paint_UnpackGlyph(const sFONT *Font, int Index, UBYTE *Glyph)
+{
+    UBYTE RowBytes = (Font->Width + 7) / 8;
+    UDOUBLE Base = Paint_PackedGlyph(Font, Index);
+    memset(Glyph, 0, RowBytes * Font->Height);
+    for (UWORD Page = 0; Page < Font->Height; Page++) {
+        for (UWORD Column = 0; Column < Font->Width; Column++) {
+            UDOUBLE Bit = Base + (PAINT_PACKED_COLUMNS ? Column * Font->Height + Page : Page * Font->Width + Column);
+            if (Font->packed[Bit / 8] & (0x80 >> (Bit % 8)))
+                Glyph[Page * RowBytes + Column / 8] |= 0x80 >> (Column % 8);
+        }
+    }
+}
+
+/******************************************************************************
+function: Draw a whole glyph a line at a time
+parameter:
+    Same as Paint_DrawChar
+Info:
+    ROTATE_270 copies the pre-rotated columns (Font->table_r270), each is
+    one memory row. ROTATE_0 copies the table rows as they are. A packed
+    font streams its lines (columns, or rows under USE_LANDSCAPE_PAINT)
+    out of Font->packed instead. Columns and rows outside the clip
+    rectangle are trimmed per line.
+    Returns false when the glyph needs the pixel path: other orientations,
+    mirroring or scale 7
+******************************************************************************/
+static bool Paint_BlitChar(PAINT *ctx, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                           sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (ctx->Mirror != MIRROR_NONE || (ctx->Scale != 2 && ctx->Scale != 4))
+        return false;
+
+    // Visible part of the glyph, in glyph columns and rows
+    int C0 = ctx->ClipXstart > Xpoint ? ctx->ClipXstart - Xpoint : 0;
+    int R0 = ctx->ClipYstart > Ypoint ? ctx->ClipYstart - Ypoint : 0;
+    int C1 = ctx->ClipXend - Xpoint < Font->Width ? ctx->ClipXend - Xpoint : Font->Width;
+    int R1 = ctx->ClipYend - Ypoint < Font->Height ? ctx->ClipYend - Ypoint : Font->Height;
+    if (C0 >= C1 || R0 >= R1)
+        return true;
+
+    bool Opaque = FONT_BACKGROUND != Color_Background;
+    int Index = Acsii_Char - ' ';
+    const UBYTE *Columns = PAINT_PACKED_COLUMNS ? Font->packed : NULL;
+    const UBYTE *Rows = PAINT_PACKED_COLUMNS ? NULL : Font->packed;
+    if (ctx->Rotate == ROTATE_270 && (Font->table_r270 || Columns) && Font->Height <= 25 &&
+        ctx->Width <= ctx->HeightMemory && ctx->Height <= ctx->WidthMemory) {
+        UDOUBLE Keep = (0xFFFFFFFFu >> R0) & (0xFFFFFFFFu << (32 - R1));
+        if (Columns) {
+            UDOUBLE Bit = Paint_PackedGlyph(Font, Index) + C0 * Font->Height;
+            for (int Column = C0; Column < C1; Column++, Bit += Font->Height)
+                Paint_BlitBits(ctx, ctx->HeightMemory - 1 - (Xpoint + Column), Ypoint,
+                               Paint_PackedBits(Columns, Bit, Font->Height), Font->Height, Keep,
+                               Color_Foreground, Color_Background, Opaque);
+            return true;
+        }
+        UBYTE ColumnBytes = (Font->Height + 7) / 8;
+        const UBYTE *ptr = &Font->table_r270[(Index * Font->Width + C0) * ColumnBytes];
+        for (int Column = C0; Column < C1; Column++, ptr += ColumnBytes)
+            Paint_BlitLine(ctx, ctx->HeightMemory - 1 - (Xpoint + Column), Ypoint, ptr, Font->Height, Keep,
+                           Color_Foreground, Color_Background, Opaque);
+        return true;
+    }
+    if (ctx->Rotate == ROTATE_0 && (Font->table || Rows) && Font->Width <= 25 &&
+        ctx->Width <= ctx->WidthMemory && ctx->Height <= ctx->HeightMemory) {
+        UDOUBLE Keep = (0xFFFFFFFFu >> C0) & (0xFFFFFFFFu << (32 - C1));
+        if (Rows) {
+            UDOUBLE Bit = Paint_PackedGlyph(Font, Index) + R0 * Font->Width;
+            for (int Page = R0; Page < R1; Page++, Bit += Font->Width)
+                Paint_BlitBits(ctx, Ypoint + Page, Xpoint, Paint_PackedBits(Rows, Bit, Font->Width), Font->Width, Keep,
+                               Color_Foreground, Color_Background, Opaque);
+            return true;
+        }
+        UBYTE RowBytes = (Font->Width + 7) / 8;
+        const UBYTE *ptr = &Font->table[(Index * Font->Height + R0) * RowBytes];
+        for (int Page = R0; Page < R1; Page++, ptr += RowBytes)
+            Paint_BlitLine(ctx, Ypoint + Page, Xpoint, ptr, Font->Width, Keep,
+                           Color_Foreground, Color_Background, Opaque);
+        return true;
+    }
+    return false;
+}
+
 /******************************************************************************
 function: Show English characters
 parameter:
@@ -517,18 +1128,39 @@ parameter:
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
 ******************************************************************************/
-void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+void PaintCtx_DrawChar(PAINT *ctx, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
                     sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
 {
     UWORD Page, Column;
 
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Debug("Paint_DrawChar Input exceeds the normal display range\r\n");
+    if (ctx->List) {
+        PAINT_OP *Op = Paint_RecordOp(ctx, PAINT_OP_CHAR);
+        if (Op) {
+            Op->X0 = Xpoint; Op->Y0 = Ypoint; Op->Value = Acsii_Char;
+            Op->Font = Font; Op->Color = Color_Foreground; Op->Background = Color_Background;
+        }
         return;
     }
 
+    if (Xpoint > ctx->Width || Ypoint > ctx->Height)
+        return;
+    if (Paint_Clipped(ctx, Xpoint, Ypoint, Xpoint + Font->Width - 1, Ypoint + Font->Height - 1))
+        return;
+
+    if (Paint_BlitChar(ctx, Xpoint, Ypoint, Acsii_Char, Font, Color_Foreground, Color_Background))
+        return;
+
     uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
-    const unsigned char *ptr = &Font->table[Char_Offset];
+    const unsigned char *ptr = Font->table ? &Font->table[Char_Offset] : NULL;
+    UBYTE Glyph[PAINT_GLYPH_BYTES];
+    if (!ptr) {
+        if ((Font->Width + 7) / 8 * Font->Height > PAINT_GLYPH_BYTES) {
+            Debug("Paint_DrawChar: packed glyph too large to unpack\r\n");
+            return;
+        }
+        Paint_UnpackGlyph(Font, Acsii_Char - ' ', Glyph);
+        ptr = Glyph;
+    }
 
     for (Page = 0; Page < Font->Height; Page ++ ) {
         for (Column = 0; Column < Font->Width; Column ++ ) {
@@ -536,15 +1168,15 @@ void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
             //To determine whether the font background color and screen background color is consistent
             if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
                 if (*ptr & (0x80 >> (Column % 8)))
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                    ctx->WritePixel(ctx, Xpoint + Column, Ypoint + Page, Color_Foreground);
+                    // PaintCtx_DrawPoint(ctx, Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
             } else {
                 if (*ptr & (0x80 >> (Column % 8))) {
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                    ctx->WritePixel(ctx, Xpoint + Column, Ypoint + Page, Color_Foreground);
+                    // PaintCtx_DrawPoint(ctx, Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
                 } else {
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Background);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                    ctx->WritePixel(ctx, Xpoint + Column, Ypoint + Page, Color_Background);
+                    // PaintCtx_DrawPoint(ctx, Xpoint + Column, Ypoint + Page, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
                 }
             }
             //One pixel is 8 bits
@@ -566,30 +1198,40 @@ parameter:
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
 ******************************************************************************/
-void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
+void PaintCtx_DrawString_EN(PAINT *ctx, UWORD Xstart, UWORD Ystart, const char * pString,
                          sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
 {
     UWORD Xpoint = Xstart;
     UWORD Ypoint = Ystart;
 
-    if (Xstart > Paint.Width || Ystart > Paint.Height) {
+    if (ctx->List) {
+        int32_t Text = Paint_RecordText(ctx, pString);
+        PAINT_OP *Op = Text < 0 ? NULL : Paint_RecordOp(ctx, PAINT_OP_STRING);
+        if (Op) {
+            Op->X0 = Xstart; Op->Y0 = Ystart; Op->Value = Text;
+            Op->Font = Font; Op->Color = Color_Foreground; Op->Background = Color_Background;
+        }
+        return;
+    }
+
+    if (Xstart > ctx->Width || Ystart > ctx->Height) {
         Debug("Paint_DrawString_EN Input exceeds the normal display range\r\n");
         return;
     }
 
     while (* pString != '\0') {
         //if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y direction plus the Height of the character
-        if ((Xpoint + Font->Width ) > Paint.Width ) {
+        if ((Xpoint + Font->Width ) > ctx->Width ) {
             Xpoint = Xstart;
             Ypoint += Font->Height;
         }
 
         // If the Y direction is full, reposition to(Xstart, Ystart)
-        if ((Ypoint  + Font->Height ) > Paint.Height ) {
+        if ((Ypoint  + Font->Height ) > ctx->Height ) {
             Xpoint = Xstart;
             Ypoint = Ystart;
         }
-        Paint_DrawChar(Xpoint, Ypoint, * pString, Font, Color_Background, Color_Foreground);
+        PaintCtx_DrawChar(ctx, Xpoint, Ypoint, * pString, Font, Color_Background, Color_Foreground);
 
         //The next character of the address
         pString ++;
@@ -600,101 +1242,160 @@ void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
 }
 
 
+/******************************************************************************
+function: Decode one UTF-8 character
+parameter:
+    pText : String position, advanced past the character
+Info:
+    Returns the code point, or 0xFFFD for a malformed, overlong or surrogate
+    sequence after skipping its bytes up to the first bad one. The
+    terminating NUL is never taken as a continuation byte
+******************************************************************************/
+static UDOUBLE Paint_DecodeUTF8(const char **pText)
+{
+    static const UDOUBLE Min[4] = {0, 0x80, 0x800, 0x10000};
+    const UBYTE *p = (const UBYTE *)*pText;
+    UDOUBLE Code;
+    int More, i;
+
+    if (p[0] < 0x80) {
+        *pText += 1;
+        return p[0];
+    } else if ((p[0] & 0xE0) == 0xC0) {
+        Code = p[0] & 0x1F;
+        More = 1;
+    } else if ((p[0] & 0xF0) == 0xE0) {
+        Code = p[0] & 0x0F;
+        More = 2;
+    } else if ((p[0] & 0xF8) == 0xF0) {
+        Code = p[0] & 0x07;
+        More = 3;
+    } else {
+        *pText += 1;
+        return 0xFFFD;
+    }
+    for (i = 1; i <= More; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            *pText += i;
+            return 0xFFFD;
+        }
+        Code = (Code << 6) | (p[i] & 0x3F);
+    }
+    *pText += 1 + More;
+    if (Code < Min[More] || Code > 0x10FFFF || (Code >= 0xD800 && Code <= 0xDFFF)) {
+        return 0xFFFD;
+    }
+    return Code;
+}
+
+/******************************************************************************
+function: Code point a CH_CN glyph is keyed on
+parameter:
+    Glyph : Table entry, its index holds up to 3 UTF-8 bytes
+******************************************************************************/
+static UDOUBLE Paint_GlyphCode(const CH_CN *Glyph)
+{
+    char Key[4] = {(char)Glyph->index[0], (char)Glyph->index[1], (char)Glyph->index[2], 0};
+    const char *p = Key;
+    return Paint_DecodeUTF8(&p);
+}
+
+/******************************************************************************
+function: Find the glyph of a code point
+parameter:
+    font : cFONT to search
+    Code : Unicode code point
+Info:
+    Binary search of font->index, the first of equal codes is the glyph a
+    front to back table scan finds. The index is only searched when its
+    index_size equals the table size. A font without an index, or an index
+    that disagrees with its table (not regenerated), falls back to the scan.
+    Returns NULL if the font has no such glyph
+******************************************************************************/
+static const CH_CN *Paint_FindGlyphCN(const cFONT *font, UDOUBLE Code)
+{
+    if (font->index && font->index_size != font->size) {
+        Debug("Paint_DrawString_CN: stale index, run extras/font_cn_index.py\r\n");
+    } else if (font->index) {
+        UWORD Lo = 0, Hi = font->size;
+        while (Lo < Hi) {
+            UWORD Mid = (Lo + Hi) / 2;
+            if (font->index[Mid].code < Code) {
+                Lo = Mid + 1;
+            } else {
+                Hi = Mid;
+            }
+        }
+        if (Lo == font->size || font->index[Lo].code != Code) {
+            return NULL;
+        }
+        if (font->index[Lo].glyph < font->size) {
+            const CH_CN *Glyph = &font->table[font->index[Lo].glyph];
+            if (Paint_GlyphCode(Glyph) == Code) {
+                return Glyph;
+            }
+        }
+        Debug("Paint_DrawString_CN: stale index, run extras/font_cn_index.py\r\n");
+    }
+    for (UWORD Num = 0; Num < font->size; Num++) {
+        if (Paint_GlyphCode(&font->table[Num]) == Code) {
+            return &font->table[Num];
+        }
+    }
+    return NULL;
+}
+
 /******************************************************************************
 function: Display the string
 parameter:
     Xstart  ：X coordinate
     Ystart  ：Y coordinate
     pString ：The first address of the Chinese string and English
-              string to be displayed
+              string to be displayed, UTF-8
     Font    ：A structure pointer that displays a character size
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
+Info:
+    ASCII advances ASCII_Width, anything else Width. Characters the font
+    has no glyph for (and malformed UTF-8) are left blank
 ******************************************************************************/
-void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font,
+void PaintCtx_DrawString_CN(PAINT *ctx, UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font,
                         UWORD Color_Foreground, UWORD Color_Background)
 {
     const char* p_text = pString;
     int x = Xstart, y = Ystart;
-    int i, j,Num;
+    int i, j;
+
+    if (ctx->List) {
+        ctx->List->Incomplete = true;
+        return;
+    }
 
     /* Send the string character by character on EPD */
     while (*p_text != 0) {
-        if(*p_text <= 0x7F) {  //ASCII < 126
-            for(Num = 0; Num < font->size; Num++) {
-                if(*p_text== font->table[Num].index[0]) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
+        UDOUBLE Code = Paint_DecodeUTF8(&p_text);
+        const CH_CN *Glyph = Paint_FindGlyphCN(font, Code);
+        if (Glyph) {
+            const char* ptr = &Glyph->matrix[0];
+
+            for (j = 0; j < font->Height; j++) {
+                for (i = 0; i < font->Width; i++) {
+                    if (*ptr & (0x80 >> (i % 8))) {
+                        ctx->WritePixel(ctx, x + i, y + j, Color_Foreground);
+                    } else if (FONT_BACKGROUND != Color_Background) { //this process is to speed up the scan
+                        ctx->WritePixel(ctx, x + i, y + j, Color_Background);
                     }
-                    break;
-                }
-            }
-            /* Point on the next character */
-            p_text += 1;
-            /* Decrement the column position by 16 */
-            x += font->ASCII_Width;
-        } else {        //Chinese
-            for(Num = 0; Num < font->size; Num++) {
-                if ((*p_text == font->table[Num].index[0]) && \
-                    (*(p_text + 1) == font->table[Num].index[1]) && \
-                    (*(p_text + 2) == font->table[Num].index[2])) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
+                    if (i % 8 == 7) {
+                        ptr++;
                     }
-                    break;
+                }
+                if (font->Width % 8 != 0) {
+                    ptr++;
                 }
             }
-            /* Point on the next character */
-            p_text += 3;
-            /* Decrement the column position by 16 */
-            x += font->Width;
         }
+        /* Point on the next character */
+        x += (Code <= 0x7F) ? font->ASCII_Width : font->Width;
     }
 }
 
@@ -709,7 +1410,7 @@ parameter:
     Color_Background : Select the background color
 ******************************************************************************/
 #define  ARRAY_LEN 255
-void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
+void PaintCtx_DrawNum(PAINT *ctx, UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
                    sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
 {
 
@@ -717,7 +1418,16 @@ void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
     uint8_t Str_Array[ARRAY_LEN] = {0}, Num_Array[ARRAY_LEN] = {0};
     uint8_t *pStr = Str_Array;
 
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
+    if (ctx->List) {
+        PAINT_OP *Op = Paint_RecordOp(ctx, PAINT_OP_NUM);
+        if (Op) {
+            Op->X0 = Xpoint; Op->Y0 = Ypoint; Op->Value = Nummber;
+            Op->Font = Font; Op->Color = Color_Foreground; Op->Background = Color_Background;
+        }
+        return;
+    }
+
+    if (Xpoint > ctx->Width || Ypoint > ctx->Height) {
         Debug("Paint_DisNum Input exceeds the normal display range\r\n");
         return;
     }
@@ -737,7 +1447,7 @@ void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
     }
 
     //show
-    Paint_DrawString_EN(Xpoint, Ypoint, (const char*)pStr, Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawString_EN(ctx, Xpoint, Ypoint, (const char*)pStr, Font, Color_Background, Color_Foreground);
 }
 
 /******************************************************************************
@@ -750,7 +1460,7 @@ parameter:
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
 ******************************************************************************/
-void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
+void PaintCtx_DrawTime(PAINT *ctx, UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
                     UWORD Color_Foreground, UWORD Color_Background)
 {
     uint8_t value[10] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
@@ -758,14 +1468,14 @@ void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
     UWORD Dx = Font->Width;
 
     //Write data into the cache
-    Paint_DrawChar(Xstart                           , Ystart, value[pTime->Hour / 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx                      , Ystart, value[pTime->Hour % 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx  + Dx / 4 + Dx / 2   , Ystart, ':'                    , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 2 + Dx / 2         , Ystart, value[pTime->Min / 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 3 + Dx / 2         , Ystart, value[pTime->Min % 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 4 + Dx / 2 - Dx / 4, Ystart, ':'                    , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 5                  , Ystart, value[pTime->Sec / 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 6                  , Ystart, value[pTime->Sec % 10] , Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(ctx, Xstart                           , Ystart, value[pTime->Hour / 10], Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(ctx, Xstart + Dx                      , Ystart, value[pTime->Hour % 10], Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(ctx, Xstart + Dx  + Dx / 4 + Dx / 2   , Ystart, ':'                    , Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(ctx, Xstart + Dx * 2 + Dx / 2         , Ystart, value[pTime->Min / 10] , Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(ctx, Xstart + Dx * 3 + Dx / 2         , Ystart, value[pTime->Min % 10] , Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(ctx, Xstart + Dx * 4 + Dx / 2 - Dx / 4, Ystart, ':'                    , Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(ctx, Xstart + Dx * 5                  , Ystart, value[pTime->Sec / 10] , Font, Color_Background, Color_Foreground);
+    PaintCtx_DrawChar(ctx, Xstart + Dx * 6                  , Ystart, value[pTime->Sec % 10] , Font, Color_Background, Color_Foreground);
 }
 
 /******************************************************************************
@@ -776,15 +1486,20 @@ info:
     Use a computer to convert the image into a corresponding array,
     and then embed the array directly into Imagedata.cpp as a .c file.
 ******************************************************************************/
-void Paint_DrawBitMap(const unsigned char* image_buffer)
+void PaintCtx_DrawBitMap(PAINT *ctx, const unsigned char* image_buffer)
 {
     UWORD x, y;
     UDOUBLE Addr = 0;
 
-    for (y = 0; y < Paint.HeightByte; y++) {
-        for (x = 0; x < Paint.WidthByte; x++) {//8 pixel =  1 byte
-            Addr = x + y * Paint.WidthByte;
-            Paint.Image[Addr] = (unsigned char)image_buffer[Addr];
+    if (ctx->List) {
+        ctx->List->Incomplete = true;
+        return;
+    }
+
+    for (y = 0; y < ctx->HeightByte; y++) {
+        for (x = 0; x < ctx->WidthByte; x++) {//8 pixel =  1 byte
+            Addr = x + y * ctx->WidthByte;
+            ctx->Image[Addr] = (unsigned char)image_buffer[Addr];
         }
     }
 }
@@ -798,17 +1513,187 @@ parameter:
     xEnd             ：Image width
     yEnd             : Image height
 ******************************************************************************/
-void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image) 
+void PaintCtx_DrawImage(PAINT *ctx, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image) 
 {
     UWORD x, y;
 	UWORD w_byte=(W_Image%8)?(W_Image/8)+1:W_Image/8;
     UDOUBLE Addr = 0;
 	UDOUBLE pAddr = 0;
+
+    if (ctx->List) {
+        ctx->List->Incomplete = true;
+        return;
+    }
     for (y = 0; y < H_Image; y++) {
         for (x = 0; x < w_byte; x++) {//8 pixel =  1 byte
             Addr = x + y * w_byte;
-			pAddr=x+(xStart/8)+((y+yStart)*Paint.WidthByte);
-            Paint.Image[pAddr] = (unsigned char)image_buffer[Addr];
+			pAddr=x+(xStart/8)+((y+yStart)*ctx->WidthByte);
+            ctx->Image[pAddr] = (unsigned char)image_buffer[Addr];
         }
     }
 }
+
+/******************************************************************************
+function: Draw a recorded display list
+parameter:
+    List : Recorded by PaintCtx_Record
+Info:
+    Each call is made again in order on ctx. Clear only fills the clip
+    rectangle, so replaying a list into banded copies of the recording
+    context paints the same image band by band
+******************************************************************************/
+void PaintCtx_Replay(PAINT *ctx, const PAINT_LIST *List)
+{
+    for (UWORD i = 0; i < List->Count; i++) {
+        const PAINT_OP *Op = &List->Ops[i];
+        switch (Op->Type) {
+        case PAINT_OP_CLEAR:
+            if (ctx->ClipXstart == 0 && ctx->ClipYstart == 0 &&
+                ctx->ClipXend == ctx->Width && ctx->ClipYend == ctx->Height)
+                PaintCtx_Clear(ctx, Op->Color);
+            else
+                Paint_FillArea(ctx, ctx->ClipXstart, ctx->ClipYstart, ctx->ClipXend, ctx->ClipYend, Op->Color);
+            break;
+        case PAINT_OP_CLEAR_WINDOWS:
+            PaintCtx_ClearWindows(ctx, Op->X0, Op->Y0, Op->X1, Op->Y1, Op->Color);
+            break;
+        case PAINT_OP_POINT:
+            PaintCtx_DrawPoint(ctx, Op->X0, Op->Y0, Op->Color, (DOT_PIXEL)Op->Width, (DOT_STYLE)Op->Style);
+            break;
+        case PAINT_OP_LINE:
+            PaintCtx_DrawLine(ctx, Op->X0, Op->Y0, Op->X1, Op->Y1, Op->Color, (DOT_PIXEL)Op->Width, (LINE_STYLE)Op->Style);
+            break;
+        case PAINT_OP_RECTANGLE:
+            PaintCtx_DrawRectangle(ctx, Op->X0, Op->Y0, Op->X1, Op->Y1, Op->Color, (DOT_PIXEL)Op->Width, (DRAW_FILL)Op->Style);
+            break;
+        case PAINT_OP_CIRCLE:
+            PaintCtx_DrawCircle(ctx, Op->X0, Op->Y0, Op->X1, Op->Color, (DOT_PIXEL)Op->Width, (DRAW_FILL)Op->Style);
+            break;
+        case PAINT_OP_CHAR:
+            PaintCtx_DrawChar(ctx, Op->X0, Op->Y0, (char)Op->Value, Op->Font, Op->Color, Op->Background);
+            break;
+        case PAINT_OP_STRING:
+            PaintCtx_DrawString_EN(ctx, Op->X0, Op->Y0, List->Text + Op->Value, Op->Font, Op->Color, Op->Background);
+            break;
+        case PAINT_OP_NUM:
+            PaintCtx_DrawNum(ctx, Op->X0, Op->Y0, Op->Value, Op->Font, Op->Color, Op->Background);
+            break;
+        }
+    }
+}
+
+/******************************************************************************
+function: Global Paint context
+Info:
+    The original single context API, each call draws into Paint through the
+    PaintCtx_* function of the same name
+******************************************************************************/
+void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
+{
+    PaintCtx_NewImage(&Paint, image, Width, Height, Rotate, Color);
+}
+
+void Paint_SelectImage(UBYTE *image)
+{
+    PaintCtx_SelectImage(&Paint, image);
+}
+
+void Paint_SetRotate(UWORD Rotate)
+{
+    PaintCtx_SetRotate(&Paint, Rotate);
+}
+
+void Paint_SetMirroring(UBYTE mirror)
+{
+    PaintCtx_SetMirroring(&Paint, mirror);
+}
+
+void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    PaintCtx_SetPixel(&Paint, Xpoint, Ypoint, Color);
+}
+
+void Paint_SetScale(UBYTE scale)
+{
+    PaintCtx_SetScale(&Paint, scale);
+}
+
+void Paint_SetClip(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    PaintCtx_SetClip(&Paint, Xstart, Ystart, Xend, Yend);
+}
+
+void Paint_ResetClip(void)
+{
+    PaintCtx_ResetClip(&Paint);
+}
+
+void Paint_Record(PAINT_LIST *List)
+{
+    PaintCtx_Record(&Paint, List);
+}
+
+void Paint_Clear(UWORD Color)
+{
+    PaintCtx_Clear(&Paint, Color);
+}
+
+void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    PaintCtx_ClearWindows(&Paint, Xstart, Ystart, Xend, Yend, Color);
+}
+
+void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay)
+{
+    PaintCtx_DrawPoint(&Paint, Xpoint, Ypoint, Color, Dot_Pixel, Dot_FillWay);
+}
+
+void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style)
+{
+    PaintCtx_DrawLine(&Paint, Xstart, Ystart, Xend, Yend, Color, Line_width, Line_Style);
+}
+
+void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    PaintCtx_DrawRectangle(&Paint, Xstart, Ystart, Xend, Yend, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
+{
+    PaintCtx_DrawCircle(&Paint, X_Center, Y_Center, Radius, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawChar(UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawChar(&Paint, Xstart, Ystart, Acsii_Char, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawString_EN(&Paint, Xstart, Ystart, pString, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawString_CN(&Paint, Xstart, Ystart, pString, font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawNum(&Paint, Xpoint, Ypoint, Nummber, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    PaintCtx_DrawTime(&Paint, Xstart, Ystart, pTime, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawBitMap(const unsigned char* image_buffer)
+{
+    PaintCtx_DrawBitMap(&Paint, image_buffer);
+}
+
+void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image)
+{
+    PaintCtx_DrawImage(&Paint, image_buffer, xStart, yStart, W_Image, H_Image);
+}
@@ -83,9 +83,48 @@
 #include "fonts/fonts.h"
 
 /**
- * Image attributes
+ * Display list, the draw calls a context made while recording (see
+ * PaintCtx_Record) so they can be replayed into other contexts
 **/
+#define PAINT_LIST_OPS      64
+#define PAINT_LIST_TEXT     1024
+typedef enum {
+    PAINT_OP_CLEAR = 0,
+    PAINT_OP_CLEAR_WINDOWS,
+    PAINT_OP_POINT,
+    PAINT_OP_LINE,
+    PAINT_OP_RECTANGLE,
+    PAINT_OP_CIRCLE,
+    PAINT_OP_CHAR,
+    PAINT_OP_STRING,
+    PAINT_OP_NUM,
+} PAINT_OP_TYPE;
+
+typedef struct {
+    UBYTE Type;         // PAINT_OP_TYPE
+    UBYTE Width;        // DOT_PIXEL
+    UBYTE Style;        // DOT_STYLE, LINE_STYLE or DRAW_FILL
+    UWORD X0, Y0;
+    UWORD X1, Y1;       // end point, X1 is the radius of a circle
+    UWORD Color;
+    UWORD Background;
+    sFONT *Font;
+    int32_t Value;      // character, number, or string offset into Text
+} PAINT_OP;
+
 typedef struct {
+    PAINT_OP Ops[PAINT_LIST_OPS];
+    char Text[PAINT_LIST_TEXT];
+    UWORD Count;
+    UWORD TextUsed;
+    bool Incomplete;    // ran out of room or saw a call that cannot be recorded
+} PAINT_LIST;
+
+/**
+ * Image attributes, one per canvas. The PaintCtx_* functions draw into the
+ * context they are given, the Paint_* functions into the global Paint
+**/
+typedef struct _tPaint {
     UBYTE *Image;
     UWORD Width;
     UWORD Height;
@@ -97,6 +136,12 @@ typedef struct {
     UWORD WidthByte;
     UWORD HeightByte;
     UWORD Scale;
+    UWORD ClipXstart;   // clip rectangle, see Paint_SetClip
+    UWORD ClipYstart;
+    UWORD ClipXend;     // exclusive
+    UWORD ClipYend;
+    void (*WritePixel)(struct _tPaint *ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color); // picked for Rotate/Mirror/Scale, see Paint_SetPixel
+    PAINT_LIST *List;   // draw calls are recorded here instead of drawn, see PaintCtx_Record
 } PAINT;
 extern PAINT Paint;
 
@@ -188,13 +233,49 @@ typedef struct {
 } PAINT_TIME;
 extern PAINT_TIME sPaint_time;
 
-//init and Clear
+//Paint contexts: init and Clear
+void PaintCtx_NewImage(PAINT *ctx, UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color);
+void PaintCtx_SelectImage(PAINT *ctx, UBYTE *image);
+void PaintCtx_SetRotate(PAINT *ctx, UWORD Rotate);
+void PaintCtx_SetMirroring(PAINT *ctx, UBYTE mirror);
+void PaintCtx_SetPixel(PAINT *ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color);
+void PaintCtx_SetScale(PAINT *ctx, UBYTE scale);
+void PaintCtx_SetClip(PAINT *ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void PaintCtx_ResetClip(PAINT *ctx);
+void PaintCtx_SetBand(PAINT *ctx, UWORD Ystart, UWORD Yend);
+void PaintCtx_Record(PAINT *ctx, PAINT_LIST *List);
+void PaintCtx_Replay(PAINT *ctx, const PAINT_LIST *List);
+
+void PaintCtx_Clear(PAINT *ctx, UWORD Color);
+void PaintCtx_ClearWindows(PAINT *ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+
+//Drawing
+void PaintCtx_DrawPoint(PAINT *ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_FillWay);
+void PaintCtx_DrawLine(PAINT *ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, LINE_STYLE Line_Style);
+void PaintCtx_DrawRectangle(PAINT *ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void PaintCtx_DrawCircle(PAINT *ctx, UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+
+//Display string
+void PaintCtx_DrawChar(PAINT *ctx, UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawString_EN(PAINT *ctx, UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawString_CN(PAINT *ctx, UWORD Xstart, UWORD Ystart, const char * pString, cFONT* font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawNum(PAINT *ctx, UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+void PaintCtx_DrawTime(PAINT *ctx, UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+
+//pic
+void PaintCtx_DrawBitMap(PAINT *ctx, const unsigned char* image_buffer);
+void PaintCtx_DrawImage(PAINT *ctx, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image); 
+
+//Global Paint context: init and Clear
 void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color);
 void Paint_SelectImage(UBYTE *image);
 void Paint_SetRotate(UWORD Rotate);
 void Paint_SetMirroring(UBYTE mirror);
 void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color);
 void Paint_SetScale(UBYTE scale);
+void Paint_SetClip(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+void Paint_ResetClip(void);
+void Paint_Record(PAINT_LIST *List);
 
 void Paint_Clear(UWORD Color);
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
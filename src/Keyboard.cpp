@@ -116,6 +116,7 @@ static void keyTask(void *pv) {
 
         // Key press detected!
         SetLastActivityTick(); // Reset idle timer for display on any key press
+        SetLastKeyTick();      // Keeps the command page in fast typing mode
 
         // Handle special key if mapped (exit sequential and return to base handling)
         if (keycode >= 0x80 && keycode <= 0xAF) {
@@ -36,6 +36,7 @@
   */
 
 /* Includes ------------------------------------------------------------------*/
+#include "../DEV_Config.h"
 #include "fonts.h"
 
 // 
@@ -1375,10 +1376,16 @@ const uint8_t Font12_Table[] =
 	0x00, //        
 };
 
+// USE_PACKED_FONTS builds define Font12 in font_packed.cpp, this table is not linked then
+#if !USE_PACKED_FONTS
 sFONT Font12 = {
   Font12_Table,
   7, /* Width */
   12, /* Height */
+  Font12_Table_R270,
+  NULL,
+  NULL,
 };
+#endif
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
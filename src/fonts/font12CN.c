@@ -37,6 +37,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
+#include "fontCN_index.h"
 
 // 
 //  Font data for Courier New 12pt
@@ -114,6 +115,8 @@ cFONT Font12CN = {
   11, /* ASCII Width */
   16, /* Width */
   21, /* Height */
+  Font12CN_Index,
+  FONT12CN_INDEX_SIZE, /* entries in the index */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -36,6 +36,7 @@
   */
 
 /* Includes ------------------------------------------------------------------*/
+#include "../DEV_Config.h"
 #include "fonts.h"
 
 // 
@@ -1755,10 +1756,16 @@ const uint8_t Font16_Table[] =
 	0x00, 0x00, //            
 };
 
+// USE_PACKED_FONTS builds define Font16 in font_packed.cpp, this table is not linked then
+#if !USE_PACKED_FONTS
 sFONT Font16 = {
   Font16_Table,
   11, /* Width */
   16, /* Height */
+  Font16_Table_R270,
+  NULL,
+  NULL,
 };
+#endif
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
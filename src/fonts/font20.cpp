@@ -36,6 +36,7 @@
   */
 
 /* Includes ------------------------------------------------------------------*/
+#include "../DEV_Config.h"
 #include "fonts.h"
 
 // Character bitmaps for Courier New 15pt
@@ -2133,10 +2134,16 @@ const uint8_t Font20_Table[] =
 };
 
 
+// USE_PACKED_FONTS builds define Font20 in font_packed.cpp, this table is not linked then
+#if !USE_PACKED_FONTS
 sFONT Font20 = {
   Font20_Table,
   14, /* Width */
   20, /* Height */
+  Font20_Table_R270,
+  NULL,
+  NULL,
 };
+#endif
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
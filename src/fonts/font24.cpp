@@ -36,6 +36,7 @@
   */
 
 /* Includes ------------------------------------------------------------------*/
+#include "../DEV_Config.h"
 #include "fonts.h"
 
 const uint8_t Font24_Table [] = 
@@ -2511,10 +2512,16 @@ const uint8_t Font24_Table [] =
 	0x00, 0x00, 0x00, //                  
 };
 
+// USE_PACKED_FONTS builds define Font24 in font_packed.cpp, this table is not linked then
+#if !USE_PACKED_FONTS
 sFONT Font24 = {
   Font24_Table,
   17, /* Width */
   24, /* Height */
+  Font24_Table_R270,
+  NULL,
+  NULL,
 };
+#endif
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -37,6 +37,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
+#include "fontCN_index.h"
 
 // 
 //  Font data for Courier New 12pt
@@ -459,6 +460,8 @@ cFONT Font24CN = {
   24, /* ASCII Width */
   32, /* Width */
   41, /* Height */
+  Font24CN_Index,
+  FONT24CN_INDEX_SIZE, /* entries in the index */
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
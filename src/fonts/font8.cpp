@@ -36,6 +36,7 @@
   */
 
 /* Includes ------------------------------------------------------------------*/
+#include "../DEV_Config.h"
 #include "fonts.h"
 
 // 
@@ -995,10 +996,16 @@ const uint8_t Font8_Table[] =
 	0x00, //      
 };
 
+// USE_PACKED_FONTS builds define Font8 in font_packed.cpp, this table is not linked then
+#if !USE_PACKED_FONTS
 sFONT Font8 = {
   Font8_Table,
   5, /* Width */
   8, /* Height */
+  Font8_Table_R270,
+  NULL,
+  NULL,
 };
+#endif
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
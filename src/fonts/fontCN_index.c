@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @file    fontCN_index.c
+  * @brief   Font12CN/Font24CN table positions sorted by code point.
+  *          Generated by extras/font_cn_index.py from the font*CN.c tables, do not edit.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+// 9 glyphs
+const CH_CN_INDEX Font12CN_Index[] = 
+{
+	{0x0041,   8}, // 'A'
+	{0x0061,   5}, // 'a'
+	{0x0062,   6}, // 'b'
+	{0x0063,   7}, // 'c'
+	{0x4F60,   0}, // '你'
+	{0x597D,   1}, // '好'
+	{0x6811,   2}, // '树'
+	{0x6D3E,   4}, // '派'
+	{0x8393,   3}, // '莓'
+};
+
+// 27 glyphs
+const CH_CN_INDEX Font24CN_Index[] = 
+{
+	{0x0041,  19}, // 'A'
+	{0x0061,  20}, // 'a'
+	{0x0062,  21}, // 'b'
+	{0x0063,  22}, // 'c'
+	{0x4E0B,   9}, // '下'
+	{0x4E3A,  15}, // '为'
+	{0x4F53,   8}, // '体'
+	{0x4F60,   0}, // '你'
+	{0x597D,   1}, // '好'
+	{0x5B50,  26}, // '子'
+	{0x5B57,   7}, // '字'
+	{0x5BF9,  10}, // '对'
+	{0x5E94,  11}, // '应'
+	{0x5FAE,   2}, // '微'
+	{0x5FAE,  23}, // '微'
+	{0x6811,  16}, // '树'
+	{0x6B64,   6}, // '此'
+	{0x6D3E,  18}, // '派'
+	{0x70B9,  13}, // '点'
+	{0x7535,  25}, // '电'
+	{0x7684,  12}, // '的'
+	{0x8393,  17}, // '莓'
+	{0x8F6F,   3}, // '软'
+	{0x9635,  14}, // '阵'
+	{0x96C5,   4}, // '雅'
+	{0x96EA,  24}, // '雪'
+	{0x9ED1,   5}, // '黑'
+};
@@ -0,0 +1,14 @@
+/**
+  ******************************************************************************
+  * @file    fontCN_index.h
+  * @brief   Entries in the Font12CN/Font24CN indexes of fontCN_index.c.
+  *          Generated by extras/font_cn_index.py from the font*CN.c tables, do not edit.
+  ******************************************************************************
+  */
+#ifndef __FONTCN_INDEX_H
+#define __FONTCN_INDEX_H
+
+#define FONT12CN_INDEX_SIZE 9
+#define FONT24CN_INDEX_SIZE 27
+
+#endif
@@ -0,0 +1,1589 @@
+/**
+  ******************************************************************************
+  * @file    font_packed.cpp
+  * @brief   Font8-Font24 glyphs as bit packed lines for USE_PACKED_FONTS.
+  *          Generated by extras/font_pack.py from the font*.cpp tables, do not edit.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "../DEV_Config.h"
+#include "fonts.h"
+
+#if USE_PACKED_FONTS
+
+// 5x8, 40 bits per glyph, 475 B packed (font8.cpp + font_r270.cpp: 1235 B)
+#if USE_LANDSCAPE_PAINT
+const uint8_t Font8_Packed[] = 
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0x40, 0x10, 0x00, 0x52, 0x80, 0x00, 0x00, 0x00, 0x2A,
+	0xBE, 0xAF, 0xAA, 0x80, 0x21, 0x98, 0x61, 0x30, 0x80, 0x21, 0x06, 0xC1, 0x08, 0x00, 0x01, 0xC8,
+	0xC5, 0x3C, 0x00, 0x21, 0x08, 0x00, 0x00, 0x00, 0x11, 0x08, 0x42, 0x10, 0x40, 0x41, 0x08, 0x42,
+	0x11, 0x00, 0x23, 0x88, 0xA0, 0x00, 0x00, 0x01, 0x09, 0xF2, 0x10, 0x00, 0x00, 0x00, 0x01, 0x10,
+	0x80, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x11, 0x08, 0x44, 0x22, 0x00,
+	0x22, 0x94, 0xA5, 0x10, 0x00, 0x61, 0x08, 0x42, 0x7C, 0x00, 0x22, 0x88, 0x44, 0x38, 0x00, 0x22,
+	0x84, 0x41, 0x30, 0x00, 0x11, 0x94, 0xF1, 0x1C, 0x00, 0x72, 0x18, 0x25, 0x10, 0x00, 0x32, 0x18,
+	0xA5, 0x30, 0x00, 0x72, 0x84, 0x42, 0x10, 0x00, 0x22, 0x88, 0xA5, 0x10, 0x00, 0x32, 0x94, 0x61,
+	0x30, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x04, 0x01, 0x10, 0x00, 0x00, 0x89, 0x82, 0x08,
+	0x00, 0x03, 0x80, 0xE0, 0x00, 0x00, 0x02, 0x08, 0x32, 0x20, 0x00, 0x22, 0x84, 0x40, 0x10, 0x00,
+	0x32, 0x52, 0xB4, 0xA0, 0xE0, 0x61, 0x14, 0xE8, 0xEC, 0x00, 0xF2, 0x5C, 0x94, 0xF8, 0x00, 0x72,
+	0x90, 0x84, 0x18, 0x00, 0xF2, 0x52, 0x94, 0xF8, 0x00, 0xFA, 0x58, 0x84, 0xFC, 0x00, 0xFA, 0x58,
+	0x84, 0x70, 0x00, 0x72, 0x10, 0xB5, 0x18, 0x00, 0xEA, 0x5E, 0x94, 0xF4, 0x00, 0x71, 0x08, 0x42,
+	0x38, 0x00, 0x38, 0x84, 0xA5, 0x10, 0x00, 0xDA, 0x98, 0xE5, 0x6C, 0x00, 0xE2, 0x10, 0x84, 0xFC,
+	0x00, 0xDE, 0xF7, 0x58, 0xEC, 0x00, 0xDB, 0x5A, 0xB5, 0xF4, 0x00, 0x32, 0x52, 0x94, 0x98, 0x00,
+	0xF2, 0x52, 0xE4, 0x70, 0x00, 0x32, 0x52, 0x94, 0x98, 0x60, 0xF2, 0x52, 0xE4, 0xF4, 0x00, 0x72,
+	0x88, 0x25, 0x38, 0x00, 0xFD, 0x48, 0x42, 0x38, 0x00, 0xDA, 0x52, 0x94, 0x98, 0x00, 0xDC, 0x52,
+	0xA5, 0x18, 0x00, 0xDC, 0x6B, 0x5A, 0xA8, 0x00, 0xDA, 0x88, 0x45, 0x6C, 0x00, 0xDC, 0x54, 0x42,
+	0x38, 0x00, 0x7A, 0x44, 0x44, 0xBC, 0x00, 0x31, 0x08, 0x42, 0x10, 0xC0, 0x82, 0x10, 0x42, 0x10,
+	0x40, 0x61, 0x08, 0x42, 0x11, 0x80, 0x21, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+	0x20, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x27, 0x3C, 0x00, 0xC2, 0x1C, 0x94, 0xF8, 0x00, 0x00,
+	0x1C, 0x84, 0x38, 0x00, 0x18, 0x4E, 0x94, 0x9C, 0x00, 0x00, 0x1C, 0xE4, 0x18, 0x00, 0x11, 0x1C,
+	0x42, 0x38, 0x00, 0x00, 0x0E, 0x94, 0x9C, 0x26, 0xC2, 0x1C, 0x94, 0xF4, 0x00, 0x20, 0x18, 0x42,
+	0x38, 0x00, 0x20, 0x1C, 0x21, 0x08, 0x4E, 0xC2, 0x16, 0xE5, 0x6C, 0x00, 0x61, 0x08, 0x42, 0x38,
+	0x00, 0x00, 0x35, 0x5A, 0xD4, 0x00, 0x00, 0x3C, 0x94, 0xE4, 0x00, 0x00, 0x0C, 0x94, 0x98, 0x00,
+	0x00, 0x3C, 0x94, 0xB9, 0x1C, 0x00, 0x0E, 0x94, 0x9C, 0x23, 0x00, 0x1E, 0x42, 0x38, 0x00, 0x00,
+	0x0C, 0x41, 0x30, 0x00, 0x02, 0x3C, 0x84, 0x98, 0x00, 0x00, 0x36, 0x94, 0x9C, 0x00, 0x00, 0x32,
+	0x93, 0x18, 0x00, 0x00, 0x37, 0x5A, 0xA8, 0x00, 0x00, 0x12, 0x63, 0x24, 0x00, 0x00, 0x36, 0xA5,
+	0x10, 0x8C, 0x00, 0x1E, 0xA2, 0xBC, 0x00, 0x11, 0x08, 0xC2, 0x10, 0x40, 0x21, 0x08, 0x42, 0x10,
+	0x80, 0x41, 0x08, 0x62, 0x11, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+#else
+const uint8_t Font8_Packed[] = 
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x2A,
+	0x7C, 0xAA, 0x7C, 0xA8, 0x00, 0x24, 0xF6, 0x58, 0x00, 0x00, 0x10, 0xD0, 0x2C, 0x20, 0x00, 0x1C,
+	0x74, 0x4C, 0x44, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x82, 0x00, 0x00, 0x82, 0x7C,
+	0x00, 0x00, 0x00, 0x50, 0xE0, 0x50, 0x00, 0x10, 0x10, 0x7C, 0x10, 0x10, 0x00, 0x00, 0x06, 0x08,
+	0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x02, 0x0C, 0x70, 0x80, 0x00,
+	0x00, 0x78, 0x84, 0x78, 0x00, 0x04, 0x84, 0xFC, 0x04, 0x04, 0x00, 0x4C, 0xB4, 0x44, 0x00, 0x00,
+	0x44, 0x94, 0x68, 0x00, 0x00, 0x30, 0x54, 0xFC, 0x14, 0x00, 0xE8, 0xA4, 0x98, 0x00, 0x00, 0x7C,
+	0xA4, 0x98, 0x00, 0x00, 0xC0, 0x9C, 0xE0, 0x00, 0x00, 0x58, 0xA4, 0x58, 0x00, 0x00, 0x64, 0x94,
+	0xF8, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x04, 0x28, 0x00, 0x10, 0x10, 0x28, 0x44,
+	0x00, 0x00, 0x50, 0x50, 0x50, 0x00, 0x00, 0x44, 0x28, 0x10, 0x10, 0x00, 0x40, 0x94, 0x60, 0x00,
+	0x00, 0x7C, 0x82, 0x92, 0x7A, 0x0C, 0xB4, 0xD0, 0x34, 0x0C, 0x84, 0xFC, 0xA4, 0xA4, 0x58, 0x00,
+	0xF8, 0x84, 0xC4, 0x00, 0x84, 0xFC, 0x84, 0x84, 0x78, 0x84, 0xFC, 0xA4, 0x84, 0xCC, 0x84, 0xFC,
+	0xA4, 0x80, 0xC0, 0x00, 0xF8, 0x84, 0x9C, 0x10, 0x84, 0xFC, 0xA4, 0x20, 0xFC, 0x00, 0x84, 0xFC,
+	0x84, 0x00, 0x00, 0x18, 0x84, 0xF8, 0x80, 0x84, 0xFC, 0x30, 0xDC, 0x84, 0x84, 0xFC, 0x84, 0x04,
+	0x0C, 0xFC, 0xE4, 0x10, 0xE4, 0xFC, 0x84, 0xFC, 0x64, 0x98, 0xFC, 0x00, 0x78, 0x84, 0x84, 0x78,
+	0x84, 0xFC, 0x94, 0x90, 0x60, 0x00, 0x78, 0x84, 0x86, 0x7A, 0x84, 0xFC, 0x94, 0x90, 0x6C, 0x00,
+	0xCC, 0xA4, 0xDC, 0x00, 0xC0, 0x84, 0xFC, 0x84, 0xC0, 0x80, 0xF8, 0x04, 0x84, 0xF8, 0xC0, 0xB8,
+	0x04, 0x9C, 0xE0, 0xF8, 0x84, 0x38, 0x84, 0xF8, 0x84, 0xCC, 0x30, 0xCC, 0x84, 0xC0, 0xA4, 0x1C,
+	0xA4, 0xC0, 0x00, 0xCC, 0x94, 0xA4, 0xCC, 0x00, 0x00, 0xFE, 0x82, 0x00, 0x80, 0x60, 0x1C, 0x02,
+	0x00, 0x00, 0x82, 0xFE, 0x00, 0x00, 0x00, 0x20, 0xC0, 0x20, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x0C, 0x2C, 0x3C, 0x04, 0x84, 0xFC, 0x24, 0x24, 0x18, 0x00,
+	0x3C, 0x24, 0x24, 0x00, 0x00, 0x18, 0x24, 0xA4, 0xFC, 0x00, 0x38, 0x34, 0x34, 0x00, 0x00, 0x24,
+	0x7C, 0xA4, 0x00, 0x00, 0x18, 0x25, 0x25, 0x3E, 0x84, 0xFC, 0x24, 0x20, 0x1C, 0x00, 0x24, 0xBC,
+	0x04, 0x00, 0x00, 0x21, 0xA1, 0x3F, 0x00, 0x84, 0xFC, 0x10, 0x3C, 0x24, 0x00, 0x84, 0xFC, 0x04,
+	0x00, 0x3C, 0x20, 0x1C, 0x20, 0x1C, 0x24, 0x3C, 0x20, 0x20, 0x1C, 0x00, 0x18, 0x24, 0x24, 0x18,
+	0x21, 0x3F, 0x25, 0x24, 0x18, 0x00, 0x18, 0x24, 0x25, 0x3F, 0x00, 0x24, 0x3C, 0x24, 0x20, 0x00,
+	0x04, 0x34, 0x28, 0x00, 0x20, 0x78, 0x24, 0x24, 0x08, 0x20, 0x38, 0x04, 0x24, 0x3C, 0x20, 0x30,
+	0x0C, 0x0C, 0x30, 0x38, 0x24, 0x18, 0x24, 0x38, 0x00, 0x24, 0x18, 0x18, 0x24, 0x20, 0x39, 0x07,
+	0x38, 0x20, 0x00, 0x34, 0x2C, 0x34, 0x2C, 0x00, 0x10, 0x7C, 0x82, 0x00, 0x00, 0x00, 0xFE, 0x00,
+	0x00, 0x00, 0x82, 0x7C, 0x10, 0x00, 0x00, 0x08, 0x10, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00,
+};
+#endif
+
+sFONT Font8 = {
+  NULL,
+  5, /* Width */
+  8, /* Height */
+  NULL,
+  Font8_Packed,
+  NULL,
+};
+
+// 7x12, 84 bits per glyph, 998 B packed (font12.cpp + font_r270.cpp: 2470 B)
+#if USE_LANDSCAPE_PAINT
+const uint8_t Font12_Packed[] = 
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x22, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x85, 0x14, 0x7C, 0x51, 0xF1, 0x45, 0x0A, 0x00, 0x00, 0x00, 0x20, 0xE2, 0x04, 0x07, 0x12,
+	0x38, 0x10, 0x20, 0x00, 0x00, 0x04, 0x14, 0x10, 0x0C, 0xE0, 0x20, 0xA0, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xC2, 0x04, 0x15, 0x24, 0x34, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x81, 0x02, 0x04, 0x08, 0x10, 0x10, 0x20, 0x00, 0x04,
+	0x08, 0x08, 0x10, 0x20, 0x40, 0x81, 0x04, 0x08, 0x00, 0x00, 0x21, 0xF0, 0x82, 0x85, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x11, 0xFC, 0x40, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x60, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x81,
+	0x04, 0x08, 0x20, 0x41, 0x02, 0x08, 0x00, 0x00, 0x00, 0x71, 0x12, 0x24, 0x48, 0x91, 0x22, 0x38,
+	0x00, 0x00, 0x00, 0x06, 0x04, 0x08, 0x10, 0x20, 0x40, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x71, 0x10,
+	0x20, 0x82, 0x08, 0x22, 0x7C, 0x00, 0x00, 0x00, 0x07, 0x11, 0x02, 0x18, 0x08, 0x12, 0x23, 0x80,
+	0x00, 0x00, 0x00, 0x18, 0x50, 0xA2, 0x48, 0x9F, 0x82, 0x0E, 0x00, 0x00, 0x00, 0x07, 0x88, 0x10,
+	0x38, 0x08, 0x12, 0x23, 0x80, 0x00, 0x00, 0x00, 0x38, 0x82, 0x07, 0x88, 0x91, 0x22, 0x38, 0x00,
+	0x00, 0x00, 0x0F, 0x91, 0x02, 0x08, 0x10, 0x20, 0x81, 0x00, 0x00, 0x00, 0x00, 0x71, 0x12, 0x23,
+	0x88, 0x91, 0x22, 0x38, 0x00, 0x00, 0x00, 0x07, 0x11, 0x22, 0x44, 0x78, 0x10, 0x47, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x18,
+	0x00, 0x00, 0xC3, 0x04, 0x00, 0x00, 0x00, 0x00, 0x30, 0x86, 0x10, 0x18, 0x08, 0x0C, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x01, 0x80,
+	0x86, 0x10, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x12, 0x04, 0x10, 0x40, 0x03, 0x00, 0x00, 0x00,
+	0x38, 0x89, 0x12, 0x65, 0x4A, 0x93, 0x20, 0x44, 0x70, 0x00, 0x00, 0x06, 0x04, 0x14, 0x28, 0x51,
+	0xF2, 0x2E, 0xE0, 0x00, 0x00, 0x01, 0xF1, 0x12, 0x27, 0x88, 0x91, 0x22, 0xF8, 0x00, 0x00, 0x00,
+	0x07, 0x91, 0x20, 0x40, 0x81, 0x02, 0x23, 0x80, 0x00, 0x00, 0x01, 0xE1, 0x22, 0x24, 0x48, 0x91,
+	0x24, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0x91, 0x28, 0x70, 0xA1, 0x02, 0x2F, 0xC0, 0x00, 0x00, 0x00,
+	0xFC, 0x89, 0x43, 0x85, 0x08, 0x10, 0x70, 0x00, 0x00, 0x00, 0x07, 0x91, 0x20, 0x40, 0x9D, 0x12,
+	0x23, 0x80, 0x00, 0x00, 0x01, 0xDD, 0x12, 0x27, 0xC8, 0x91, 0x22, 0xEE, 0x00, 0x00, 0x00, 0x0F,
+	0x84, 0x08, 0x10, 0x20, 0x40, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x78, 0x20, 0x40, 0x89, 0x12, 0x24,
+	0x30, 0x00, 0x00, 0x00, 0x1D, 0xD1, 0x24, 0x50, 0xE1, 0x22, 0x2E, 0x60, 0x00, 0x00, 0x00, 0xE0,
+	0x81, 0x02, 0x04, 0x09, 0x12, 0x7C, 0x00, 0x00, 0x00, 0x1D, 0xDB, 0x36, 0x54, 0xA9, 0x12, 0x2E,
+	0xE0, 0x00, 0x00, 0x01, 0xDD, 0x93, 0x25, 0x4A, 0x95, 0x26, 0xEC, 0x00, 0x00, 0x00, 0x07, 0x11,
+	0x22, 0x44, 0x89, 0x12, 0x23, 0x80, 0x00, 0x00, 0x00, 0xF0, 0x91, 0x22, 0x47, 0x08, 0x10, 0x70,
+	0x00, 0x00, 0x00, 0x07, 0x11, 0x22, 0x44, 0x89, 0x12, 0x23, 0x83, 0x80, 0x00, 0x01, 0xF1, 0x12,
+	0x24, 0x4F, 0x12, 0x22, 0xE2, 0x00, 0x00, 0x00, 0x06, 0x93, 0x20, 0x38, 0x08, 0x13, 0x25, 0x80,
+	0x00, 0x00, 0x01, 0xFE, 0x48, 0x81, 0x02, 0x04, 0x08, 0x38, 0x00, 0x00, 0x00, 0x1D, 0xD1, 0x22,
+	0x44, 0x89, 0x12, 0x23, 0x80, 0x00, 0x00, 0x01, 0xDD, 0x12, 0x22, 0x85, 0x0A, 0x08, 0x10, 0x00,
+	0x00, 0x00, 0x1D, 0xD1, 0x22, 0x54, 0xA9, 0x52, 0xA2, 0x80, 0x00, 0x00, 0x01, 0x8D, 0x11, 0x41,
+	0x02, 0x0A, 0x22, 0xC6, 0x00, 0x00, 0x00, 0x1D, 0xD1, 0x14, 0x28, 0x20, 0x40, 0x83, 0x80, 0x00,
+	0x00, 0x00, 0xF9, 0x10, 0x41, 0x02, 0x08, 0x22, 0x7C, 0x00, 0x00, 0x00, 0x07, 0x08, 0x10, 0x20,
+	0x40, 0x81, 0x02, 0x04, 0x0E, 0x00, 0x00, 0x80, 0x81, 0x02, 0x02, 0x04, 0x04, 0x08, 0x10, 0x00,
+	0x00, 0x07, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x0E, 0x00, 0x00, 0x20, 0x41, 0x44, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+	0x00, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x44, 0x79,
+	0x12, 0x23, 0xE0, 0x00, 0x00, 0x01, 0x81, 0x02, 0xC6, 0x48, 0x91, 0x22, 0xF8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1E, 0x44, 0x81, 0x02, 0x23, 0x80, 0x00, 0x00, 0x00, 0x18, 0x11, 0xA4, 0xC8, 0x91,
+	0x22, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x44, 0xF9, 0x02, 0x03, 0xC0, 0x00, 0x00, 0x00,
+	0x38, 0x83, 0xE2, 0x04, 0x08, 0x10, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x4C, 0x89, 0x12,
+	0x23, 0xC0, 0x8E, 0x00, 0x01, 0x81, 0x02, 0xC6, 0x48, 0x91, 0x22, 0xEE, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x38, 0x10, 0x20, 0x40, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x20, 0x03, 0xC0, 0x81, 0x02, 0x04,
+	0x08, 0x11, 0xC0, 0x00, 0x18, 0x10, 0x2E, 0x48, 0xE1, 0x42, 0x4D, 0xC0, 0x00, 0x00, 0x00, 0x60,
+	0x40, 0x81, 0x02, 0x04, 0x08, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x54, 0xA9, 0x52, 0xAF,
+	0xE0, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC6, 0x48, 0x91, 0x22, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1C, 0x44, 0x89, 0x12, 0x23, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0xC6, 0x48, 0x91, 0x22, 0x78,
+	0x83, 0x80, 0x00, 0x00, 0x00, 0x1B, 0x4C, 0x89, 0x12, 0x23, 0xC0, 0x83, 0x80, 0x00, 0x00, 0x03,
+	0x63, 0x04, 0x08, 0x10, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x44, 0x70, 0x12, 0x27, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x83, 0xE2, 0x04, 0x08, 0x11, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+	0x44, 0x89, 0x12, 0x63, 0x60, 0x00, 0x00, 0x00, 0x00, 0x07, 0x74, 0x48, 0x8A, 0x14, 0x10, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x77, 0x44, 0xA9, 0x52, 0xA2, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x64,
+	0x86, 0x0C, 0x24, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x44, 0x48, 0xA0, 0xC1, 0x02, 0x1E,
+	0x00, 0x00, 0x00, 0x03, 0xE4, 0x82, 0x08, 0x22, 0x7C, 0x00, 0x00, 0x00, 0x01, 0x04, 0x08, 0x10,
+	0x20, 0x80, 0x81, 0x02, 0x02, 0x00, 0x00, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00,
+	0x00, 0x04, 0x04, 0x08, 0x10, 0x20, 0x20, 0x81, 0x02, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+#else
+const uint8_t Font12_Packed[] = 
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x40, 0x00, 0x00, 0x70, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x0A, 0xC1, 0xF0, 0x6A, 0xC1, 0xF0, 0x6A, 0x00, 0x00, 0x00, 0x01, 0xB0, 0x25, 0x06, 0x5C,
+	0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x05, 0x40, 0x25, 0x00, 0xA8, 0x09, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x0C, 0x81, 0x28, 0x11, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x06, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x2C, 0x07, 0x00, 0x2C,
+	0x02, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x40, 0x3F, 0x80, 0x40, 0x04, 0x00, 0x40, 0x00, 0x00,
+	0x00, 0x00, 0x60, 0x1C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x04, 0x00, 0x40,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x40, 0x18, 0x06, 0x01, 0x80, 0x60, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x40, 0x84, 0x08, 0x40, 0x83,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x84, 0x08, 0x7F, 0x80, 0x08, 0x00, 0x80, 0x00, 0x00, 0x02, 0x18,
+	0x42, 0x84, 0x48, 0x48, 0x83, 0x18, 0x00, 0x00, 0x00, 0x21, 0x04, 0x08, 0x48, 0x84, 0x88, 0x37,
+	0x00, 0x00, 0x00, 0x00, 0x60, 0x0A, 0x03, 0x20, 0x42, 0x87, 0xF8, 0x02, 0x80, 0x00, 0x01, 0x07,
+	0x88, 0x48, 0x84, 0x88, 0x47, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x28, 0x84, 0x88, 0x48, 0x84, 0x70,
+	0x00, 0x00, 0x00, 0x60, 0x04, 0x00, 0x41, 0x84, 0xE0, 0x70, 0x00, 0x00, 0x00, 0x03, 0x70, 0x48,
+	0x84, 0x88, 0x48, 0x83, 0x70, 0x00, 0x00, 0x00, 0x38, 0x84, 0x48, 0x44, 0x84, 0x50, 0x3E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x19, 0x81, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+	0x19, 0x81, 0x90, 0x00, 0x00, 0x00, 0x04, 0x00, 0xA0, 0x0A, 0x01, 0x10, 0x20, 0x82, 0x08, 0x00,
+	0x00, 0x00, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x20, 0x82, 0x08, 0x11, 0x00,
+	0xA0, 0x0A, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x22, 0x82, 0x40, 0x18, 0x00, 0x00,
+	0x00, 0x07, 0xF8, 0x80, 0x48, 0xC4, 0x92, 0x47, 0xE8, 0x00, 0x00, 0x08, 0x03, 0x85, 0xE8, 0x62,
+	0x01, 0xE8, 0x03, 0x80, 0x08, 0x40, 0x87, 0xF8, 0x48, 0x84, 0x88, 0x48, 0x83, 0x70, 0x00, 0x00,
+	0x00, 0x3F, 0x04, 0x08, 0x40, 0x84, 0x08, 0x61, 0x00, 0x00, 0x40, 0x87, 0xF8, 0x40, 0x84, 0x08,
+	0x21, 0x01, 0xE0, 0x00, 0x04, 0x08, 0x7F, 0x84, 0x88, 0x5C, 0x84, 0x08, 0x61, 0x80, 0x00, 0x00,
+	0x04, 0x08, 0x7F, 0x84, 0x88, 0x5C, 0x04, 0x00, 0x60, 0x00, 0x00, 0x3F, 0x04, 0x08, 0x40, 0x84,
+	0x48, 0x67, 0x00, 0x40, 0x40, 0x87, 0xF8, 0x48, 0x80, 0x80, 0x48, 0x87, 0xF8, 0x40, 0x80, 0x00,
+	0x40, 0x84, 0x08, 0x7F, 0x84, 0x08, 0x40, 0x80, 0x00, 0x00, 0x00, 0x70, 0x40, 0x84, 0x08, 0x7F,
+	0x04, 0x00, 0x00, 0x04, 0x08, 0x7F, 0x84, 0x48, 0x0C, 0x05, 0x20, 0x61, 0x84, 0x08, 0x00, 0x04,
+	0x08, 0x7F, 0x84, 0x08, 0x00, 0x80, 0x38, 0x00, 0x04, 0x08, 0x7F, 0x87, 0x08, 0x0C, 0x07, 0x08,
+	0x7F, 0x84, 0x08, 0x40, 0x87, 0xF8, 0x70, 0x80, 0xE0, 0x41, 0x87, 0xF8, 0x40, 0x00, 0x00, 0x3F,
+	0x04, 0x08, 0x40, 0x84, 0x08, 0x3F, 0x00, 0x00, 0x00, 0x04, 0x08, 0x7F, 0x84, 0x48, 0x44, 0x03,
+	0x80, 0x00, 0x00, 0x00, 0x3F, 0x04, 0x08, 0x40, 0xC4, 0x0C, 0x3F, 0x40, 0x00, 0x40, 0x87, 0xF8,
+	0x44, 0x84, 0x40, 0x46, 0x03, 0x90, 0x00, 0x80, 0x00, 0x31, 0x84, 0x90, 0x48, 0x82, 0x88, 0x67,
+	0x00, 0x00, 0x60, 0x04, 0x00, 0x40, 0x87, 0xF8, 0x40, 0x84, 0x00, 0x60, 0x04, 0x00, 0x7F, 0x04,
+	0x08, 0x00, 0x84, 0x08, 0x7F, 0x04, 0x00, 0x40, 0x07, 0x00, 0x4E, 0x00, 0x18, 0x4E, 0x07, 0x00,
+	0x40, 0x04, 0x00, 0x7F, 0x04, 0x08, 0x0F, 0x04, 0x08, 0x7F, 0x04, 0x00, 0x40, 0x86, 0x18, 0x12,
+	0x00, 0xC0, 0x12, 0x06, 0x18, 0x40, 0x84, 0x00, 0x60, 0x05, 0x88, 0x07, 0x85, 0x88, 0x60, 0x04,
+	0x00, 0x00, 0x06, 0x18, 0x42, 0x84, 0xC8, 0x50, 0x86, 0x18, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE,
+	0x40, 0x24, 0x02, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x38, 0x00, 0x60, 0x01, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x02, 0x40, 0x27, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x10, 0x06,
+	0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01, 0x00, 0x10, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x01, 0x48, 0x14,
+	0x81, 0x48, 0x0F, 0x80, 0x08, 0x40, 0x87, 0xF8, 0x08, 0x81, 0x08, 0x10, 0x80, 0xF0, 0x00, 0x00,
+	0x00, 0x0F, 0x01, 0x08, 0x10, 0x81, 0x08, 0x19, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x10, 0x81, 0x08,
+	0x48, 0x87, 0xF8, 0x00, 0x80, 0x00, 0x0F, 0x01, 0x48, 0x14, 0x81, 0x48, 0x0C, 0x80, 0x00, 0x00,
+	0x01, 0x08, 0x3F, 0x85, 0x08, 0x50, 0x85, 0x08, 0x00, 0x00, 0x00, 0x0F, 0x01, 0x0A, 0x10, 0xA0,
+	0x8A, 0x1F, 0xC1, 0x00, 0x40, 0x87, 0xF8, 0x08, 0x81, 0x00, 0x10, 0x80, 0xF8, 0x00, 0x80, 0x00,
+	0x10, 0x81, 0x08, 0x5F, 0x80, 0x08, 0x00, 0x80, 0x00, 0x00, 0x01, 0x02, 0x10, 0x25, 0x02, 0x1F,
+	0xC0, 0x00, 0x00, 0x04, 0x08, 0x7F, 0x80, 0x40, 0x16, 0x81, 0x98, 0x10, 0x80, 0x00, 0x00, 0x00,
+	0x08, 0x40, 0x87, 0xF8, 0x00, 0x80, 0x08, 0x00, 0x01, 0x08, 0x1F, 0x81, 0x08, 0x0F, 0x81, 0x08,
+	0x0F, 0x80, 0x08, 0x10, 0x81, 0xF8, 0x08, 0x81, 0x00, 0x10, 0x80, 0xF8, 0x00, 0x80, 0x00, 0x0F,
+	0x01, 0x08, 0x10, 0x81, 0x08, 0x0F, 0x00, 0x00, 0x10, 0x21, 0xFE, 0x08, 0xA1, 0x08, 0x10, 0x80,
+	0xF0, 0x00, 0x00, 0x00, 0x0F, 0x01, 0x08, 0x10, 0x80, 0x8A, 0x1F, 0xE1, 0x02, 0x00, 0x01, 0x08,
+	0x1F, 0x80, 0x88, 0x10, 0x81, 0x08, 0x00, 0x00, 0x00, 0x09, 0x81, 0x48, 0x14, 0x81, 0x48, 0x1B,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x3F, 0x01, 0x08, 0x10, 0x81, 0x08, 0x01, 0x01, 0x00, 0x1F, 0x00,
+	0x08, 0x00, 0x81, 0x10, 0x1F, 0x80, 0x08, 0x10, 0x01, 0xC0, 0x13, 0x00, 0x08, 0x13, 0x01, 0xC0,
+	0x10, 0x01, 0x00, 0x1F, 0x01, 0x08, 0x07, 0x01, 0x08, 0x1F, 0x01, 0x00, 0x10, 0x81, 0x98, 0x06,
+	0x00, 0x60, 0x19, 0x81, 0x08, 0x00, 0x01, 0x00, 0x18, 0x21, 0x62, 0x01, 0xE1, 0x32, 0x1C, 0x01,
+	0x00, 0x00, 0x01, 0x98, 0x12, 0x81, 0x48, 0x18, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x3D, 0xC4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x02, 0x3D, 0xC0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00,
+	0x20, 0x02, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+#endif
+
+sFONT Font12 = {
+  NULL,
+  7, /* Width */
+  12, /* Height */
+  NULL,
+  Font12_Packed,
+  NULL,
+};
+
+// 11x16, 176 bits per glyph, 2090 B packed (font16.cpp + font_r270.cpp: 5130 B)
+#if USE_LANDSCAPE_PAINT
+const uint8_t Font16_Packed[] = 
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00,
+	0x60, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77,
+	0x0E, 0xE0, 0x88, 0x11, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0xB0, 0x36, 0x06, 0xC0, 0xD8, 0x7F, 0x86, 0xC1, 0xFE, 0x1B, 0x03, 0x60,
+	0x6C, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0xF0, 0xC6, 0x18, 0xC3, 0x80, 0x3C,
+	0x03, 0xC0, 0x1C, 0x31, 0x86, 0x30, 0xFC, 0x02, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x90, 0x12, 0x01, 0x8C, 0x0F, 0x07, 0x81, 0x8C, 0x02, 0x40, 0x48, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x0C, 0x01, 0x80, 0x30, 0x03, 0x00, 0xEC, 0x37,
+	0x06, 0x60, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0x80,
+	0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x60, 0x0C, 0x03, 0x00, 0xE0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0xC0, 0x18, 0x01,
+	0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x06, 0x00, 0x60, 0x0C, 0x01, 0x80,
+	0x30, 0x06, 0x00, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18,
+	0x1F, 0xE3, 0xFC, 0x1E, 0x07, 0xE0, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x40, 0x08, 0x0F, 0xE0, 0x20, 0x04, 0x00, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x10, 0x06, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0x06, 0x00, 0xC0,
+	0x30, 0x06, 0x01, 0x80, 0x60, 0x0C, 0x03, 0x00, 0x60, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0xC0, 0x6C, 0x18, 0xC3, 0x18, 0x63, 0x0C, 0x61, 0x8C, 0x31, 0x83, 0x60, 0x38, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+	0x30, 0x06, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x66,
+	0x18, 0xC3, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0xE1, 0x86, 0x00, 0xC0, 0x30, 0x3E, 0x00, 0xE0, 0x0C, 0x01, 0x8C, 0x30,
+	0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1C, 0x07, 0x80, 0xB0, 0x36,
+	0x04, 0xC1, 0x98, 0x3F, 0x80, 0x60, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0xF0, 0x60, 0x0C, 0x01, 0x80, 0x3E, 0x04, 0x60, 0x0C, 0x01, 0x84, 0x30, 0x7C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x70, 0x0C, 0x03, 0x00, 0x6E, 0x0E, 0x61, 0x8C, 0x31,
+	0x83, 0x30, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE1, 0x0C, 0x01, 0x80,
+	0x60, 0x0C, 0x01, 0x80, 0x30, 0x0C, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0xE0, 0xC6, 0x18, 0xC3, 0x18, 0x3E, 0x0C, 0x61, 0x8C, 0x31, 0x86, 0x30, 0x7C, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0xCC, 0x18, 0xC3, 0x18, 0x67, 0x07, 0x60,
+	0x0C, 0x03, 0x00, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+	0x10, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x80, 0x40, 0x30,
+	0x18, 0x00, 0xC0, 0x04, 0x00, 0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x0C, 0x00, 0x40, 0x06, 0x00, 0x30, 0x18, 0x04,
+	0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x18, 0xC3,
+	0x18, 0x03, 0x01, 0xC0, 0x60, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0xC0, 0x44, 0x10, 0x82, 0x10, 0x4E, 0x0A, 0x41, 0x48, 0x27, 0x04, 0x00, 0x44, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x80, 0x90, 0x33, 0x06, 0x60,
+	0xFC, 0x30, 0xC6, 0x19, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
+	0x18, 0xC3, 0x18, 0x63, 0x0F, 0xC1, 0x8C, 0x31, 0x86, 0x31, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x18, 0x66, 0x04, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x46, 0x10,
+	0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x18, 0xC3, 0x0C, 0x61,
+	0x8C, 0x31, 0x86, 0x30, 0xC6, 0x31, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0xFE, 0x18, 0x43, 0x08, 0x64, 0x0F, 0x81, 0x90, 0x30, 0x86, 0x11, 0xFE, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x18, 0x23, 0x04, 0x64, 0x0F, 0x81, 0x90, 0x30,
+	0x06, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x18, 0xC6,
+	0x08, 0xC0, 0x18, 0x03, 0x3E, 0x61, 0x86, 0x30, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0xEF, 0x18, 0xC3, 0x18, 0x63, 0x0F, 0xE1, 0x8C, 0x31, 0x86, 0x31, 0xEF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80,
+	0x30, 0x06, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
+	0x01, 0x80, 0x30, 0x06, 0x00, 0xC3, 0x18, 0x63, 0x0C, 0x60, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x18, 0xC3, 0x30, 0x6C, 0x0F, 0x01, 0xF0, 0x33, 0x06, 0x31,
+	0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x0C, 0x01, 0x80, 0x30,
+	0x06, 0x00, 0xC2, 0x18, 0x43, 0x09, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x83, 0xB0, 0x67, 0x1C, 0xF7, 0x9A, 0xB3, 0x76, 0x64, 0xCC, 0x1B, 0xEF, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0x18, 0xC3, 0x98, 0x7B, 0x0D, 0x61, 0xBC, 0x33,
+	0x86, 0x31, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x18, 0xC6,
+	0x0C, 0xC1, 0x98, 0x33, 0x06, 0x60, 0xC6, 0x30, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0xFC, 0x18, 0xC3, 0x18, 0x63, 0x0C, 0x61, 0xF8, 0x30, 0x06, 0x01, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x18, 0xC6, 0x0C, 0xC1, 0x98, 0x33,
+	0x06, 0x60, 0xC6, 0x30, 0x7C, 0x06, 0x61, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC,
+	0x18, 0xC3, 0x18, 0x63, 0x0F, 0x81, 0x98, 0x31, 0x86, 0x31, 0xF3, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x18, 0xC3, 0x18, 0x70, 0x07, 0xC0, 0x1C, 0x31, 0x86, 0x30,
+	0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x26, 0x44, 0xC8, 0x99,
+	0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0xEF, 0x18, 0xC3, 0x18, 0x63, 0x0C, 0x61, 0x8C, 0x31, 0x86, 0x30, 0x7C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x18, 0xC3, 0x18, 0x36, 0x06, 0xC0, 0xD8, 0x0A,
+	0x01, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xB0, 0x66,
+	0x4C, 0xDD, 0x9B, 0xB1, 0x54, 0x3B, 0x87, 0x70, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0xEF, 0x18, 0xC1, 0xB0, 0x1C, 0x03, 0x80, 0x70, 0x1B, 0x06, 0x31, 0xEF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE7, 0x98, 0x61, 0x98, 0x1E, 0x01, 0x80,
+	0x30, 0x06, 0x00, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+	0x10, 0xC2, 0x30, 0x0C, 0x01, 0x00, 0x60, 0x18, 0x86, 0x10, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xF0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0,
+	0x18, 0x03, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x60, 0x0C, 0x00, 0xC0, 0x18,
+	0x01, 0x80, 0x18, 0x03, 0x00, 0x30, 0x06, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x01, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x01, 0x40, 0x28, 0x08, 0x82, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+	0x08, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0x00, 0x60,
+	0xFC, 0x31, 0x86, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xC0,
+	0x18, 0x03, 0x70, 0x73, 0x0C, 0x31, 0x86, 0x30, 0xC7, 0x31, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE8, 0x63, 0x18, 0x23, 0x00, 0x60, 0x86, 0x30,
+	0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x06, 0x00, 0xC1, 0xD8, 0x67,
+	0x18, 0x63, 0x0C, 0x61, 0x86, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0xF0, 0x63, 0x18, 0x33, 0xFE, 0x60, 0x06, 0x18, 0x7E, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x30, 0x06, 0x03, 0xF8, 0x18, 0x03, 0x00, 0x60, 0x0C,
+	0x01, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0xDC, 0x67, 0x18, 0x63, 0x0C, 0x61, 0x86, 0x70, 0x76, 0x00, 0xC0, 0x18, 0x3E, 0x00, 0x00, 0x00,
+	0x00, 0x0E, 0x00, 0xC0, 0x18, 0x03, 0x70, 0x73, 0x0C, 0x61, 0x8C, 0x31, 0x86, 0x31, 0xEF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x01, 0xE0, 0x0C, 0x01, 0x80,
+	0x30, 0x06, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18,
+	0x00, 0x03, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x7C, 0x00,
+	0x00, 0x00, 0x00, 0x0E, 0x00, 0xC0, 0x18, 0x03, 0x78, 0x6C, 0x0F, 0x01, 0xE0, 0x36, 0x06, 0x61,
+	0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+	0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0xF8, 0x6D, 0x8D, 0xB1, 0xB6, 0x36, 0xC6, 0xD9, 0xDB, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x73, 0x0C, 0x61, 0x8C, 0x31,
+	0x86, 0x31, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0xF0, 0x63, 0x18, 0x33, 0x06, 0x60, 0xC6, 0x30, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x73, 0x0C, 0x31, 0x86, 0x30, 0xC7, 0x30, 0xDC, 0x18,
+	0x03, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDC, 0x67, 0x18, 0x63,
+	0x0C, 0x61, 0x86, 0x70, 0x76, 0x00, 0xC0, 0x18, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x07, 0xB8, 0x39, 0x86, 0x00, 0xC0, 0x18, 0x03, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x63, 0x0F, 0x00, 0xF8, 0x03, 0x86, 0x30,
+	0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x60, 0x0C, 0x07, 0xF0, 0x30,
+	0x06, 0x00, 0xC0, 0x18, 0x03, 0x10, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x38, 0x63, 0x0C, 0x61, 0x8C, 0x31, 0x86, 0x70, 0x77, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xBC, 0x63, 0x0C, 0x60, 0xD8, 0x1B,
+	0x01, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
+	0x1E, 0xC1, 0x99, 0x33, 0x76, 0x3B, 0x87, 0x70, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xBC, 0x36, 0x03, 0x80, 0x70, 0x0E, 0x03, 0x61, 0xEF, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9E, 0x61, 0x86, 0x60,
+	0xCC, 0x0B, 0x01, 0xE0, 0x18, 0x03, 0x00, 0xC0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0xF8, 0x43, 0x00, 0xC0, 0x70, 0x18, 0x06, 0x10, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0xC0, 0x0C, 0x01, 0x80,
+	0x30, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C,
+	0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x80, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x18, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0xC0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x09, 0x20, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+#else
+const uint8_t Font16_Packed[] = 
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xA0,
+	0x7F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x30, 0x00, 0x3E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x3E, 0x00, 0x30, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0xF0, 0x7F, 0xF0, 0x7D, 0x00, 0x07, 0xF0,
+	0x7F, 0xF0, 0x7D, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xE0, 0x7C, 0xE0,
+	0x4E, 0x20, 0xC6, 0x38, 0x47, 0x20, 0x73, 0xE0, 0x71, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x31, 0x00, 0x4B, 0x00, 0x4A, 0x00, 0x36, 0x00, 0x06, 0xC0, 0x05, 0x20, 0x0D, 0x20,
+	0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1D, 0xE0, 0x3F, 0x20, 0x23, 0xA0,
+	0x20, 0xC0, 0x21, 0xE0, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x3E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x78, 0x78, 0x60, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x70, 0x38,
+	0x1F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x1F, 0x00, 0x1B, 0x00, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x1F, 0xC0, 0x02, 0x00,
+	0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1C, 0x00, 0x70, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x00, 0x78, 0x01, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xC0, 0x60, 0x60, 0x40, 0x20, 0x60, 0x60, 0x3F, 0xC0,
+	0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x60, 0x38, 0xE0, 0x61, 0xA0, 0x43, 0x20, 0x46, 0x20, 0x7C, 0x20, 0x38, 0x20, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x60, 0x60, 0x44, 0x20, 0x44, 0x20, 0x44, 0x20, 0x4E, 0x20,
+	0x7F, 0xE0, 0x33, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x07, 0x80,
+	0x1C, 0xA0, 0x70, 0xA0, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x40, 0x7E, 0x20, 0x7C, 0x20, 0x44, 0x20, 0x44, 0x20, 0x47, 0xE0, 0x43, 0xC0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0xC0, 0x32, 0x60, 0x64, 0x20,
+	0x44, 0x20, 0x47, 0xE0, 0x43, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x40, 0x00,
+	0x40, 0x00, 0x40, 0xE0, 0x4F, 0xE0, 0x7F, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3B, 0xC0, 0x7F, 0xE0, 0x44, 0x20, 0x44, 0x20, 0x44, 0x20, 0x7F, 0xE0,
+	0x3B, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x20, 0x7E, 0x20, 0x42, 0x20,
+	0x42, 0x60, 0x64, 0xC0, 0x3F, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0C, 0x60, 0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x60, 0x0C, 0x40,
+	0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x05, 0x00,
+	0x05, 0x00, 0x08, 0x80, 0x10, 0x40, 0x10, 0x40, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x10, 0x40, 0x10, 0x40, 0x08, 0x80,
+	0x05, 0x00, 0x05, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+	0x38, 0x00, 0x21, 0xA0, 0x23, 0xA0, 0x22, 0x00, 0x3E, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x20, 0x20, 0x43, 0x10, 0x44, 0x90, 0x44, 0x90, 0x3F, 0xA0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0xE0, 0x27, 0xE0, 0x3F, 0x20,
+	0x31, 0x00, 0x31, 0x00, 0x3F, 0x20, 0x07, 0xE0, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x20, 0x20,
+	0x3F, 0xE0, 0x3F, 0xE0, 0x22, 0x20, 0x22, 0x20, 0x22, 0x20, 0x3F, 0xE0, 0x1D, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x30, 0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x10, 0x40, 0x38, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x60, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x22, 0x20, 0x22, 0x20, 0x27, 0x20, 0x20, 0x20, 0x38, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x22, 0x20, 0x22, 0x20,
+	0x27, 0x00, 0x20, 0x00, 0x20, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0,
+	0x30, 0x60, 0x20, 0x20, 0x21, 0x20, 0x21, 0x20, 0x11, 0xE0, 0x39, 0xC0, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x22, 0x20, 0x02, 0x00, 0x22, 0x20, 0x3F, 0xE0,
+	0x3F, 0xE0, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x3F, 0xE0, 0x3F, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0,
+	0x01, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xC0, 0x20, 0x00, 0x20, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x23, 0x20, 0x07, 0x00, 0x2D, 0x80,
+	0x38, 0xE0, 0x30, 0x60, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x3F, 0xE0,
+	0x3F, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x20, 0x01, 0xE0, 0x00, 0x00, 0x20, 0x20,
+	0x3F, 0xE0, 0x3F, 0xE0, 0x0C, 0x20, 0x07, 0x20, 0x01, 0x80, 0x07, 0x20, 0x0C, 0x20, 0x3F, 0xE0,
+	0x3F, 0xE0, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x0C, 0x20, 0x07, 0x00,
+	0x21, 0x80, 0x3F, 0xE0, 0x3F, 0xE0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0,
+	0x30, 0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x60, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x21, 0x20, 0x21, 0x20, 0x21, 0x20, 0x3F, 0x00,
+	0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x30, 0x68, 0x20, 0x38,
+	0x20, 0x38, 0x20, 0x28, 0x30, 0x68, 0x1F, 0xD8, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+	0x3F, 0xE0, 0x3F, 0xE0, 0x22, 0x20, 0x22, 0x20, 0x23, 0x00, 0x3D, 0xC0, 0x1C, 0xE0, 0x00, 0x20,
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xE0, 0x3E, 0xE0, 0x26, 0x20, 0x22, 0x20, 0x23, 0x20,
+	0x3B, 0xE0, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x20, 0x20, 0x20, 0x20,
+	0x3F, 0xE0, 0x3F, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xC0,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x38, 0x00, 0x3F, 0x00, 0x27, 0xE0, 0x00, 0x60,
+	0x27, 0xE0, 0x3F, 0x00, 0x38, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x3E, 0x00, 0x3F, 0xE0,
+	0x20, 0xE0, 0x27, 0xC0, 0x0E, 0x00, 0x27, 0xC0, 0x20, 0xE0, 0x3F, 0xE0, 0x3E, 0x00, 0x20, 0x00,
+	0x00, 0x00, 0x20, 0x20, 0x30, 0x60, 0x38, 0xE0, 0x2F, 0xA0, 0x07, 0x00, 0x2F, 0xA0, 0x38, 0xE0,
+	0x30, 0x60, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x30, 0x00, 0x38, 0x20, 0x2C, 0x20,
+	0x07, 0xE0, 0x07, 0xE0, 0x2C, 0x20, 0x38, 0x20, 0x30, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x38, 0x60, 0x20, 0xE0, 0x21, 0xA0, 0x27, 0x20, 0x2C, 0x20, 0x38, 0x20, 0x30, 0xE0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xF8,
+	0x40, 0x08, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xF0, 0x00,
+	0x3C, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x40, 0x08, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x60, 0x00, 0x80, 0x00,
+	0x60, 0x00, 0x10, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+	0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x09, 0xE0, 0x09, 0x20,
+	0x09, 0x20, 0x09, 0x40, 0x0F, 0xE0, 0x07, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20,
+	0x7F, 0xE0, 0x7F, 0xE0, 0x04, 0x40, 0x08, 0x20, 0x08, 0x20, 0x0C, 0x60, 0x07, 0xC0, 0x03, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x0C, 0x60, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20,
+	0x04, 0x60, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x0C, 0x60,
+	0x08, 0x20, 0x08, 0x20, 0x44, 0x40, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x80, 0x07, 0xC0, 0x0D, 0x60, 0x09, 0x20, 0x09, 0x20, 0x09, 0x20, 0x0D, 0x20, 0x07, 0x60,
+	0x03, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x08, 0x20, 0x3F, 0xE0, 0x7F, 0xE0,
+	0x48, 0x20, 0x48, 0x20, 0x48, 0x20, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0xC0,
+	0x0C, 0x64, 0x08, 0x24, 0x08, 0x24, 0x04, 0x44, 0x0F, 0xFC, 0x0F, 0xF8, 0x08, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x40, 0x20, 0x7F, 0xE0, 0x7F, 0xE0, 0x04, 0x20, 0x08, 0x00, 0x08, 0x20, 0x0F, 0xE0,
+	0x07, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20,
+	0x6F, 0xE0, 0x6F, 0xE0, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x68, 0x04, 0x6F, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x7F, 0xE0, 0x7F, 0xE0, 0x03, 0x00, 0x0F, 0xA0, 0x0C, 0xE0,
+	0x08, 0x60, 0x08, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x20,
+	0x40, 0x20, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x20, 0x0F, 0xE0, 0x0F, 0xE0, 0x08, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x08, 0x00, 0x0F, 0xE0,
+	0x07, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x08, 0x20, 0x0F, 0xE0, 0x0F, 0xE0, 0x04, 0x20, 0x08, 0x00,
+	0x08, 0x20, 0x0F, 0xE0, 0x07, 0xE0, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0xC0,
+	0x0C, 0x60, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x0C, 0x60, 0x07, 0xC0, 0x03, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x04, 0x0F, 0xFC, 0x0F, 0xFC, 0x04, 0x44, 0x08, 0x24, 0x08, 0x20, 0x0C, 0x60,
+	0x07, 0xC0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x0C, 0x60, 0x08, 0x20,
+	0x08, 0x24, 0x04, 0x44, 0x0F, 0xFC, 0x0F, 0xFC, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x08, 0x20,
+	0x08, 0x20, 0x0F, 0xE0, 0x0F, 0xE0, 0x04, 0x20, 0x08, 0x20, 0x08, 0x20, 0x0C, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x0F, 0x60, 0x0B, 0x20, 0x0B, 0x20, 0x09, 0xA0,
+	0x0D, 0xE0, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x7F, 0xC0,
+	0x7F, 0xE0, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x00, 0x20, 0x00, 0x20, 0x08, 0x40, 0x0F, 0xE0, 0x0F, 0xE0,
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0E, 0x00, 0x0F, 0x80, 0x09, 0xE0, 0x00, 0x60,
+	0x09, 0xE0, 0x0F, 0x80, 0x0E, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0F, 0x00, 0x0F, 0xE0,
+	0x08, 0xE0, 0x01, 0xC0, 0x03, 0x00, 0x01, 0xC0, 0x08, 0xE0, 0x0F, 0xE0, 0x0F, 0x00, 0x08, 0x00,
+	0x00, 0x00, 0x08, 0x20, 0x08, 0x20, 0x0C, 0x60, 0x0F, 0xE0, 0x03, 0x80, 0x0F, 0xE0, 0x0C, 0x60,
+	0x08, 0x20, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0C, 0x04, 0x0F, 0x04, 0x0B, 0xCC,
+	0x00, 0x7C, 0x00, 0xF4, 0x0B, 0xC0, 0x0F, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0C, 0x60, 0x08, 0xE0, 0x09, 0xA0, 0x09, 0x20, 0x0B, 0x20, 0x0E, 0x20, 0x0C, 0x60, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3F, 0xF0, 0x7E, 0xF8, 0x40, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x7E, 0xF8, 0x3F, 0xF0, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00,
+	0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+#endif
+
+sFONT Font16 = {
+  NULL,
+  11, /* Width */
+  16, /* Height */
+  NULL,
+  Font16_Packed,
+  NULL,
+};
+
+// 14x20, 280 bits per glyph, 3325 B packed (font20.cpp + font_r270.cpp: 7790 B)
+#if USE_LANDSCAPE_PAINT
+const uint8_t Font20_Packed[] = 
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01,
+	0xC0, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCE, 0x07, 0x38, 0x1C, 0xE0, 0x21,
+	0x00, 0x84, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xC0, 0x33, 0x00, 0xCC, 0x03, 0x30,
+	0x0C, 0xC0, 0xFF, 0xC3, 0xFF, 0x03, 0x30, 0x0C, 0xC0, 0xFF, 0xC3, 0xFF, 0x03, 0x30, 0x0C, 0xC0,
+	0x33, 0x00, 0xCC, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00,
+	0x7E, 0x03, 0xF8, 0x18, 0x60, 0x60, 0x01, 0xF0, 0x03, 0xF0, 0x00, 0xE0, 0x61, 0x81, 0x86, 0x07,
+	0xF0, 0x1F, 0x80, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0x02, 0x20, 0x08, 0x80, 0x22, 0x00, 0x71, 0x80, 0x1E, 0x03, 0xE0, 0x3C, 0x00, 0xC7,
+	0x00, 0x22, 0x00, 0x88, 0x02, 0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0xE0, 0x30, 0x00, 0xC0, 0x01, 0x80,
+	0x0F, 0x30, 0x7F, 0xC1, 0x9E, 0x06, 0x30, 0x1F, 0xF0, 0x1E, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x04, 0x00,
+	0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x60, 0x01,
+	0x80, 0x06, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x01, 0x80, 0x06,
+	0x00, 0x18, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xC0,
+	0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+	0x06, 0x00, 0x18, 0x00, 0x60, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0C, 0x00, 0x30, 0x00, 0xC0, 0x1B, 0x60, 0x7F, 0x80, 0x78, 0x01, 0xE0, 0x0F, 0xC0, 0x33, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x0F, 0xFC, 0x3F,
+	0xF0, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x0C, 0x00, 0x60, 0x01, 0x80,
+	0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03,
+	0x80, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01,
+	0x80, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x06, 0x00, 0x18, 0x00, 0xC0, 0x03, 0x00, 0x18, 0x00, 0x60,
+	0x03, 0x00, 0x0C, 0x00, 0x30, 0x01, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x3E, 0x01, 0xFC, 0x06, 0x30, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60,
+	0xC1, 0x83, 0x06, 0x06, 0x30, 0x1F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x01, 0xF0, 0x07, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00,
+	0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xFC, 0x0E, 0x38, 0x30, 0x60, 0x01,
+	0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x03, 0xFC, 0x0C, 0x38,
+	0x00, 0x60, 0x03, 0x80, 0x7C, 0x01, 0xF0, 0x00, 0xE0, 0x01, 0x80, 0x06, 0x18, 0x38, 0x7F, 0xC0,
+	0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+	0x3C, 0x00, 0xF0, 0x06, 0xC0, 0x33, 0x00, 0xCC, 0x06, 0x30, 0x30, 0xC0, 0xFF, 0x83, 0xFE, 0x00,
+	0x30, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x7F, 0x01, 0xFC, 0x06, 0x00, 0x18, 0x00, 0x7E, 0x01, 0xFC, 0x06, 0x38, 0x00, 0x60, 0x01,
+	0x80, 0x06, 0x0C, 0x38, 0x3F, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0xFE, 0x07, 0x80, 0x18, 0x00, 0xE0, 0x03, 0x78, 0x0F, 0xF0,
+	0x38, 0xE0, 0xC1, 0x83, 0x06, 0x06, 0x38, 0x1F, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x83, 0xFE, 0x0C, 0x18, 0x00, 0x60, 0x03, 0x00,
+	0x0C, 0x00, 0x30, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x01, 0xFC, 0x0E, 0x38, 0x30,
+	0x60, 0xE3, 0x81, 0xFC, 0x07, 0xF0, 0x38, 0xE0, 0xC1, 0x83, 0x06, 0x0E, 0x38, 0x1F, 0xC0, 0x3E,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x01, 0xFC,
+	0x0E, 0x30, 0x30, 0x60, 0xC1, 0x83, 0x8E, 0x07, 0xF8, 0x0F, 0x60, 0x03, 0x80, 0x0C, 0x00, 0xF0,
+	0x3F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x18, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xF0, 0x0F, 0x00, 0x70,
+	0x07, 0x00, 0x78, 0x00, 0x70, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C,
+	0x00, 0x3C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x78, 0x03, 0x80, 0x38, 0x03, 0xC0, 0x3C,
+	0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xF8, 0x07, 0xF0, 0x18, 0x60, 0x61, 0x80, 0x06, 0x00, 0x70, 0x03, 0x80, 0x0C, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0E, 0x00, 0xC8, 0x02, 0x10, 0x10, 0x40, 0x41, 0x01, 0x1C, 0x04, 0x90, 0x12, 0x40,
+	0x49, 0x01, 0x1C, 0x04, 0x00, 0x08, 0x00, 0x21, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x03, 0x80, 0x1B, 0x00, 0x6C, 0x03,
+	0x30, 0x0C, 0x60, 0x7F, 0x81, 0xFE, 0x0C, 0x0C, 0x78, 0x79, 0xE1, 0xE0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x18, 0x60, 0x61,
+	0x81, 0x8E, 0x07, 0xF0, 0x1F, 0xE0, 0x61, 0xC1, 0x83, 0x06, 0x0C, 0x3F, 0xF0, 0xFF, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x03, 0xFC,
+	0x1C, 0x70, 0xE0, 0xC3, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x83, 0x07, 0x1C, 0x0F, 0xE0,
+	0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0xF8, 0x1F, 0xF0, 0x30, 0xE0, 0xC1, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x07, 0x0C,
+	0x38, 0x7F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x18, 0x30, 0x60, 0xC1, 0x98, 0x07, 0xE0, 0x1F, 0x80, 0x66,
+	0x01, 0x83, 0x06, 0x0C, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x18, 0x30, 0x60, 0xC1, 0x98, 0x07, 0xE0,
+	0x1F, 0x80, 0x66, 0x01, 0x80, 0x06, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x07, 0xFC, 0x18, 0x70, 0xC0, 0xC3,
+	0x00, 0x0C, 0x00, 0x31, 0xF8, 0xC7, 0xE3, 0x03, 0x06, 0x0C, 0x1F, 0xF0, 0x1F, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF, 0x0F, 0x3C, 0x18,
+	0x60, 0x61, 0x81, 0x86, 0x07, 0xF8, 0x1F, 0xE0, 0x61, 0x81, 0x86, 0x06, 0x18, 0x3C, 0xF0, 0xF3,
+	0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE,
+	0x07, 0xF8, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+	0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x30, 0x60, 0xC1, 0x83,
+	0x06, 0x0C, 0x38, 0x3F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0x8F, 0xBE, 0x18, 0xE0, 0x66, 0x01, 0xB0, 0x07, 0xC0, 0x1D,
+	0x80, 0x63, 0x01, 0x8C, 0x06, 0x18, 0x3E, 0x78, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+	0x03, 0x00, 0x0C, 0x00, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x87, 0x9E, 0x1E, 0x38, 0x70,
+	0xF3, 0xC3, 0x4B, 0x0D, 0xEC, 0x37, 0xB0, 0xCC, 0xC3, 0x33, 0x0C, 0x0C, 0x7C, 0xF9, 0xF3, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9F, 0x0F,
+	0x7C, 0x1C, 0x60, 0x79, 0x81, 0xE6, 0x06, 0xD8, 0x1B, 0x60, 0x67, 0x81, 0x9E, 0x06, 0x38, 0x3E,
+	0xE0, 0xF9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x78, 0x03, 0xF0, 0x1C, 0xE0, 0xE1, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x87,
+	0x07, 0x38, 0x0F, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x18, 0x70, 0x60, 0xC1, 0x83, 0x06, 0x1C, 0x1F, 0xE0,
+	0x7F, 0x01, 0x80, 0x06, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xF0, 0x1C, 0xE0, 0xE1, 0xC3, 0x03, 0x0C,
+	0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x87, 0x07, 0x38, 0x0F, 0xC0, 0x1E, 0x00, 0x7B, 0x03, 0xFC, 0x0C,
+	0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x18, 0x70, 0x60,
+	0xC1, 0x87, 0x07, 0xF8, 0x1F, 0xC0, 0x63, 0x81, 0x86, 0x06, 0x1C, 0x3E, 0x38, 0xF8, 0x60, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x07, 0xFC,
+	0x38, 0x70, 0xC0, 0xC3, 0x80, 0x07, 0xE0, 0x07, 0xE0, 0x01, 0xC3, 0x03, 0x0E, 0x1C, 0x3F, 0xE0,
+	0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0xFF, 0x0F, 0xFC, 0x33, 0x30, 0xCC, 0xC3, 0x33, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00,
+	0xC0, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0xCF, 0x0F, 0x3C, 0x18, 0x60, 0x61, 0x81, 0x86, 0x06, 0x18, 0x18, 0x60, 0x61,
+	0x81, 0x86, 0x07, 0x38, 0x0F, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8F, 0x1E, 0x3C, 0x30, 0x60, 0xC1, 0x81, 0x8C, 0x06, 0x30,
+	0x0D, 0x80, 0x36, 0x00, 0xD8, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC7, 0xDF, 0x1F, 0x30, 0x18, 0xCE, 0x63,
+	0x39, 0x8C, 0xE6, 0x36, 0xD8, 0x5B, 0x41, 0xC7, 0x07, 0x1C, 0x1C, 0x70, 0x60, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8F, 0x1E, 0x3C, 0x30,
+	0x60, 0x63, 0x00, 0xD8, 0x01, 0xC0, 0x07, 0x00, 0x36, 0x01, 0x8C, 0x0C, 0x18, 0x78, 0xF1, 0xE3,
+	0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF,
+	0x0F, 0x3C, 0x18, 0x60, 0x33, 0x00, 0x78, 0x01, 0xE0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+	0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0xFE, 0x07, 0xF8, 0x18, 0x60, 0x63, 0x00, 0x18, 0x00, 0xC0, 0x03, 0x00, 0x18, 0x00,
+	0xC6, 0x06, 0x18, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03,
+	0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xF0, 0x03, 0xC0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x60, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x60,
+	0x00, 0xC0, 0x03, 0x00, 0x06, 0x00, 0x18, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x06, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x03, 0x00,
+	0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00,
+	0x30, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x70, 0x03,
+	0x60, 0x18, 0xC0, 0xC1, 0x82, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x10, 0x00, 0x30, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xFE, 0x00,
+	0x18, 0x0F, 0xE0, 0x7F, 0x83, 0x86, 0x0C, 0x38, 0x3F, 0xF0, 0x7D, 0xC0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x07, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xDE,
+	0x03, 0xFE, 0x0E, 0x18, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0E, 0x18, 0x7F, 0xE1, 0xDE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1E, 0xC1, 0xFF, 0x06, 0x0C, 0x30, 0x30, 0xC0, 0x03, 0x00, 0x0E, 0x0C, 0x1F, 0xF0,
+	0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0,
+	0x07, 0x00, 0x0C, 0x00, 0x30, 0x1E, 0xC1, 0xFF, 0x06, 0x1C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0E,
+	0x1C, 0x1F, 0xF8, 0x1E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x01, 0xFE, 0x06, 0x18, 0x3F, 0xF0, 0xFF,
+	0xC3, 0x00, 0x06, 0x0C, 0x1F, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x01, 0x80, 0x06, 0x00, 0x7F, 0x81, 0xFE, 0x01, 0x80,
+	0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xE1,
+	0xFF, 0x86, 0x1C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x06, 0x1C, 0x1F, 0xF0, 0x1E, 0xC0, 0x03, 0x00,
+	0x1C, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x80, 0x06, 0x00, 0x18,
+	0x00, 0x6F, 0x01, 0xFE, 0x07, 0x18, 0x18, 0x60, 0x61, 0x81, 0x86, 0x06, 0x18, 0x3C, 0xF0, 0xF3,
+	0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x30,
+	0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+	0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0C, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00,
+	0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x70, 0x3F, 0x80, 0xFC, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xE0, 0x03, 0x80, 0x06, 0x00, 0x18, 0x00, 0x6F, 0x81, 0xBE, 0x06, 0xC0, 0x1E,
+	0x00, 0x78, 0x01, 0xB0, 0x06, 0x60, 0x39, 0xF0, 0xE7, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30,
+	0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0xFB, 0x87, 0xFF, 0x0C, 0xCC, 0x33, 0x30, 0xCC, 0xC3, 0x33, 0x0C, 0xCC, 0x7B, 0xB9, 0xEE, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xEF, 0x03, 0xFE, 0x07, 0x18, 0x18, 0x60, 0x61, 0x81, 0x86, 0x06, 0x18, 0x3C,
+	0xF0, 0xF3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x01, 0xFE, 0x06, 0x18, 0x30, 0x30, 0xC0, 0xC3, 0x03,
+	0x06, 0x18, 0x1F, 0xE0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDE, 0x07, 0xFE, 0x0E, 0x18, 0x30, 0x30,
+	0xC0, 0xC3, 0x03, 0x0E, 0x18, 0x3F, 0xE0, 0xDE, 0x03, 0x00, 0x0C, 0x00, 0x7C, 0x01, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xE1, 0xFF, 0x86,
+	0x1C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x06, 0x1C, 0x1F, 0xF0, 0x1E, 0xC0, 0x03, 0x00, 0x0C, 0x00,
+	0xF8, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3,
+	0x83, 0xDF, 0x03, 0xCC, 0x0E, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1F, 0x81, 0xFE, 0x06, 0x18, 0x1E, 0x00, 0x3F, 0x00, 0x1E, 0x06, 0x18, 0x1F, 0xE0,
+	0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xC0, 0x03, 0x00, 0x0C, 0x00, 0xFF, 0x83, 0xFE, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03,
+	0x0C, 0x0F, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x83, 0x8E, 0x06, 0x18, 0x18, 0x60, 0x61,
+	0x81, 0x86, 0x06, 0x38, 0x1F, 0xF0, 0x3D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE3, 0xC7, 0x8F, 0x0C, 0x18,
+	0x18, 0xC0, 0x63, 0x00, 0xD8, 0x03, 0x60, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE3, 0xC7,
+	0x8F, 0x0C, 0x98, 0x32, 0x60, 0xDF, 0x81, 0xDC, 0x07, 0x70, 0x18, 0xC0, 0x63, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xF3, 0xC3, 0xCF, 0x03, 0x30, 0x07, 0x80, 0x0C, 0x00, 0x78, 0x03, 0x30, 0x3C, 0xF0, 0xF3,
+	0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0xE3, 0xC7, 0x8F, 0x0C, 0x18, 0x18, 0xC0, 0x63, 0x00, 0xD8, 0x03, 0xE0,
+	0x07, 0x00, 0x18, 0x00, 0x60, 0x03, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0x06, 0x30, 0x01, 0x80, 0x0C, 0x00,
+	0x60, 0x03, 0x18, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x3C, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x07,
+	0x00, 0x38, 0x00, 0x70, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xF0, 0x01, 0xC0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30,
+	0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x01, 0xE0, 0x01, 0x80, 0x06, 0x00,
+	0x18, 0x00, 0x60, 0x01, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x70, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00,
+	0x60, 0x07, 0x80, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0xCC, 0x33, 0xF0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00,
+};
+#else
+const uint8_t Font20_Packed[] = 
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	0xF0, 0xC0, 0x7F, 0xCC, 0x07, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
+	0x3F, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF0, 0x00, 0x38,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60,
+	0x00, 0x66, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x06, 0x60, 0x00, 0x66, 0x00, 0xFF, 0xFF, 0x0F,
+	0xFF, 0xF0, 0x06, 0x60, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xE7, 0x80, 0x1F, 0x78, 0x03, 0x31, 0x80, 0xF3, 0x1F, 0x0F, 0x31, 0xF0,
+	0x31, 0x98, 0x03, 0x9F, 0x00, 0x38, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x38, 0xC0, 0x04, 0x4C, 0x00, 0x45, 0x80, 0x04, 0x58, 0x00, 0x39, 0x38,
+	0x00, 0x34, 0x40, 0x03, 0x44, 0x00, 0x64, 0x40, 0x06, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x0E, 0xF8, 0x00, 0xFC,
+	0xC0, 0x19, 0xCC, 0x01, 0x8E, 0xC0, 0x18, 0x7C, 0x01, 0x87, 0x80, 0x18, 0xEC, 0x00, 0x0C, 0xC0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x03, 0xF0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xFF, 0xE0, 0x7C, 0x0F, 0x86, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0x87, 0xC0, 0xF8, 0x1F, 0xFE, 0x00, 0x3F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x7C, 0x00, 0x7F, 0x80, 0x07,
+	0xF8, 0x00, 0x07, 0xC0, 0x00, 0xCC, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x18, 0x00, 0x01, 0x80, 0x00, 0x18, 0x00,
+	0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x01, 0x80, 0x00, 0x18, 0x00, 0x01, 0x80, 0x00, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x38, 0x00, 0x1F, 0x00, 0x01, 0xC0, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x18,
+	0x00, 0x01, 0x80, 0x00, 0x18, 0x00, 0x01, 0x80, 0x00, 0x18, 0x00, 0x01, 0x80, 0x00, 0x18, 0x00,
+	0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x01, 0xC0, 0x00, 0x1C,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0x78,
+	0x00, 0x3E, 0x00, 0x0F, 0x80, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x03, 0xFF, 0x80, 0x70, 0x1C, 0x06, 0x00, 0xC0, 0x60,
+	0x0C, 0x06, 0x00, 0xC0, 0x70, 0x1C, 0x03, 0xFF, 0x80, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+	0x00, 0xC0, 0x7F, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0x00, 0x0C, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x03, 0x81, 0xC0,
+	0x70, 0x3C, 0x06, 0x06, 0xC0, 0x60, 0xCC, 0x06, 0x18, 0xC0, 0x73, 0x0C, 0x03, 0xE0, 0xC0, 0x1C,
+	0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x30, 0x1C,
+	0x03, 0x00, 0xC0, 0x60, 0x0C, 0x06, 0x30, 0xC0, 0x63, 0x0C, 0x06, 0x30, 0xC0, 0x77, 0x9C, 0x03,
+	0xFF, 0x80, 0x1C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xE0, 0x00, 0x1E, 0x00, 0x07, 0x60, 0x00, 0xE6, 0x00, 0x38, 0x6C, 0x07, 0x06, 0xC0,
+	0x7F, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x07, 0xF1, 0xC0, 0x7F, 0x0C, 0x06, 0x60, 0xC0, 0x66, 0x0C,
+	0x06, 0x60, 0xC0, 0x67, 0x1C, 0x06, 0x3F, 0x80, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x01, 0xFF, 0x80, 0x3D, 0x98, 0x03, 0x30,
+	0xC0, 0x73, 0x0C, 0x06, 0x30, 0xC0, 0x63, 0x9C, 0x06, 0x1F, 0x80, 0x60, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x60,
+	0x00, 0x06, 0x00, 0x00, 0x60, 0x1C, 0x06, 0x0F, 0xC0, 0x67, 0xE0, 0x07, 0xF0, 0x00, 0x78, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF0, 0x03,
+	0xFF, 0x80, 0x77, 0x9C, 0x06, 0x30, 0xC0, 0x63, 0x0C, 0x06, 0x30, 0xC0, 0x77, 0x9C, 0x03, 0xFF,
+	0x80, 0x1C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1E, 0x0C, 0x03, 0xF0, 0xC0, 0x73, 0x8C, 0x06, 0x18, 0xC0, 0x61, 0x9C, 0x06, 0x19, 0x80, 0x33,
+	0x78, 0x03, 0xFF, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1C, 0x00,
+	0x71, 0xC0, 0x07, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+	0x00, 0x1E, 0x00, 0x71, 0x80, 0x07, 0x10, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x80, 0x00, 0x1C, 0x00, 0x01, 0xC0,
+	0x00, 0x36, 0x00, 0x06, 0x30, 0x00, 0x63, 0x00, 0x0C, 0x18, 0x00, 0xC1, 0x80, 0x18, 0x0C, 0x01,
+	0x80, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 0x06, 0x60, 0x00, 0x66,
+	0x00, 0x06, 0x60, 0x00, 0x66, 0x00, 0x06, 0x60, 0x00, 0x66, 0x00, 0x06, 0x60, 0x00, 0x66, 0x00,
+	0x06, 0x60, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x0C, 0x01, 0x80, 0xC0, 0x0C, 0x18, 0x00, 0xC1, 0x80, 0x06, 0x30, 0x00, 0x63, 0x00, 0x03, 0x60,
+	0x00, 0x1C, 0x00, 0x01, 0xC0, 0x00, 0x08, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x3C, 0x00, 0x03, 0x00, 0xC0, 0x30, 0xCC, 0x03, 0x1C,
+	0xC0, 0x31, 0x80, 0x01, 0xF0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x30, 0x0C, 0x02, 0x00, 0x20, 0x41,
+	0xC2, 0x04, 0x22, 0x20, 0x62, 0x22, 0x01, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x1C, 0x03, 0x07, 0xC0, 0x31, 0xEC, 0x03,
+	0x7E, 0x00, 0x3E, 0x60, 0x03, 0x86, 0x00, 0x3F, 0x60, 0x00, 0x7E, 0xC0, 0x00, 0xFC, 0x00, 0x01,
+	0xC0, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x03, 0xFF, 0xC0,
+	0x3F, 0xFC, 0x03, 0x18, 0xC0, 0x31, 0x8C, 0x03, 0x18, 0xC0, 0x33, 0x8C, 0x01, 0xFC, 0xC0, 0x0E,
+	0xFC, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0,
+	0x00, 0xFF, 0x00, 0x1C, 0x38, 0x03, 0x81, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x01,
+	0x81, 0xC0, 0x3C, 0x38, 0x03, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0xC0, 0x3F, 0xFC, 0x03, 0xFF, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0,
+	0x38, 0x1C, 0x01, 0xC3, 0x80, 0x0F, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x03, 0x18, 0xC0, 0x31, 0x8C,
+	0x03, 0x3C, 0xC0, 0x33, 0xCC, 0x03, 0x00, 0xC0, 0x3C, 0x3C, 0x03, 0xC3, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x03, 0x18,
+	0xC0, 0x31, 0x8C, 0x03, 0x3C, 0xC0, 0x33, 0xC0, 0x03, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xC0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x01, 0xFF, 0x80, 0x18,
+	0x18, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x0C, 0xC0, 0x30, 0xCC, 0x01, 0x8C, 0xC0, 0x3C, 0xF8,
+	0x03, 0xCF, 0x80, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x03,
+	0xFF, 0xC0, 0x3F, 0xFC, 0x03, 0x18, 0xC0, 0x01, 0x80, 0x00, 0x18, 0x00, 0x31, 0x8C, 0x03, 0xFF,
+	0xC0, 0x3F, 0xFC, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x3F, 0xFC, 0x03, 0xFF, 0xC0, 0x30,
+	0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+	0x00, 0xC0, 0x30, 0x1C, 0x03, 0xFF, 0x80, 0x3F, 0xF0, 0x03, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x03, 0x18, 0xC0,
+	0x33, 0x0C, 0x00, 0x78, 0x00, 0x3C, 0xE0, 0x03, 0x87, 0x80, 0x38, 0x1C, 0x03, 0x00, 0xC0, 0x30,
+	0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x3F, 0xFC,
+	0x03, 0xFF, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0x00, 0x7C, 0x00,
+	0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x3F, 0xFC, 0x03, 0xFF,
+	0xC0, 0x3C, 0x0C, 0x00, 0x78, 0xC0, 0x01, 0xE0, 0x00, 0x1E, 0x00, 0x07, 0x8C, 0x03, 0xC0, 0xC0,
+	0x3F, 0xFC, 0x03, 0xFF, 0xC0, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x0C, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x01, 0xE0, 0xC0, 0x07, 0x8C, 0x03, 0x1E, 0x00, 0x30, 0x78,
+	0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0x00, 0x1C, 0x38, 0x03, 0x81, 0xC0, 0x30, 0x0C, 0x03, 0x00,
+	0xC0, 0x38, 0x1C, 0x01, 0xC3, 0x80, 0x0F, 0xF0, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x03, 0xFF, 0xC0, 0x3F, 0xFC, 0x03, 0x0C, 0xC0, 0x30,
+	0xCC, 0x03, 0x0C, 0xC0, 0x30, 0xC0, 0x03, 0x9C, 0x00, 0x1F, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0x00, 0x1C, 0x39, 0x83,
+	0x81, 0xF8, 0x30, 0x0F, 0x03, 0x00, 0xF0, 0x38, 0x1F, 0x81, 0xC3, 0x98, 0x0F, 0xF3, 0x80, 0x7E,
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x03, 0xFF, 0xC0,
+	0x3F, 0xFC, 0x03, 0x18, 0xC0, 0x31, 0x8C, 0x03, 0x18, 0x00, 0x31, 0xC0, 0x03, 0xBF, 0x00, 0x1F,
+	0x78, 0x00, 0xE1, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x3C,
+	0x01, 0xF3, 0xC0, 0x3B, 0x18, 0x03, 0x18, 0xC0, 0x31, 0x8C, 0x03, 0x18, 0xC0, 0x31, 0x8C, 0x01,
+	0x8D, 0xC0, 0x3C, 0xF8, 0x03, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x3F, 0xFC, 0x03, 0xFF, 0xC0,
+	0x30, 0x0C, 0x03, 0x00, 0xC0, 0x3E, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x03, 0xFF, 0x00, 0x3F, 0xF8, 0x03, 0x01, 0xC0, 0x00, 0x0C,
+	0x00, 0x00, 0xC0, 0x30, 0x1C, 0x03, 0xFF, 0x80, 0x3F, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x3C, 0x00, 0x03, 0xF0, 0x00, 0x33, 0xE0, 0x00, 0x0F,
+	0xC0, 0x00, 0x1C, 0x00, 0x0F, 0xC0, 0x33, 0xE0, 0x03, 0xF0, 0x00, 0x3C, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x3F, 0x80, 0x03, 0xFF, 0xC0, 0x30,
+	0x3C, 0x03, 0x0F, 0x80, 0x07, 0xC0, 0x00, 0x70, 0x00, 0x07, 0xC0, 0x03, 0x0F, 0x80, 0x30, 0x3C,
+	0x03, 0xFF, 0xC0, 0x3F, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xC0, 0x38, 0x1C, 0x03,
+	0xC3, 0xC0, 0x36, 0x6C, 0x00, 0x3C, 0x00, 0x01, 0x80, 0x00, 0x3C, 0x00, 0x36, 0x6C, 0x03, 0xC3,
+	0xC0, 0x38, 0x1C, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x30, 0x00, 0x03, 0x80, 0x00, 0x3C, 0x0C, 0x03, 0x70, 0xC0, 0x03, 0xFC, 0x00, 0x3F, 0xC0, 0x37,
+	0x0C, 0x03, 0xC0, 0xC0, 0x38, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1, 0xC0, 0x3C, 0x3C, 0x03, 0x06, 0xC0, 0x31, 0xCC, 0x03,
+	0x38, 0xC0, 0x36, 0x0C, 0x03, 0xC3, 0xC0, 0x38, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x7F, 0xFF, 0x87, 0xFF, 0xF8, 0x60, 0x01, 0x86, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0xF8, 0x00,
+	0x03, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x60, 0x01, 0x86, 0x00, 0x18, 0x7F, 0xFF, 0x87, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x00, 0x00, 0xC0, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x60, 0x00, 0x03, 0x00, 0x00, 0x18, 0x00,
+	0x00, 0xC0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00,
+	0x03, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20,
+	0x00, 0x02, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x27, 0xC0, 0x06, 0xEC, 0x00,
+	0x6C, 0xC0, 0x06, 0xCC, 0x00, 0x6C, 0xC0, 0x06, 0xD8, 0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x00,
+	0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x7F, 0xFC, 0x07, 0xFF, 0xC0,
+	0x03, 0x18, 0x00, 0x60, 0xC0, 0x06, 0x0C, 0x00, 0x60, 0xC0, 0x06, 0x0C, 0x00, 0x31, 0x80, 0x03,
+	0xF8, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
+	0x00, 0x3F, 0x80, 0x03, 0x1C, 0x00, 0x60, 0xC0, 0x06, 0x0C, 0x00, 0x60, 0xC0, 0x06, 0x0C, 0x00,
+	0x20, 0xC0, 0x07, 0x98, 0x00, 0x79, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xF0, 0x00, 0x3F, 0x80, 0x03, 0x18, 0x00, 0x60, 0xC0, 0x06, 0x0C, 0x00, 0x60, 0xC0,
+	0x06, 0x0C, 0x06, 0x31, 0x80, 0x7F, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x3F, 0x80, 0x03, 0xD8, 0x00, 0x6C, 0xC0, 0x06, 0xCC,
+	0x00, 0x6C, 0xC0, 0x06, 0xCC, 0x00, 0x3C, 0xC0, 0x03, 0xD8, 0x00, 0x0D, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xC0, 0x06, 0x0C, 0x03, 0xFF,
+	0xC0, 0x7F, 0xFC, 0x06, 0x60, 0xC0, 0x66, 0x0C, 0x06, 0x60, 0xC0, 0x66, 0x0C, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x3F, 0x80, 0x03,
+	0x18, 0xC0, 0x60, 0xCC, 0x06, 0x0C, 0xC0, 0x60, 0xCC, 0x06, 0x0C, 0xC0, 0x31, 0x9C, 0x07, 0xFF,
+	0x80, 0x7F, 0xF0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x07,
+	0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x30, 0xC0, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x0C, 0x00, 0x7F,
+	0xC0, 0x03, 0xFC, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x60, 0xC0, 0x06, 0x0C, 0x00, 0x60, 0xC0, 0x67, 0xFC, 0x06, 0x7F, 0xC0, 0x00,
+	0x0C, 0x00, 0x00, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x60, 0x0C, 0x06, 0x00, 0xC0, 0x60, 0x0C, 0x66, 0x00, 0xC6,
+	0x60, 0x1C, 0x07, 0xFF, 0x80, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x07, 0xFF, 0xC0, 0x7F, 0xFC, 0x00, 0x0C, 0x00,
+	0x07, 0xE0, 0x00, 0x73, 0xC0, 0x06, 0x1C, 0x00, 0x60, 0xC0, 0x06, 0x0C, 0x00, 0x00, 0xC0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x60, 0x0C,
+	0x06, 0x00, 0xC0, 0x7F, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0xC0, 0x00, 0x0C, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xC0, 0x07, 0xFC, 0x00, 0x7F,
+	0xC0, 0x06, 0x0C, 0x00, 0x60, 0x00, 0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x06, 0x0C, 0x00, 0x60, 0x00,
+	0x07, 0xFC, 0x00, 0x3F, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x0C, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x30, 0xC0, 0x06, 0x00, 0x00, 0x60, 0x00, 0x06, 0x0C,
+	0x00, 0x7F, 0xC0, 0x03, 0xFC, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xE0, 0x00, 0x3F, 0x80, 0x03, 0x18, 0x00, 0x60, 0xC0, 0x06, 0x0C, 0x00, 0x60,
+	0xC0, 0x06, 0x0C, 0x00, 0x31, 0x80, 0x03, 0xF8, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x60, 0x0C, 0x07, 0xFF, 0xC0, 0x7F, 0xFC, 0x03, 0x18, 0xC0, 0x60, 0xCC, 0x06,
+	0x0C, 0x00, 0x60, 0xC0, 0x06, 0x0C, 0x00, 0x31, 0x80, 0x03, 0xF8, 0x00, 0x0E, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x3F, 0x80, 0x03, 0x18, 0x00,
+	0x60, 0xC0, 0x06, 0x0C, 0x00, 0x60, 0xC0, 0x06, 0x0C, 0xC0, 0x31, 0x8C, 0x07, 0xFF, 0xC0, 0x7F,
+	0xFC, 0x06, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x60, 0xC0,
+	0x07, 0xFC, 0x00, 0x7F, 0xC0, 0x01, 0x8C, 0x00, 0x30, 0xC0, 0x06, 0x0C, 0x00, 0x60, 0xC0, 0x07,
+	0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x39, 0xC0, 0x03, 0xDC, 0x00, 0x6C, 0xC0, 0x06, 0xCC, 0x00, 0x66, 0xC0, 0x06, 0x6C, 0x00,
+	0x77, 0x80, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x00, 0x00, 0x60, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xC0, 0x06, 0x0C, 0x00, 0x60, 0xC0,
+	0x06, 0x0C, 0x00, 0x60, 0xC0, 0x06, 0x18, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0x00, 0x00, 0xC0, 0x00, 0x0C,
+	0x00, 0x00, 0xC0, 0x06, 0x18, 0x00, 0x7F, 0xC0, 0x07, 0xFC, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x07, 0x00, 0x00, 0x7C, 0x00, 0x06, 0xF0, 0x00, 0x03,
+	0xC0, 0x00, 0x0C, 0x00, 0x03, 0xC0, 0x06, 0xF0, 0x00, 0x7C, 0x00, 0x07, 0x00, 0x00, 0x60, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xC0, 0x06,
+	0x3C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x07, 0x00, 0x06, 0x7C, 0x00, 0x7F, 0xC0, 0x07, 0xC0,
+	0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0C, 0x00,
+	0x60, 0xC0, 0x07, 0x1C, 0x00, 0x7B, 0xC0, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x07, 0xBC, 0x00, 0x71,
+	0xC0, 0x06, 0x0C, 0x00, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0C,
+	0x07, 0x00, 0xC0, 0x7C, 0x0C, 0x06, 0xF1, 0xC0, 0x03, 0xFC, 0x00, 0x1E, 0xC0, 0x03, 0x8C, 0x06,
+	0xF0, 0x00, 0x7C, 0x00, 0x07, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xC0, 0x07, 0x1C, 0x00, 0x63, 0xC0, 0x06, 0x6C, 0x00,
+	0x6C, 0xC0, 0x07, 0x8C, 0x00, 0x71, 0xC0, 0x06, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x0E, 0x00,
+	0x3F, 0xFF, 0x07, 0xFB, 0xF8, 0x60, 0x01, 0x86, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x7F, 0xFF, 0x87, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00,
+	0x18, 0x60, 0x01, 0x87, 0xFB, 0xF8, 0x3F, 0xFF, 0x00, 0x0E, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x80, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x03, 0x80, 0x00, 0x1C, 0x00, 0x00, 0xC0,
+	0x00, 0x0C, 0x00, 0x01, 0xC0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00,
+};
+#endif
+
+sFONT Font20 = {
+  NULL,
+  14, /* Width */
+  20, /* Height */
+  NULL,
+  Font20_Packed,
+  NULL,
+};
+
+// 17x24, 408 bits per glyph, 4845 B packed (font24.cpp + font_r270.cpp: 11685 B)
+#if USE_LANDSCAPE_PAINT
+const uint8_t Font24_Packed[] = 
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00,
+	0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCE, 0x00, 0xE7,
+	0x00, 0x73, 0x80, 0x10, 0x80, 0x08, 0x40, 0x04, 0x20, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x00,
+	0xCC, 0x00, 0x66, 0x00, 0x33, 0x00, 0x19, 0x80, 0x7F, 0xF0, 0x3F, 0xF8, 0x03, 0x30, 0x03, 0x30,
+	0x07, 0xFF, 0x03, 0xFF, 0x80, 0x66, 0x00, 0x33, 0x00, 0x19, 0x80, 0x0C, 0xC0, 0x06, 0x60, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+	0x00, 0x60, 0x00, 0xF6, 0x00, 0xFF, 0x00, 0xC3, 0x80, 0x61, 0xC0, 0x38, 0x00, 0x0F, 0x80, 0x03,
+	0xF0, 0x00, 0x3C, 0x03, 0x06, 0x01, 0xC3, 0x00, 0xE3, 0x80, 0x7F, 0x80, 0x37, 0x80, 0x01, 0x80,
+	0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0xE0, 0x01, 0xF8, 0x01, 0xCE, 0x00, 0xC3, 0x00, 0x61, 0x80, 0x39, 0xC0,
+	0x0F, 0xF8, 0x03, 0xF0, 0x07, 0xFC, 0x00, 0xE7, 0x00, 0x61, 0x80, 0x30, 0xC0, 0x1C, 0xE0, 0x07,
+	0xE0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x31,
+	0x80, 0x18, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x01, 0xC0, 0x01, 0xF3, 0x81, 0xDF, 0xC0, 0xC7, 0x80,
+	0x61, 0xC0, 0x1F, 0xF8, 0x07, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x38, 0x00,
+	0x1C, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x07, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00,
+	0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x0E,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+	0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x01, 0xC0,
+	0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x07,
+	0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0xED, 0xC0, 0x7F, 0xE0, 0x0F, 0xC0, 0x03,
+	0xC0, 0x01, 0xE0, 0x01, 0x98, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00,
+	0x03, 0x00, 0x01, 0x80, 0x1F, 0xFE, 0x0F, 0xFF, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06,
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+	0x0C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0xC0,
+	0x00, 0xC0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x0C,
+	0x00, 0x0E, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0xC3, 0x00, 0x61, 0x80, 0x60, 0x60, 0x30,
+	0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0x61, 0x80, 0x30, 0xC0,
+	0x0F, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xF0, 0x01, 0xF8, 0x00, 0xEC, 0x00,
+	0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C,
+	0x00, 0x06, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xFE, 0x03, 0x83,
+	0x01, 0x80, 0xC0, 0xC0, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00, 0x70, 0x00,
+	0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
+	0xFC, 0x00, 0xC7, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0xC0, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x1C,
+	0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x60, 0xE0, 0x3F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x38, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x1B, 0x00, 0x19, 0x80, 0x0C, 0xC0, 0x0C, 0x60, 0x06,
+	0x30, 0x06, 0x18, 0x06, 0x0C, 0x03, 0xFF, 0x81, 0xFF, 0xC0, 0x01, 0x80, 0x07, 0xF0, 0x03, 0xF8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFE, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x37, 0x80,
+	0x1F, 0xF0, 0x0E, 0x18, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0xC0, 0xC0, 0x7F,
+	0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x70, 0x00, 0x70, 0x00, 0x30,
+	0x00, 0x30, 0x00, 0x1B, 0xC0, 0x0F, 0xF8, 0x07, 0x0C, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0,
+	0x30, 0xE0, 0x1F, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0x81, 0x80,
+	0xC1, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x30, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x0C,
+	0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x01, 0xFE,
+	0x01, 0xC3, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x18, 0x60, 0x07, 0xE0, 0x03, 0xF0, 0x03, 0x0C, 0x03,
+	0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x70, 0xE0, 0x1F, 0xE0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0xF0, 0x01, 0xFE, 0x01, 0xC3, 0x00, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x0C, 0x38, 0x07, 0xFC,
+	0x00, 0xF6, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80, 0x03, 0x80, 0x3F, 0x80, 0x1F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03,
+	0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x80,
+	0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0,
+	0x01, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07,
+	0x00, 0x03, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x01,
+	0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00,
+	0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+	0x87, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00,
+	0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFE, 0x00, 0xC3, 0x80, 0x60, 0xC0, 0x30, 0x60, 0x00, 0x70,
+	0x00, 0x70, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFE, 0x00, 0xE3, 0x80, 0x60, 0xC0, 0x61, 0xE0, 0x31,
+	0xF0, 0x19, 0xD8, 0x0C, 0xCC, 0x06, 0x66, 0x03, 0x33, 0x01, 0x8F, 0x80, 0xC3, 0xC0, 0x60, 0x00,
+	0x18, 0x00, 0x0E, 0x18, 0x03, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x0E, 0x00,
+	0x0D, 0x80, 0x06, 0xC0, 0x06, 0x30, 0x03, 0x18, 0x03, 0x0C, 0x01, 0xFF, 0x01, 0xFF, 0x80, 0xC0,
+	0x60, 0xC0, 0x31, 0xF8, 0xFE, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF,
+	0x00, 0xC1, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x38, 0x0F, 0xF8, 0x07, 0xFE, 0x03, 0x03, 0x81,
+	0x80, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0xFF, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x7D, 0x80, 0xFF, 0xC0, 0xE0, 0xE0, 0x60, 0x30, 0x60, 0x18, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00,
+	0x06, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x60, 0x70, 0x70, 0x1F, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x0F, 0xF8, 0x07, 0xFF, 0x00, 0xC1, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C,
+	0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0xC0, 0x60, 0xE0, 0xFF, 0xE0, 0x7F, 0xE0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x07, 0xFF, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x33, 0x30,
+	0x19, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0x30, 0x01, 0x99, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0xFF,
+	0xF0, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x83, 0xFF, 0xC0, 0x60, 0x60, 0x30,
+	0x30, 0x19, 0x98, 0x0C, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0x98, 0x00, 0xCC, 0x00, 0x60, 0x00,
+	0x30, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x80, 0xFF, 0xC0,
+	0xE0, 0xE0, 0x60, 0x30, 0x60, 0x18, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x3F, 0x86, 0x1F, 0xC3, 0x00,
+	0xC1, 0xC0, 0x60, 0x70, 0x70, 0x1F, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCF,
+	0xC7, 0xE7, 0xE0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0F, 0xFC, 0x07, 0xFE, 0x03,
+	0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0xFC, 0xFC, 0x7E, 0x7E, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0,
+	0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00,
+	0x30, 0x00, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC1, 0x80, 0x7F, 0xC0,
+	0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xC7, 0xF3, 0xE0, 0xC1, 0x80, 0x61, 0x80,
+	0x31, 0x80, 0x19, 0x80, 0x0D, 0xC0, 0x07, 0xF0, 0x03, 0x9C, 0x01, 0x87, 0x00, 0xC1, 0x80, 0x60,
+	0xE0, 0xFE, 0x3E, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x60,
+	0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x81, 0x80, 0xC0, 0xC0,
+	0x60, 0x60, 0x30, 0x30, 0xFF, 0xF8, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x01, 0xEF,
+	0x81, 0xF1, 0xC0, 0xE0, 0xF0, 0xF0, 0x78, 0x78, 0x36, 0x6C, 0x1B, 0x36, 0x0C, 0xF3, 0x06, 0x79,
+	0x83, 0x18, 0xC1, 0x80, 0x60, 0xC0, 0x31, 0xFC, 0xFE, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0F, 0x1F, 0xC7, 0x8F, 0xE0, 0xE0, 0xC0, 0x78, 0x60, 0x3E, 0x30, 0x1B, 0x18, 0x0D, 0xCC, 0x06,
+	0x76, 0x03, 0x1B, 0x01, 0x8F, 0x80, 0xC3, 0xC0, 0x60, 0xE0, 0xFE, 0x30, 0x7F, 0x18, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xFF, 0x00, 0xE1, 0xC0, 0x60, 0x60, 0x70, 0x38, 0x30, 0x0C,
+	0x18, 0x06, 0x0C, 0x03, 0x06, 0x01, 0x83, 0x81, 0xC0, 0xC0, 0xC0, 0x70, 0xE0, 0x1F, 0xE0, 0x03,
+	0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x80, 0x60, 0xE0, 0x30, 0x30, 0x18,
+	0x18, 0x0C, 0x0C, 0x06, 0x0C, 0x03, 0xFE, 0x01, 0xFC, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00,
+	0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xFF, 0x00, 0xE1, 0xC0,
+	0x60, 0x60, 0x70, 0x38, 0x30, 0x0C, 0x18, 0x06, 0x0C, 0x03, 0x06, 0x01, 0x83, 0x81, 0xC0, 0xC0,
+	0xC0, 0x70, 0xE0, 0x1F, 0xE0, 0x07, 0xC0, 0x03, 0xE6, 0x03, 0xFF, 0x01, 0x87, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF,
+	0x00, 0xC1, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x38, 0x0F, 0xF8, 0x07, 0xF0, 0x03, 0x1C, 0x01,
+	0x87, 0x00, 0xC1, 0x80, 0x60, 0xE0, 0xFE, 0x3C, 0x7F, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFB, 0x00, 0xFF, 0x80, 0xE1, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x1E, 0x00, 0x07, 0xE0, 0x00, 0xFC,
+	0x00, 0x0F, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x70, 0xE0, 0x3F, 0xE0, 0x1B, 0xE0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0xFF, 0x83, 0xFF, 0xC1, 0x8C, 0x60, 0xC6, 0x30, 0x63, 0x18, 0x31, 0x8C, 0x00,
+	0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x1F, 0xE0, 0x0F, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC7, 0xE7, 0xE0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30,
+	0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x30, 0xC0, 0x1F,
+	0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xE7, 0xF7, 0xF0, 0xC0, 0x60, 0x30,
+	0x60, 0x18, 0x30, 0x0C, 0x18, 0x03, 0x18, 0x01, 0x8C, 0x00, 0x6C, 0x00, 0x36, 0x00, 0x1B, 0x00,
+	0x07, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xFF, 0xE3, 0xF9,
+	0x80, 0x30, 0xC0, 0x18, 0x61, 0x0C, 0x19, 0xCC, 0x0C, 0xE6, 0x06, 0xDB, 0x03, 0x6D, 0x81, 0xE7,
+	0xC0, 0x71, 0xC0, 0x38, 0xE0, 0x18, 0x30, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCF,
+	0xC7, 0xE7, 0xE0, 0xC0, 0xC0, 0x30, 0xC0, 0x0C, 0xC0, 0x03, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00,
+	0x78, 0x00, 0x66, 0x00, 0x61, 0x80, 0x60, 0x60, 0xFC, 0xFC, 0x7E, 0x7E, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0F, 0x8F, 0xC7, 0xC7, 0xE0, 0xC0, 0xC0, 0x30, 0xC0, 0x0C, 0xC0, 0x06, 0x60, 0x01, 0xE0,
+	0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xC0, 0xC0, 0x60, 0xC0, 0x30, 0xC0, 0x18,
+	0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC3, 0x00, 0xC1, 0x80, 0xC0, 0xC0, 0xC0, 0x60, 0x7F, 0xF0,
+	0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00,
+	0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06,
+	0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x00, 0x30,
+	0x00, 0x18, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x18, 0x00, 0x0C, 0x00,
+	0x03, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x00, 0x30, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xF0, 0x00,
+	0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30,
+	0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x03, 0xE0, 0x01,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x70,
+	0x00, 0x7C, 0x00, 0x77, 0x00, 0x31, 0x80, 0x30, 0x60, 0x30, 0x18, 0x10, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0xFF, 0xFE,
+	0x00, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x3F, 0x00, 0x3F, 0xC0, 0x00, 0x30, 0x00, 0x18, 0x01, 0xFC, 0x03, 0xFE, 0x03, 0x83, 0x01, 0x81,
+	0x80, 0xC1, 0xC0, 0x3F, 0xF8, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x01, 0x80,
+	0x00, 0xC0, 0x00, 0x6F, 0x80, 0x3F, 0xF0, 0x1C, 0x18, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81,
+	0x80, 0xC0, 0xC0, 0x60, 0x70, 0x60, 0xFF, 0xF0, 0x7B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x1F, 0xF8, 0x1C, 0x1C, 0x1C, 0x06, 0x0C, 0x03,
+	0x06, 0x00, 0x03, 0x00, 0x01, 0xC0, 0x60, 0x70, 0x70, 0x1F, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1E, 0x00, 0x0F, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x1F, 0x60, 0x3F, 0xF0, 0x18, 0x38, 0x18,
+	0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0x60, 0xE0, 0x3F, 0xFC, 0x07, 0xDE,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xF0,
+	0x18, 0x18, 0x18, 0x06, 0x0F, 0xFF, 0x07, 0xFF, 0x83, 0x00, 0x01, 0x80, 0x00, 0x60, 0x30, 0x3F,
+	0xF8, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x60, 0x00, 0x30, 0x00, 0xFF,
+	0xE0, 0x7F, 0xF0, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00,
+	0x18, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1F, 0x78, 0x3F, 0xFC, 0x18, 0x38, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01,
+	0x81, 0x80, 0xC0, 0x60, 0xE0, 0x3F, 0xF0, 0x07, 0xD8, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x07, 0x00,
+	0xFF, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0x00,
+	0x01, 0x80, 0x00, 0xC0, 0x00, 0x6F, 0x80, 0x3F, 0xE0, 0x1C, 0x38, 0x0C, 0x0C, 0x06, 0x06, 0x03,
+	0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0xFC, 0xFC, 0x7E, 0x7E, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x01, 0x80, 0x00, 0xC0,
+	0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x7F, 0xF8, 0x3F, 0xFC, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x00,
+	0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60,
+	0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0E, 0x01, 0xFE, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x33, 0xE0,
+	0x19, 0xF0, 0x0C, 0xC0, 0x06, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x00, 0xF8, 0x00, 0x6E, 0x00, 0x33,
+	0x80, 0x78, 0xF8, 0x3C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x18, 0x00, 0x0C,
+	0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00,
+	0x0C, 0x00, 0x06, 0x00, 0x7F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0xDD, 0xE1, 0xFF, 0xF8, 0x39, 0xCC, 0x18, 0xC6, 0x0C, 0x63, 0x06, 0x31,
+	0x83, 0x18, 0xC1, 0x8C, 0x60, 0xC6, 0x31, 0xFB, 0xDE, 0xFD, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x80, 0xFF, 0xE0, 0x1C, 0x38, 0x0C, 0x0C, 0x06,
+	0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0xFC, 0xFC, 0x7E, 0x7E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0xE0, 0x1C, 0x38,
+	0x1C, 0x0E, 0x0C, 0x03, 0x06, 0x01, 0x83, 0x00, 0xC1, 0xC0, 0xE0, 0x70, 0xE0, 0x1F, 0xE0, 0x03,
+	0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x80, 0xFF,
+	0xF0, 0x1C, 0x18, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x60, 0x70, 0x60,
+	0x3F, 0xF0, 0x1B, 0xE0, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1F, 0x78, 0x3F, 0xFC, 0x18, 0x38, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80,
+	0xC0, 0x60, 0xE0, 0x3F, 0xF0, 0x07, 0xD8, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x0F, 0xE0,
+	0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xF9, 0xE0, 0x7D, 0xF8, 0x07, 0xCC, 0x03, 0x80, 0x01, 0x80, 0x00, 0xC0, 0x00,
+	0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xF0, 0x18, 0x18, 0x0C, 0x0C, 0x07, 0xE0,
+	0x01, 0xFE, 0x00, 0x0F, 0x80, 0xC0, 0xC0, 0x60, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x0C, 0x00, 0x06,
+	0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x70, 0x0F, 0xF8, 0x03, 0xF0,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE1, 0xE0, 0xF0, 0xF0,
+	0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x60, 0xE0, 0x1F,
+	0xFC, 0x07, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
+	0xF8, 0xF8, 0x7C, 0x18, 0x18, 0x0C, 0x0C, 0x03, 0x0C, 0x01, 0x86, 0x00, 0x66, 0x00, 0x33, 0x00,
+	0x1F, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0xE0, 0xF0, 0xF0, 0x78, 0x31, 0x18, 0x19, 0xCC, 0x0C, 0xE6, 0x03, 0x56, 0x01, 0xEF,
+	0x00, 0xF7, 0x80, 0x71, 0x80, 0x18, 0xC0, 0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xF0, 0x7C, 0xF8, 0x0C, 0x30, 0x03, 0x30, 0x00, 0xF0, 0x00,
+	0x30, 0x00, 0x3C, 0x00, 0x33, 0x00, 0x30, 0xC0, 0x7C, 0xF8, 0x3E, 0x7C, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x7C, 0xFC, 0x3E, 0x18, 0x0C, 0x06, 0x0C,
+	0x03, 0x06, 0x00, 0xC6, 0x00, 0x63, 0x00, 0x1B, 0x00, 0x0F, 0x80, 0x03, 0x80, 0x00, 0xC0, 0x00,
+	0xC0, 0x00, 0x60, 0x00, 0x60, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x18,
+	0x30, 0x0C, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xC0, 0x30, 0x60, 0x3F, 0xF0,
+	0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00,
+	0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0C, 0x00, 0x06,
+	0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C,
+	0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00,
+	0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0xF0, 0x00,
+	0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x70, 0x00, 0x1C,
+	0x00, 0x1C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x01, 0xE0, 0x00,
+	0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x8C, 0x0E,
+	0xEE, 0x06, 0x3E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00,
+};
+#else
+const uint8_t Font24_Packed[] = 
+{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE1, 0x80, 0x3F, 0xF9, 0x80, 0x3F, 0xE1, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1C, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x1C, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0xBF, 0xC0, 0x3F, 0xFF, 0xC0, 0x3F, 0xD8, 0x00, 0x01, 0x98,
+	0x00, 0x01, 0xBF, 0xC0, 0x3F, 0xFF, 0xC0, 0x3F, 0xD8, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x00, 0x0F, 0x9F, 0x00, 0x19, 0xCE, 0x00, 0x18, 0xC3,
+	0x00, 0x78, 0xC3, 0xF0, 0x78, 0xE3, 0xF0, 0x0E, 0x67, 0x00, 0x1E, 0x7E, 0x00, 0x1E, 0x3C, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x1F, 0xA0, 0x00, 0x39, 0xFE,
+	0x00, 0x30, 0xFF, 0x00, 0x30, 0xF3, 0x80, 0x39, 0xE1, 0x80, 0x1F, 0xE1, 0x80, 0x0F, 0xF3, 0x80,
+	0x00, 0xBF, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x03, 0x9F,
+	0x00, 0x07, 0xF9, 0x80, 0x0C, 0x71, 0x80, 0x0C, 0x39, 0x80, 0x0C, 0x1D, 0x80, 0x0E, 0x0F, 0x80,
+	0x0E, 0x0F, 0x00, 0x0C, 0x1F, 0x80, 0x00, 0x19, 0x80, 0x00, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1C, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
+	0x07, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0x03, 0xE0, 0x3C, 0x00, 0xF0, 0x30, 0x00, 0x30, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x3C, 0x00, 0xF0, 0x1F, 0x03, 0xE0, 0x0F, 0xFF, 0xC0,
+	0x03, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0x30, 0x00,
+	0x03, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0x30, 0x00, 0x06,
+	0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x60, 0x00, 0x00,
+	0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00,
+	0x03, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,
+	0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00,
+	0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00,
+	0x1F, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00,
+	0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x1C,
+	0x07, 0x00, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x1C, 0x07,
+	0x00, 0x0F, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x01, 0x80, 0x0C,
+	0x01, 0x80, 0x1C, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x00, 0x01,
+	0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x01, 0x80, 0x1E,
+	0x03, 0x80, 0x18, 0x07, 0x80, 0x30, 0x0D, 0x80, 0x30, 0x19, 0x80, 0x30, 0x31, 0x80, 0x30, 0x31,
+	0x80, 0x30, 0x61, 0x80, 0x18, 0xC1, 0x80, 0x1F, 0x81, 0x80, 0x07, 0x01, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x18, 0x03, 0x80, 0x18, 0x01, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1,
+	0x80, 0x30, 0xC1, 0x80, 0x39, 0xE1, 0x80, 0x1F, 0x63, 0x00, 0x0E, 0x3F, 0x00, 0x00, 0x1E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xEC, 0x00, 0x03, 0xCC, 0x00, 0x07, 0x0D,
+	0x80, 0x1C, 0x0D, 0x80, 0x38, 0x0D, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x00, 0x0D, 0x80,
+	0x00, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3F, 0xC3, 0x00, 0x3F, 0xC1, 0x80, 0x30, 0xC1,
+	0x80, 0x31, 0x81, 0x80, 0x31, 0x81, 0x80, 0x31, 0x81, 0x80, 0x31, 0x81, 0x80, 0x30, 0xC3, 0x00,
+	0x30, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFF,
+	0x00, 0x0E, 0x63, 0x00, 0x1C, 0xC1, 0x80, 0x18, 0xC1, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1, 0x80,
+	0x30, 0x63, 0x80, 0x30, 0x7F, 0x00, 0x30, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00,
+	0x00, 0x3C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x03, 0x80, 0x30, 0x1F, 0x80,
+	0x30, 0xFE, 0x00, 0x37, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0E, 0x1E, 0x00, 0x1F, 0x3F, 0x00, 0x39, 0xE3, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1, 0x80,
+	0x30, 0xC1, 0x80, 0x30, 0xC1, 0x80, 0x39, 0xE3, 0x80, 0x1F, 0x3F, 0x00, 0x0E, 0x1E, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0x01, 0x80, 0x1F, 0xC1, 0x80, 0x38, 0xC1, 0x80, 0x30, 0x61, 0x80,
+	0x30, 0x61, 0x80, 0x30, 0x63, 0x00, 0x30, 0x67, 0x00, 0x18, 0xCE, 0x00, 0x1F, 0xFC, 0x00, 0x07,
+	0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x83, 0x80, 0x03, 0x83, 0x80, 0x03, 0x83, 0x80, 0x03, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0xC0, 0x03, 0x87, 0x80, 0x03, 0x86, 0x00, 0x03,
+	0x84, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
+	0x00, 0xD8, 0x00, 0x00, 0xD8, 0x00, 0x01, 0x8C, 0x00, 0x01, 0x8C, 0x00, 0x03, 0x06, 0x00, 0x03,
+	0x06, 0x00, 0x06, 0x03, 0x00, 0x0E, 0x03, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00,
+	0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01,
+	0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x01, 0x80,
+	0x0C, 0x01, 0x80, 0x0E, 0x03, 0x80, 0x06, 0x03, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x01,
+	0x8C, 0x00, 0x01, 0x8C, 0x00, 0x00, 0xD8, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70,
+	0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18,
+	0x39, 0x80, 0x18, 0x39, 0x80, 0x18, 0x70, 0x00, 0x1C, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x1C,
+	0x01, 0xC0, 0x38, 0x00, 0xE0, 0x30, 0xF0, 0x60, 0x31, 0xF8, 0x60, 0x33, 0x8C, 0x60, 0x3B, 0x0C,
+	0x60, 0x1F, 0xFC, 0xC0, 0x0F, 0xFC, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x18, 0x0F, 0x80, 0x18,
+	0x3D, 0x80, 0x18, 0xF9, 0x80, 0x1B, 0xD8, 0x00, 0x1F, 0x18, 0x00, 0x1C, 0x18, 0x00, 0x0F, 0x19,
+	0x80, 0x03, 0xF9, 0x80, 0x00, 0xF9, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F,
+	0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61,
+	0x80, 0x18, 0x61, 0x80, 0x1C, 0xE1, 0x80, 0x0F, 0xF1, 0x80, 0x07, 0xBF, 0x00, 0x00, 0x1E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0xF8, 0x00, 0x07, 0xFE, 0x00, 0x0E, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01,
+	0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x0C, 0x03, 0x80, 0x1F, 0x07, 0x00,
+	0x1F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+	0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x0C, 0x03, 0x80, 0x0E, 0x07, 0x00,
+	0x07, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x61,
+	0x80, 0x18, 0x61, 0x80, 0x19, 0xF9, 0x80, 0x19, 0xF9, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+	0x1F, 0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF,
+	0x80, 0x1F, 0xFF, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x19, 0xF9, 0x80, 0x19, 0xF9, 0x80,
+	0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFE,
+	0x00, 0x0E, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x31, 0x80,
+	0x18, 0x31, 0x80, 0x18, 0x31, 0x80, 0x0C, 0x33, 0x80, 0x1F, 0x3F, 0x00, 0x1F, 0x3F, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01,
+	0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x00, 0x60, 0x00,
+	0x00, 0x60, 0x00, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18,
+	0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18,
+	0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x03, 0x00, 0x1F, 0xFF, 0x00, 0x1F,
+	0xFC, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80,
+	0x18, 0x31, 0x80, 0x18, 0x61, 0x80, 0x18, 0xE1, 0x80, 0x01, 0xF0, 0x00, 0x03, 0x38, 0x00, 0x1E,
+	0x1E, 0x00, 0x1C, 0x0F, 0x80, 0x18, 0x03, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x01,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+	0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80,
+	0x1F, 0xFF, 0x80, 0x0F, 0x01, 0x80, 0x03, 0xC1, 0x80, 0x00, 0xF1, 0x80, 0x00, 0x38, 0x00, 0x00,
+	0x38, 0x00, 0x00, 0xF1, 0x80, 0x03, 0xC1, 0x80, 0x0F, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF,
+	0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80,
+	0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x07, 0x01, 0x80, 0x03, 0xC1, 0x80, 0x01,
+	0xE1, 0x80, 0x18, 0x78, 0x00, 0x18, 0x3C, 0x00, 0x18, 0x0E, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF,
+	0x80, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0x0F, 0x00, 0x0C, 0x03, 0x00, 0x18,
+	0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x0C, 0x03, 0x00, 0x0F, 0x0F,
+	0x00, 0x07, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F,
+	0xFF, 0x80, 0x18, 0x31, 0x80, 0x18, 0x31, 0x80, 0x18, 0x31, 0x80, 0x18, 0x31, 0x80, 0x18, 0x30,
+	0x00, 0x1C, 0x60, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x0F,
+	0x0F, 0x30, 0x0C, 0x03, 0xF0, 0x18, 0x01, 0xE0, 0x18, 0x01, 0xE0, 0x18, 0x01, 0xE0, 0x18, 0x01,
+	0xE0, 0x0C, 0x03, 0x30, 0x0F, 0x0F, 0x30, 0x07, 0xFE, 0x70, 0x01, 0xF8, 0x60, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F,
+	0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x18, 0x70,
+	0x00, 0x18, 0x78, 0x00, 0x1C, 0xDE, 0x00, 0x0F, 0xCF, 0x00, 0x07, 0x83, 0x80, 0x00, 0x01, 0x80,
+	0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x07, 0x8F, 0x80, 0x0F, 0xCF, 0x80, 0x1C, 0xC3, 0x00, 0x18, 0xE1, 0x80, 0x18, 0x61,
+	0x80, 0x18, 0x61, 0x80, 0x18, 0x71, 0x80, 0x0C, 0x33, 0x80, 0x1F, 0x3F, 0x00, 0x1F, 0x1E, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+	0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+	0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x18, 0x03,
+	0x00, 0x18, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x03, 0x00,
+	0x1F, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1F, 0x80,
+	0x00, 0x1B, 0xE0, 0x00, 0x18, 0x7C, 0x00, 0x18, 0x1F, 0x00, 0x00, 0x03, 0x80, 0x18, 0x1F, 0x00,
+	0x18, 0x7C, 0x00, 0x1B, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xF8,
+	0x00, 0x18, 0xFF, 0x80, 0x18, 0x0F, 0x80, 0x18, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xC0, 0x00,
+	0x00, 0xF8, 0x00, 0x18, 0x3E, 0x00, 0x18, 0x0F, 0x80, 0x18, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x1F,
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01,
+	0x80, 0x1C, 0x03, 0x80, 0x1E, 0x07, 0x80, 0x1B, 0x0D, 0x80, 0x19, 0x99, 0x80, 0x00, 0xF0, 0x00,
+	0x00, 0xF0, 0x00, 0x19, 0x99, 0x80, 0x1B, 0x0D, 0x80, 0x1E, 0x07, 0x80, 0x1C, 0x03, 0x80, 0x18,
+	0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,
+	0x00, 0x18, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1E, 0x01, 0x80, 0x1B, 0x81, 0x80, 0x01, 0xC1, 0x80,
+	0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x19, 0xC1, 0x80, 0x1B, 0x81, 0x80, 0x1E, 0x01, 0x80, 0x1C,
+	0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x1F, 0x87, 0x80, 0x1F, 0x8D, 0x80, 0x18, 0x19, 0x80,
+	0x18, 0x31, 0x80, 0x18, 0x61, 0x80, 0x18, 0xC1, 0x80, 0x19, 0x81, 0x80, 0x1B, 0x01, 0x80, 0x1E,
+	0x1F, 0x80, 0x1C, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x30, 0x00, 0x30, 0x30,
+	0x00, 0x30, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+	0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00,
+	0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x3F, 0xFF, 0xF0, 0x3F,
+	0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38,
+	0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x01, 0x1F, 0x00, 0x03,
+	0x19, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x33,
+	0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x3F,
+	0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x01, 0x83, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01,
+	0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7C, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x7C, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xC7, 0x00, 0x01, 0x83, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01,
+	0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 0x80, 0x03, 0xE7, 0x00,
+	0x03, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x83, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01,
+	0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x33, 0x01, 0x80, 0x31, 0x83, 0x00, 0x3F, 0xFF, 0x80,
+	0x3F, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xB3, 0x00, 0x03, 0x31,
+	0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80,
+	0x01, 0xB1, 0x80, 0x01, 0xF3, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01,
+	0x80, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x33, 0x01, 0x80, 0x33, 0x01, 0x80, 0x33, 0x01, 0x80,
+	0x33, 0x01, 0x80, 0x33, 0x01, 0x80, 0x33, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF,
+	0x00, 0x01, 0x83, 0x0C, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x8C,
+	0x03, 0x01, 0x8C, 0x01, 0x83, 0x18, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x03, 0x00, 0x00, 0x03,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x01, 0x80, 0x30, 0x01,
+	0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x01, 0x81, 0x80, 0x03, 0x01, 0x80, 0x03, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x81, 0x80, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00,
+	0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80,
+	0x33, 0xFF, 0x80, 0x33, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,
+	0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C,
+	0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x33, 0x00, 0x0C, 0x33, 0x00, 0x18, 0x03, 0xFF, 0xF8, 0x03,
+	0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x3F, 0xFF, 0x80,
+	0x3F, 0xFF, 0x80, 0x00, 0x38, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xEE, 0x00, 0x03, 0x87, 0x80, 0x03,
+	0x03, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x30, 0x01, 0x80,
+	0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x00,
+	0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0xFF, 0x80,
+	0x03, 0xFF, 0x80, 0x01, 0x81, 0x80, 0x03, 0x01, 0x80, 0x03, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x01,
+	0xFF, 0x80, 0x03, 0x81, 0x80, 0x03, 0x01, 0x80, 0x03, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF,
+	0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x80,
+	0x03, 0x01, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x01, 0x81, 0x80, 0x03, 0x01, 0x80, 0x03,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x81, 0x80, 0x01, 0xFF, 0x80, 0x00, 0xFF,
+	0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xC7, 0x00, 0x01, 0x83, 0x00, 0x03,
+	0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 0x00, 0x01, 0xC7,
+	0x00, 0x00, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x01,
+	0x83, 0x0C, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01,
+	0x80, 0x01, 0x83, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0x01,
+	0x83, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x8C, 0x03, 0x01,
+	0x8C, 0x01, 0x83, 0x0C, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03,
+	0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0xC1, 0x80, 0x01, 0x81,
+	0x80, 0x03, 0x81, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x80, 0x00, 0x01, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0xE7, 0x80, 0x01, 0xF7, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31,
+	0x80, 0x03, 0x39, 0x80, 0x03, 0x19, 0x80, 0x03, 0x1B, 0x80, 0x03, 0xDF, 0x00, 0x03, 0xCE, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0x01,
+	0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x03, 0x80,
+	0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01,
+	0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x03, 0x00,
+	0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xF0,
+	0x00, 0x03, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x0F, 0x80,
+	0x03, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xFE,
+	0x00, 0x03, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x7C, 0x00,
+	0x00, 0x0F, 0x80, 0x03, 0x1F, 0x80, 0x03, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01,
+	0x80, 0x03, 0x01, 0x80, 0x03, 0x83, 0x80, 0x03, 0xC7, 0x80, 0x03, 0x6D, 0x80, 0x00, 0x38, 0x00,
+	0x00, 0x38, 0x00, 0x03, 0x6D, 0x80, 0x03, 0xC7, 0x80, 0x03, 0x83, 0x80, 0x03, 0x01, 0x80, 0x03,
+	0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x03, 0x00, 0x0C, 0x03, 0x80, 0x0C, 0x03, 0xE0, 0x0C, 0x03, 0x78, 0x0C, 0x03, 0x1E, 0x1C,
+	0x00, 0x07, 0x7C, 0x00, 0x03, 0xEC, 0x00, 0x07, 0x8C, 0x00, 0x1E, 0x00, 0x03, 0x78, 0x00, 0x03,
+	0xE0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x80, 0x03, 0xC3, 0x80, 0x03, 0x07, 0x80,
+	0x03, 0x0D, 0x80, 0x03, 0x19, 0x80, 0x03, 0x31, 0x80, 0x03, 0x61, 0x80, 0x03, 0xC1, 0x80, 0x03,
+	0x87, 0x80, 0x03, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x38, 0x00, 0x1F, 0xFF, 0xE0, 0x3F, 0xEF, 0xF0, 0x30, 0x00, 0x30, 0x30,
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x3F, 0xEF, 0xF0, 0x1F,
+	0xFF, 0xE0, 0x00, 0x38, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00,
+	0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00,
+};
+#endif
+
+sFONT Font24 = {
+  NULL,
+  17, /* Width */
+  24, /* Height */
+  NULL,
+  Font24_Packed,
+  NULL,
+};
+
+#endif
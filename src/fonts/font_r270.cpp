@@ -0,0 +1,6110 @@
+/**
+  ******************************************************************************
+  * @file    font_r270.cpp
+  * @brief   Font8-Font24 glyphs pre-rotated for ROTATE_270, one column per line.
+  *          Generated by extras/font_r270.py from the font*.cpp tables, do not edit.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.h"
+
+// 5x8, 1 byte(s) per column
+const uint8_t Font8_Table_R270[] = 
+{
+	// @0 ' ' (5 columns)
+	0x00, //        
+	0x00, //        
+	0x00, //        
+	0x00, //        
+	0x00, //        
+
+	// @5 '!' (5 columns)
+	0x00, //        
+	0x00, //        
+	0xF4, //#### #  
+	0x00, //        
+	0x00, //        
+
+	// @10 '"' (5 columns)
+	0x00, //        
+	0xC0, //##      
+	0x00, //        
+	0xC0, //##      
+	0x00, //        
+
+	// @15 '#' (5 columns)
+	0x2A, //  # # # 
+	0x7C, // #####  
+	0xAA, //# # # # 
+	0x7C, // #####  
+	0xA8, //# # #   
+
+	// @20 '$' (5 columns)
+	0x00, //        
+	0x24, //  #  #  
+	0xF6, //#### ## 
+	0x58, // # ##   
+	0x00, //        
+
+	// @25 '%' (5 columns)
+	0x00, //        
+	0x10, //   #    
+	0xD0, //## #    
+	0x2C, //  # ##  
+	0x20, //  #     
+
+	// @30 '&' (5 columns)
+	0x00, //        
+	0x1C, //   ###  
+	0x74, // ### #  
+	0x4C, // #  ##  
+	0x44, // #   #  
+
+	// @35 ''' (5 columns)
+	0x00, //        
+	0x00, //        
+	0xE0, //###     
+	0x00, //        
+	0x00, //        
+
+	// @40 '(' (5 columns)
+	0x00, //        
+	0x00, //        
+	0x7C, // #####  
+	0x82, //#     # 
+	0x00, //        
+
+	// @45 ')' (5 columns)
+	0x00, //        
+	0x82, //#     # 
+	0x7C, // #####  
+	0x00, //        
+	0x00, //        
+
+	// @50 '*' (5 columns)
+	0x00, //        
+	0x50, // # #    
+	0xE0, //###     
+	0x50, // # #    
+	0x00, //        
+
+	// @55 '+' (5 columns)
+	0x10, //   #    
+	0x10, //   #    
+	0x7C, // #####  
+	0x10, //   #    
+	0x10, //   #    
+
+	// @60 ',' (5 columns)
+	0x00, //        
+	0x00, //        
+	0x06, //     ## 
+	0x08, //    #   
+	0x00, //        
+
+	// @65 '-' (5 columns)
+	0x00, //        
+	0x10, //   #    
+	0x10, //   #    
+	0x10, //   #    
+	0x00, //        
+
+	// @70 '.' (5 columns)
+	0x00, //        
+	0x00, //        
+	0x04, //     #  
+	0x00, //        
+	0x00, //        
+
+	// @75 '/' (5 columns)
+	0x02, //      # 
+	0x0C, //    ##  
+	0x70, // ###    
+	0x80, //#       
+	0x00, //        
+
+	// @80 '0' (5 columns)
+	0x00, //        
+	0x78, // ####   
+	0x84, //#    #  
+	0x78, // ####   
+	0x00, //        
+
+	// @85 '1' (5 columns)
+	0x04, //     #  
+	0x84, //#    #  
+	0xFC, //######  
+	0x04, //     #  
+	0x04, //     #  
+
+	// @90 '2' (5 columns)
+	0x00, //        
+	0x4C, // #  ##  
+	0xB4, //# ## #  
+	0x44, // #   #  
+	0x00, //        
+
+	// @95 '3' (5 columns)
+	0x00, //        
+	0x44, // #   #  
+	0x94, //#  # #  
+	0x68, // ## #   
+	0x00, //        
+
+	// @100 '4' (5 columns)
+	0x00, //        
+	0x30, //  ##    
+	0x54, // # # #  
+	0xFC, //######  
+	0x14, //   # #  
+
+	// @105 '5' (5 columns)
+	0x00, //        
+	0xE8, //### #   
+	0xA4, //# #  #  
+	0x98, //#  ##   
+	0x00, //        
+
+	// @110 '6' (5 columns)
+	0x00, //        
+	0x7C, // #####  
+	0xA4, //# #  #  
+	0x98, //#  ##   
+	0x00, //        
+
+	// @115 '7' (5 columns)
+	0x00, //        
+	0xC0, //##      
+	0x9C, //#  ###  
+	0xE0, //###     
+	0x00, //        
+
+	// @120 '8' (5 columns)
+	0x00, //        
+	0x58, // # ##   
+	0xA4, //# #  #  
+	0x58, // # ##   
+	0x00, //        
+
+	// @125 '9' (5 columns)
+	0x00, //        
+	0x64, // ##  #  
+	0x94, //#  # #  
+	0xF8, //#####   
+	0x00, //        
+
+	// @130 ':' (5 columns)
+	0x00, //        
+	0x00, //        
+	0x24, //  #  #  
+	0x00, //        
+	0x00, //        
+
+	// @135 ';' (5 columns)
+	0x00, //        
+	0x00, //        
+	0x04, //     #  
+	0x28, //  # #   
+	0x00, //        
+
+	// @140 '<' (5 columns)
+	0x10, //   #    
+	0x10, //   #    
+	0x28, //  # #   
+	0x44, // #   #  
+	0x00, //        
+
+	// @145 '=' (5 columns)
+	0x00, //        
+	0x50, // # #    
+	0x50, // # #    
+	0x50, // # #    
+	0x00, //        
+
+	// @150 '>' (5 columns)
+	0x00, //        
+	0x44, // #   #  
+	0x28, //  # #   
+	0x10, //   #    
+	0x10, //   #    
+
+	// @155 '?' (5 columns)
+	0x00, //        
+	0x40, // #      
+	0x94, //#  # #  
+	0x60, // ##     
+	0x00, //        
+
+	// @160 '@' (5 columns)
+	0x00, //        
+	0x7C, // #####  
+	0x82, //#     # 
+	0x92, //#  #  # 
+	0x7A, // #### # 
+
+	// @165 'A' (5 columns)
+	0x0C, //    ##  
+	0xB4, //# ## #  
+	0xD0, //## #    
+	0x34, //  ## #  
+	0x0C, //    ##  
+
+	// @170 'B' (5 columns)
+	0x84, //#    #  
+	0xFC, //######  
+	0xA4, //# #  #  
+	0xA4, //# #  #  
+	0x58, // # ##   
+
+	// @175 'C' (5 columns)
+	0x00, //        
+	0xF8, //#####   
+	0x84, //#    #  
+	0xC4, //##   #  
+	0x00, //        
+
+	// @180 'D' (5 columns)
+	0x84, //#    #  
+	0xFC, //######  
+	0x84, //#    #  
+	0x84, //#    #  
+	0x78, // ####   
+
+	// @185 'E' (5 columns)
+	0x84, //#    #  
+	0xFC, //######  
+	0xA4, //# #  #  
+	0x84, //#    #  
+	0xCC, //##  ##  
+
+	// @190 'F' (5 columns)
+	0x84, //#    #  
+	0xFC, //######  
+	0xA4, //# #  #  
+	0x80, //#       
+	0xC0, //##      
+
+	// @195 'G' (5 columns)
+	0x00, //        
+	0xF8, //#####   
+	0x84, //#    #  
+	0x9C, //#  ###  
+	0x10, //   #    
+
+	// @200 'H' (5 columns)
+	0x84, //#    #  
+	0xFC, //######  
+	0xA4, //# #  #  
+	0x20, //  #     
+	0xFC, //######  
+
+	// @205 'I' (5 columns)
+	0x00, //        
+	0x84, //#    #  
+	0xFC, //######  
+	0x84, //#    #  
+	0x00, //        
+
+	// @210 'J' (5 columns)
+	0x00, //        
+	0x18, //   ##   
+	0x84, //#    #  
+	0xF8, //#####   
+	0x80, //#       
+
+	// @215 'K' (5 columns)
+	0x84, //#    #  
+	0xFC, //######  
+	0x30, //  ##    
+	0xDC, //## ###  
+	0x84, //#    #  
+
+	// @220 'L' (5 columns)
+	0x84, //#    #  
+	0xFC, //######  
+	0x84, //#    #  
+	0x04, //     #  
+	0x0C, //    ##  
+
+	// @225 'M' (5 columns)
+	0xFC, //######  
+	0xE4, //###  #  
+	0x10, //   #    
+	0xE4, //###  #  
+	0xFC, //######  
+
+	// @230 'N' (5 columns)
+	0x84, //#    #  
+	0xFC, //######  
+	0x64, // ##  #  
+	0x98, //#  ##   
+	0xFC, //######  
+
+	// @235 'O' (5 columns)
+	0x00, //        
+	0x78, // ####   
+	0x84, //#    #  
+	0x84, //#    #  
+	0x78, // ####   
+
+	// @240 'P' (5 columns)
+	0x84, //#    #  
+	0xFC, //######  
+	0x94, //#  # #  
+	0x90, //#  #    
+	0x60, // ##     
+
+	// @245 'Q' (5 columns)
+	0x00, //        
+	0x78, // ####   
+	0x84, //#    #  
+	0x86, //#    ## 
+	0x7A, // #### # 
+
+	// @250 'R' (5 columns)
+	0x84, //#    #  
+	0xFC, //######  
+	0x94, //#  # #  
+	0x90, //#  #    
+	0x6C, // ## ##  
+
+	// @255 'S' (5 columns)
+	0x00, //        
+	0xCC, //##  ##  
+	0xA4, //# #  #  
+	0xDC, //## ###  
+	0x00, //        
+
+	// @260 'T' (5 columns)
+	0xC0, //##      
+	0x84, //#    #  
+	0xFC, //######  
+	0x84, //#    #  
+	0xC0, //##      
+
+	// @265 'U' (5 columns)
+	0x80, //#       
+	0xF8, //#####   
+	0x04, //     #  
+	0x84, //#    #  
+	0xF8, //#####   
+
+	// @270 'V' (5 columns)
+	0xC0, //##      
+	0xB8, //# ###   
+	0x04, //     #  
+	0x9C, //#  ###  
+	0xE0, //###     
+
+	// @275 'W' (5 columns)
+	0xF8, //#####   
+	0x84, //#    #  
+	0x38, //  ###   
+	0x84, //#    #  
+	0xF8, //#####   
+
+	// @280 'X' (5 columns)
+	0x84, //#    #  
+	0xCC, //##  ##  
+	0x30, //  ##    
+	0xCC, //##  ##  
+	0x84, //#    #  
+
+	// @285 'Y' (5 columns)
+	0xC0, //##      
+	0xA4, //# #  #  
+	0x1C, //   ###  
+	0xA4, //# #  #  
+	0xC0, //##      
+
+	// @290 'Z' (5 columns)
+	0x00, //        
+	0xCC, //##  ##  
+	0x94, //#  # #  
+	0xA4, //# #  #  
+	0xCC, //##  ##  
+
+	// @295 '[' (5 columns)
+	0x00, //        
+	0x00, //        
+	0xFE, //####### 
+	0x82, //#     # 
+	0x00, //        
+
+	// @300 '\' (5 columns)
+	0x80, //#       
+	0x60, // ##     
+	0x1C, //   ###  
+	0x02, //      # 
+	0x00, //        
+
+	// @305 ']' (5 columns)
+	0x00, //        
+	0x82, //#     # 
+	0xFE, //####### 
+	0x00, //        
+	0x00, //        
+
+	// @310 '^' (5 columns)
+	0x00, //        
+	0x20, //  #     
+	0xC0, //##      
+	0x20, //  #     
+	0x00, //        
+
+	// @315 '_' (5 columns)
+	0x01, //       #
+	0x01, //       #
+	0x01, //       #
+	0x01, //       #
+	0x01, //       #
+
+	// @320 '`' (5 columns)
+	0x00, //        
+	0x00, //        
+	0x80, //#       
+	0x40, // #      
+	0x00, //        
+
+	// @325 'a' (5 columns)
+	0x00, //        
+	0x0C, //    ##  
+	0x2C, //  # ##  
+	0x3C, //  ####  
+	0x04, //     #  
+
+	// @330 'b' (5 columns)
+	0x84, //#    #  
+	0xFC, //######  
+	0x24, //  #  #  
+	0x24, //  #  #  
+	0x18, //   ##   
+
+	// @335 'c' (5 columns)
+	0x00, //        
+	0x3C, //  ####  
+	0x24, //  #  #  
+	0x24, //  #  #  
+	0x00, //        
+
+	// @340 'd' (5 columns)
+	0x00, //        
+	0x18, //   ##   
+	0x24, //  #  #  
+	0xA4, //# #  #  
+	0xFC, //######  
+
+	// @345 'e' (5 columns)
+	0x00, //        
+	0x38, //  ###   
+	0x34, //  ## #  
+	0x34, //  ## #  
+	0x00, //        
+
+	// @350 'f' (5 columns)
+	0x00, //        
+	0x24, //  #  #  
+	0x7C, // #####  
+	0xA4, //# #  #  
+	0x00, //        
+
+	// @355 'g' (5 columns)
+	0x00, //        
+	0x18, //   ##   
+	0x25, //  #  # #
+	0x25, //  #  # #
+	0x3E, //  ##### 
+
+	// @360 'h' (5 columns)
+	0x84, //#    #  
+	0xFC, //######  
+	0x24, //  #  #  
+	0x20, //  #     
+	0x1C, //   ###  
+
+	// @365 'i' (5 columns)
+	0x00, //        
+	0x24, //  #  #  
+	0xBC, //# ####  
+	0x04, //     #  
+	0x00, //        
+
+	// @370 'j' (5 columns)
+	0x00, //        
+	0x21, //  #    #
+	0xA1, //# #    #
+	0x3F, //  ######
+	0x00, //        
+
+	// @375 'k' (5 columns)
+	0x84, //#    #  
+	0xFC, //######  
+	0x10, //   #    
+	0x3C, //  ####  
+	0x24, //  #  #  
+
+	// @380 'l' (5 columns)
+	0x00, //        
+	0x84, //#    #  
+	0xFC, //######  
+	0x04, //     #  
+	0x00, //        
+
+	// @385 'm' (5 columns)
+	0x3C, //  ####  
+	0x20, //  #     
+	0x1C, //   ###  
+	0x20, //  #     
+	0x1C, //   ###  
+
+	// @390 'n' (5 columns)
+	0x24, //  #  #  
+	0x3C, //  ####  
+	0x20, //  #     
+	0x20, //  #     
+	0x1C, //   ###  
+
+	// @395 'o' (5 columns)
+	0x00, //        
+	0x18, //   ##   
+	0x24, //  #  #  
+	0x24, //  #  #  
+	0x18, //   ##   
+
+	// @400 'p' (5 columns)
+	0x21, //  #    #
+	0x3F, //  ######
+	0x25, //  #  # #
+	0x24, //  #  #  
+	0x18, //   ##   
+
+	// @405 'q' (5 columns)
+	0x00, //        
+	0x18, //   ##   
+	0x24, //  #  #  
+	0x25, //  #  # #
+	0x3F, //  ######
+
+	// @410 'r' (5 columns)
+	0x00, //        
+	0x24, //  #  #  
+	0x3C, //  ####  
+	0x24, //  #  #  
+	0x20, //  #     
+
+	// @415 's' (5 columns)
+	0x00, //        
+	0x04, //     #  
+	0x34, //  ## #  
+	0x28, //  # #   
+	0x00, //        
+
+	// @420 't' (5 columns)
+	0x20, //  #     
+	0x78, // ####   
+	0x24, //  #  #  
+	0x24, //  #  #  
+	0x08, //    #   
+
+	// @425 'u' (5 columns)
+	0x20, //  #     
+	0x38, //  ###   
+	0x04, //     #  
+	0x24, //  #  #  
+	0x3C, //  ####  
+
+	// @430 'v' (5 columns)
+	0x20, //  #     
+	0x30, //  ##    
+	0x0C, //    ##  
+	0x0C, //    ##  
+	0x30, //  ##    
+
+	// @435 'w' (5 columns)
+	0x38, //  ###   
+	0x24, //  #  #  
+	0x18, //   ##   
+	0x24, //  #  #  
+	0x38, //  ###   
+
+	// @440 'x' (5 columns)
+	0x00, //        
+	0x24, //  #  #  
+	0x18, //   ##   
+	0x18, //   ##   
+	0x24, //  #  #  
+
+	// @445 'y' (5 columns)
+	0x20, //  #     
+	0x39, //  ###  #
+	0x07, //     ###
+	0x38, //  ###   
+	0x20, //  #     
+
+	// @450 'z' (5 columns)
+	0x00, //        
+	0x34, //  ## #  
+	0x2C, //  # ##  
+	0x34, //  ## #  
+	0x2C, //  # ##  
+
+	// @455 '{' (5 columns)
+	0x00, //        
+	0x10, //   #    
+	0x7C, // #####  
+	0x82, //#     # 
+	0x00, //        
+
+	// @460 '|' (5 columns)
+	0x00, //        
+	0x00, //        
+	0xFE, //####### 
+	0x00, //        
+	0x00, //        
+
+	// @465 '}' (5 columns)
+	0x00, //        
+	0x82, //#     # 
+	0x7C, // #####  
+	0x10, //   #    
+	0x00, //        
+
+	// @470 '~' (5 columns)
+	0x00, //        
+	0x08, //    #   
+	0x10, //   #    
+	0x08, //    #   
+	0x10, //   #    
+};
+
+// 7x12, 2 byte(s) per column
+const uint8_t Font12_Table_R270[] = 
+{
+	// @0 ' ' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @14 '!' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x7C, 0x80, // #####  #   
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @28 '"' (7 columns)
+	0x00, 0x00, //            
+	0x70, 0x00, // ###        
+	0x40, 0x00, // #          
+	0x00, 0x00, //            
+	0x70, 0x00, // ###        
+	0x40, 0x00, // #          
+	0x00, 0x00, //            
+
+	// @42 '#' (7 columns)
+	0x00, 0x00, //            
+	0x0A, 0xC0, //    # # ##  
+	0x1F, 0x00, //   #####    
+	0x6A, 0xC0, // ## # # ##  
+	0x1F, 0x00, //   #####    
+	0x6A, 0x00, // ## # #     
+	0x00, 0x00, //            
+
+	// @56 '$' (7 columns)
+	0x00, 0x00, //            
+	0x1B, 0x00, //   ## ##    
+	0x25, 0x00, //  #  # #    
+	0x65, 0xC0, // ##  # ###  
+	0x26, 0x00, //  #  ##     
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @70 '%' (7 columns)
+	0x00, 0x00, //            
+	0x24, 0x00, //  #  #      
+	0x54, 0x00, // # # #      
+	0x25, 0x00, //  #  # #    
+	0x0A, 0x80, //    # # #   
+	0x09, 0x00, //    #  #    
+	0x00, 0x00, //            
+
+	// @84 '&' (7 columns)
+	0x00, 0x00, //            
+	0x03, 0x00, //      ##    
+	0x0C, 0x80, //    ##  #   
+	0x12, 0x80, //   #  # #   
+	0x11, 0x00, //   #   #    
+	0x02, 0x80, //      # #   
+	0x00, 0x00, //            
+
+	// @98 ''' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x78, 0x00, // ####       
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @112 '(' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x1F, 0x80, //   ######   
+	0x60, 0x60, // ##      ## 
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @126 ')' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x60, 0x60, // ##      ## 
+	0x1F, 0x80, //   ######   
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @140 '*' (7 columns)
+	0x00, 0x00, //            
+	0x20, 0x00, //  #         
+	0x2C, 0x00, //  # ##      
+	0x70, 0x00, // ###        
+	0x2C, 0x00, //  # ##      
+	0x20, 0x00, //  #         
+	0x00, 0x00, //            
+
+	// @154 '+' (7 columns)
+	0x04, 0x00, //     #      
+	0x04, 0x00, //     #      
+	0x04, 0x00, //     #      
+	0x3F, 0x80, //  #######   
+	0x04, 0x00, //     #      
+	0x04, 0x00, //     #      
+	0x04, 0x00, //     #      
+
+	// @168 ',' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x60, //         ## 
+	0x01, 0xC0, //       ###  
+	0x01, 0x00, //       #    
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @182 '-' (7 columns)
+	0x00, 0x00, //            
+	0x04, 0x00, //     #      
+	0x04, 0x00, //     #      
+	0x04, 0x00, //     #      
+	0x04, 0x00, //     #      
+	0x04, 0x00, //     #      
+	0x00, 0x00, //            
+
+	// @196 '.' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x01, 0x80, //       ##   
+	0x01, 0x80, //       ##   
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @210 '/' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x40, //         #  
+	0x01, 0x80, //       ##   
+	0x06, 0x00, //     ##     
+	0x18, 0x00, //   ##       
+	0x60, 0x00, // ##         
+	0x00, 0x00, //            
+
+	// @224 '0' (7 columns)
+	0x00, 0x00, //            
+	0x3F, 0x00, //  ######    
+	0x40, 0x80, // #      #   
+	0x40, 0x80, // #      #   
+	0x40, 0x80, // #      #   
+	0x3F, 0x00, //  ######    
+	0x00, 0x00, //            
+
+	// @238 '1' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x80, //        #   
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x00, 0x80, //        #   
+	0x00, 0x80, //        #   
+	0x00, 0x00, //            
+
+	// @252 '2' (7 columns)
+	0x00, 0x00, //            
+	0x21, 0x80, //  #    ##   
+	0x42, 0x80, // #    # #   
+	0x44, 0x80, // #   #  #   
+	0x48, 0x80, // #  #   #   
+	0x31, 0x80, //  ##   ##   
+	0x00, 0x00, //            
+
+	// @266 '3' (7 columns)
+	0x00, 0x00, //            
+	0x21, 0x00, //  #    #    
+	0x40, 0x80, // #      #   
+	0x48, 0x80, // #  #   #   
+	0x48, 0x80, // #  #   #   
+	0x37, 0x00, //  ## ###    
+	0x00, 0x00, //            
+
+	// @280 '4' (7 columns)
+	0x00, 0x00, //            
+	0x06, 0x00, //     ##     
+	0x0A, 0x00, //    # #     
+	0x32, 0x00, //  ##  #     
+	0x42, 0x80, // #    # #   
+	0x7F, 0x80, // ########   
+	0x02, 0x80, //      # #   
+
+	// @294 '5' (7 columns)
+	0x00, 0x00, //            
+	0x01, 0x00, //       #    
+	0x78, 0x80, // ####   #   
+	0x48, 0x80, // #  #   #   
+	0x48, 0x80, // #  #   #   
+	0x47, 0x00, // #   ###    
+	0x00, 0x00, //            
+
+	// @308 '6' (7 columns)
+	0x00, 0x00, //            
+	0x1F, 0x00, //   #####    
+	0x28, 0x80, //  # #   #   
+	0x48, 0x80, // #  #   #   
+	0x48, 0x80, // #  #   #   
+	0x47, 0x00, // #   ###    
+	0x00, 0x00, //            
+
+	// @322 '7' (7 columns)
+	0x00, 0x00, //            
+	0x60, 0x00, // ##         
+	0x40, 0x00, // #          
+	0x41, 0x80, // #     ##   
+	0x4E, 0x00, // #  ###     
+	0x70, 0x00, // ###        
+	0x00, 0x00, //            
+
+	// @336 '8' (7 columns)
+	0x00, 0x00, //            
+	0x37, 0x00, //  ## ###    
+	0x48, 0x80, // #  #   #   
+	0x48, 0x80, // #  #   #   
+	0x48, 0x80, // #  #   #   
+	0x37, 0x00, //  ## ###    
+	0x00, 0x00, //            
+
+	// @350 '9' (7 columns)
+	0x00, 0x00, //            
+	0x38, 0x80, //  ###   #   
+	0x44, 0x80, // #   #  #   
+	0x44, 0x80, // #   #  #   
+	0x45, 0x00, // #   # #    
+	0x3E, 0x00, //  #####     
+	0x00, 0x00, //            
+
+	// @364 ':' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x19, 0x80, //   ##  ##   
+	0x19, 0x80, //   ##  ##   
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @378 ';' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0xC0, //        ##  
+	0x19, 0x80, //   ##  ##   
+	0x19, 0x00, //   ##  #    
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @392 '<' (7 columns)
+	0x04, 0x00, //     #      
+	0x0A, 0x00, //    # #     
+	0x0A, 0x00, //    # #     
+	0x11, 0x00, //   #   #    
+	0x20, 0x80, //  #     #   
+	0x20, 0x80, //  #     #   
+	0x00, 0x00, //            
+
+	// @406 '=' (7 columns)
+	0x00, 0x00, //            
+	0x0A, 0x00, //    # #     
+	0x0A, 0x00, //    # #     
+	0x0A, 0x00, //    # #     
+	0x0A, 0x00, //    # #     
+	0x0A, 0x00, //    # #     
+	0x00, 0x00, //            
+
+	// @420 '>' (7 columns)
+	0x20, 0x80, //  #     #   
+	0x20, 0x80, //  #     #   
+	0x11, 0x00, //   #   #    
+	0x0A, 0x00, //    # #     
+	0x0A, 0x00, //    # #     
+	0x04, 0x00, //     #      
+	0x00, 0x00, //            
+
+	// @434 '?' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x10, 0x80, //   #    #   
+	0x22, 0x80, //  #   # #   
+	0x24, 0x00, //  #  #      
+	0x18, 0x00, //   ##       
+	0x00, 0x00, //            
+
+	// @448 '@' (7 columns)
+	0x00, 0x00, //            
+	0x7F, 0x80, // ########   
+	0x80, 0x40, //#        #  
+	0x8C, 0x40, //#   ##   #  
+	0x92, 0x40, //#  #  #  #  
+	0x7E, 0x80, // ###### #   
+	0x00, 0x00, //            
+
+	// @462 'A' (7 columns)
+	0x00, 0x80, //        #   
+	0x03, 0x80, //      ###   
+	0x5E, 0x80, // # #### #   
+	0x62, 0x00, // ##   #     
+	0x1E, 0x80, //   #### #   
+	0x03, 0x80, //      ###   
+	0x00, 0x80, //        #   
+
+	// @476 'B' (7 columns)
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x48, 0x80, // #  #   #   
+	0x48, 0x80, // #  #   #   
+	0x48, 0x80, // #  #   #   
+	0x37, 0x00, //  ## ###    
+	0x00, 0x00, //            
+
+	// @490 'C' (7 columns)
+	0x00, 0x00, //            
+	0x3F, 0x00, //  ######    
+	0x40, 0x80, // #      #   
+	0x40, 0x80, // #      #   
+	0x40, 0x80, // #      #   
+	0x61, 0x00, // ##    #    
+	0x00, 0x00, //            
+
+	// @504 'D' (7 columns)
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x40, 0x80, // #      #   
+	0x40, 0x80, // #      #   
+	0x21, 0x00, //  #    #    
+	0x1E, 0x00, //   ####     
+	0x00, 0x00, //            
+
+	// @518 'E' (7 columns)
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x48, 0x80, // #  #   #   
+	0x5C, 0x80, // # ###  #   
+	0x40, 0x80, // #      #   
+	0x61, 0x80, // ##    ##   
+	0x00, 0x00, //            
+
+	// @532 'F' (7 columns)
+	0x00, 0x00, //            
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x48, 0x80, // #  #   #   
+	0x5C, 0x00, // # ###      
+	0x40, 0x00, // #          
+	0x60, 0x00, // ##         
+
+	// @546 'G' (7 columns)
+	0x00, 0x00, //            
+	0x3F, 0x00, //  ######    
+	0x40, 0x80, // #      #   
+	0x40, 0x80, // #      #   
+	0x44, 0x80, // #   #  #   
+	0x67, 0x00, // ##  ###    
+	0x04, 0x00, //     #      
+
+	// @560 'H' (7 columns)
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x48, 0x80, // #  #   #   
+	0x08, 0x00, //    #       
+	0x48, 0x80, // #  #   #   
+	0x7F, 0x80, // ########   
+	0x40, 0x80, // #      #   
+
+	// @574 'I' (7 columns)
+	0x00, 0x00, //            
+	0x40, 0x80, // #      #   
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x40, 0x80, // #      #   
+	0x40, 0x80, // #      #   
+	0x00, 0x00, //            
+
+	// @588 'J' (7 columns)
+	0x00, 0x00, //            
+	0x07, 0x00, //     ###    
+	0x40, 0x80, // #      #   
+	0x40, 0x80, // #      #   
+	0x7F, 0x00, // #######    
+	0x40, 0x00, // #          
+	0x00, 0x00, //            
+
+	// @602 'K' (7 columns)
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x44, 0x80, // #   #  #   
+	0x0C, 0x00, //    ##      
+	0x52, 0x00, // # #  #     
+	0x61, 0x80, // ##    ##   
+	0x40, 0x80, // #      #   
+
+	// @616 'L' (7 columns)
+	0x00, 0x00, //            
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x40, 0x80, // #      #   
+	0x00, 0x80, //        #   
+	0x03, 0x80, //      ###   
+	0x00, 0x00, //            
+
+	// @630 'M' (7 columns)
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x70, 0x80, // ###    #   
+	0x0C, 0x00, //    ##      
+	0x70, 0x80, // ###    #   
+	0x7F, 0x80, // ########   
+	0x40, 0x80, // #      #   
+
+	// @644 'N' (7 columns)
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x70, 0x80, // ###    #   
+	0x0E, 0x00, //    ###     
+	0x41, 0x80, // #     ##   
+	0x7F, 0x80, // ########   
+	0x40, 0x00, // #          
+
+	// @658 'O' (7 columns)
+	0x00, 0x00, //            
+	0x3F, 0x00, //  ######    
+	0x40, 0x80, // #      #   
+	0x40, 0x80, // #      #   
+	0x40, 0x80, // #      #   
+	0x3F, 0x00, //  ######    
+	0x00, 0x00, //            
+
+	// @672 'P' (7 columns)
+	0x00, 0x00, //            
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x44, 0x80, // #   #  #   
+	0x44, 0x00, // #   #      
+	0x38, 0x00, //  ###       
+	0x00, 0x00, //            
+
+	// @686 'Q' (7 columns)
+	0x00, 0x00, //            
+	0x3F, 0x00, //  ######    
+	0x40, 0x80, // #      #   
+	0x40, 0xC0, // #      ##  
+	0x40, 0xC0, // #      ##  
+	0x3F, 0x40, //  ###### #  
+	0x00, 0x00, //            
+
+	// @700 'R' (7 columns)
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x44, 0x80, // #   #  #   
+	0x44, 0x00, // #   #      
+	0x46, 0x00, // #   ##     
+	0x39, 0x00, //  ###  #    
+	0x00, 0x80, //        #   
+
+	// @714 'S' (7 columns)
+	0x00, 0x00, //            
+	0x31, 0x80, //  ##   ##   
+	0x49, 0x00, // #  #  #    
+	0x48, 0x80, // #  #   #   
+	0x28, 0x80, //  # #   #   
+	0x67, 0x00, // ##  ###    
+	0x00, 0x00, //            
+
+	// @728 'T' (7 columns)
+	0x60, 0x00, // ##         
+	0x40, 0x00, // #          
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x40, 0x80, // #      #   
+	0x40, 0x00, // #          
+	0x60, 0x00, // ##         
+
+	// @742 'U' (7 columns)
+	0x40, 0x00, // #          
+	0x7F, 0x00, // #######    
+	0x40, 0x80, // #      #   
+	0x00, 0x80, //        #   
+	0x40, 0x80, // #      #   
+	0x7F, 0x00, // #######    
+	0x40, 0x00, // #          
+
+	// @756 'V' (7 columns)
+	0x40, 0x00, // #          
+	0x70, 0x00, // ###        
+	0x4E, 0x00, // #  ###     
+	0x01, 0x80, //       ##   
+	0x4E, 0x00, // #  ###     
+	0x70, 0x00, // ###        
+	0x40, 0x00, // #          
+
+	// @770 'W' (7 columns)
+	0x40, 0x00, // #          
+	0x7F, 0x00, // #######    
+	0x40, 0x80, // #      #   
+	0x0F, 0x00, //    ####    
+	0x40, 0x80, // #      #   
+	0x7F, 0x00, // #######    
+	0x40, 0x00, // #          
+
+	// @784 'X' (7 columns)
+	0x40, 0x80, // #      #   
+	0x61, 0x80, // ##    ##   
+	0x12, 0x00, //   #  #     
+	0x0C, 0x00, //    ##      
+	0x12, 0x00, //   #  #     
+	0x61, 0x80, // ##    ##   
+	0x40, 0x80, // #      #   
+
+	// @798 'Y' (7 columns)
+	0x40, 0x00, // #          
+	0x60, 0x00, // ##         
+	0x58, 0x80, // # ##   #   
+	0x07, 0x80, //     ####   
+	0x58, 0x80, // # ##   #   
+	0x60, 0x00, // ##         
+	0x40, 0x00, // #          
+
+	// @812 'Z' (7 columns)
+	0x00, 0x00, //            
+	0x61, 0x80, // ##    ##   
+	0x42, 0x80, // #    # #   
+	0x4C, 0x80, // #  ##  #   
+	0x50, 0x80, // # #    #   
+	0x61, 0x80, // ##    ##   
+	0x00, 0x00, //            
+
+	// @826 '[' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x7F, 0xE0, // ########## 
+	0x40, 0x20, // #        # 
+	0x40, 0x20, // #        # 
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @840 '\' (7 columns)
+	0x00, 0x00, //            
+	0x40, 0x00, // #          
+	0x38, 0x00, //  ###       
+	0x06, 0x00, //     ##     
+	0x01, 0xC0, //       ###  
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @854 ']' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x40, 0x20, // #        # 
+	0x40, 0x20, // #        # 
+	0x7F, 0xE0, // ########## 
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @868 '^' (7 columns)
+	0x00, 0x00, //            
+	0x08, 0x00, //    #       
+	0x10, 0x00, //   #        
+	0x60, 0x00, // ##         
+	0x10, 0x00, //   #        
+	0x08, 0x00, //    #       
+	0x00, 0x00, //            
+
+	// @882 '_' (7 columns)
+	0x00, 0x10, //           #
+	0x00, 0x10, //           #
+	0x00, 0x10, //           #
+	0x00, 0x10, //           #
+	0x00, 0x10, //           #
+	0x00, 0x10, //           #
+	0x00, 0x10, //           #
+
+	// @896 '`' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x40, 0x00, // #          
+	0x20, 0x00, //  #         
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @910 'a' (7 columns)
+	0x00, 0x00, //            
+	0x0B, 0x00, //    # ##    
+	0x14, 0x80, //   # #  #   
+	0x14, 0x80, //   # #  #   
+	0x14, 0x80, //   # #  #   
+	0x0F, 0x80, //    #####   
+	0x00, 0x80, //        #   
+
+	// @924 'b' (7 columns)
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x08, 0x80, //    #   #   
+	0x10, 0x80, //   #    #   
+	0x10, 0x80, //   #    #   
+	0x0F, 0x00, //    ####    
+	0x00, 0x00, //            
+
+	// @938 'c' (7 columns)
+	0x00, 0x00, //            
+	0x0F, 0x00, //    ####    
+	0x10, 0x80, //   #    #   
+	0x10, 0x80, //   #    #   
+	0x10, 0x80, //   #    #   
+	0x19, 0x00, //   ##  #    
+	0x00, 0x00, //            
+
+	// @952 'd' (7 columns)
+	0x00, 0x00, //            
+	0x0F, 0x00, //    ####    
+	0x10, 0x80, //   #    #   
+	0x10, 0x80, //   #    #   
+	0x48, 0x80, // #  #   #   
+	0x7F, 0x80, // ########   
+	0x00, 0x80, //        #   
+
+	// @966 'e' (7 columns)
+	0x00, 0x00, //            
+	0x0F, 0x00, //    ####    
+	0x14, 0x80, //   # #  #   
+	0x14, 0x80, //   # #  #   
+	0x14, 0x80, //   # #  #   
+	0x0C, 0x80, //    ##  #   
+	0x00, 0x00, //            
+
+	// @980 'f' (7 columns)
+	0x00, 0x00, //            
+	0x10, 0x80, //   #    #   
+	0x3F, 0x80, //  #######   
+	0x50, 0x80, // # #    #   
+	0x50, 0x80, // # #    #   
+	0x50, 0x80, // # #    #   
+	0x00, 0x00, //            
+
+	// @994 'g' (7 columns)
+	0x00, 0x00, //            
+	0x0F, 0x00, //    ####    
+	0x10, 0xA0, //   #    # # 
+	0x10, 0xA0, //   #    # # 
+	0x08, 0xA0, //    #   # # 
+	0x1F, 0xC0, //   #######  
+	0x10, 0x00, //   #        
+
+	// @1008 'h' (7 columns)
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x08, 0x80, //    #   #   
+	0x10, 0x00, //   #        
+	0x10, 0x80, //   #    #   
+	0x0F, 0x80, //    #####   
+	0x00, 0x80, //        #   
+
+	// @1022 'i' (7 columns)
+	0x00, 0x00, //            
+	0x10, 0x80, //   #    #   
+	0x10, 0x80, //   #    #   
+	0x5F, 0x80, // # ######   
+	0x00, 0x80, //        #   
+	0x00, 0x80, //        #   
+	0x00, 0x00, //            
+
+	// @1036 'j' (7 columns)
+	0x00, 0x00, //            
+	0x10, 0x20, //   #      # 
+	0x10, 0x20, //   #      # 
+	0x50, 0x20, // # #      # 
+	0x1F, 0xC0, //   #######  
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @1050 'k' (7 columns)
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x04, 0x00, //     #      
+	0x16, 0x80, //   # ## #   
+	0x19, 0x80, //   ##  ##   
+	0x10, 0x80, //   #    #   
+	0x00, 0x00, //            
+
+	// @1064 'l' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x80, //        #   
+	0x40, 0x80, // #      #   
+	0x7F, 0x80, // ########   
+	0x00, 0x80, //        #   
+	0x00, 0x80, //        #   
+	0x00, 0x00, //            
+
+	// @1078 'm' (7 columns)
+	0x10, 0x80, //   #    #   
+	0x1F, 0x80, //   ######   
+	0x10, 0x80, //   #    #   
+	0x0F, 0x80, //    #####   
+	0x10, 0x80, //   #    #   
+	0x0F, 0x80, //    #####   
+	0x00, 0x80, //        #   
+
+	// @1092 'n' (7 columns)
+	0x10, 0x80, //   #    #   
+	0x1F, 0x80, //   ######   
+	0x08, 0x80, //    #   #   
+	0x10, 0x00, //   #        
+	0x10, 0x80, //   #    #   
+	0x0F, 0x80, //    #####   
+	0x00, 0x80, //        #   
+
+	// @1106 'o' (7 columns)
+	0x00, 0x00, //            
+	0x0F, 0x00, //    ####    
+	0x10, 0x80, //   #    #   
+	0x10, 0x80, //   #    #   
+	0x10, 0x80, //   #    #   
+	0x0F, 0x00, //    ####    
+	0x00, 0x00, //            
+
+	// @1120 'p' (7 columns)
+	0x10, 0x20, //   #      # 
+	0x1F, 0xE0, //   ######## 
+	0x08, 0xA0, //    #   # # 
+	0x10, 0x80, //   #    #   
+	0x10, 0x80, //   #    #   
+	0x0F, 0x00, //    ####    
+	0x00, 0x00, //            
+
+	// @1134 'q' (7 columns)
+	0x00, 0x00, //            
+	0x0F, 0x00, //    ####    
+	0x10, 0x80, //   #    #   
+	0x10, 0x80, //   #    #   
+	0x08, 0xA0, //    #   # # 
+	0x1F, 0xE0, //   ######## 
+	0x10, 0x20, //   #      # 
+
+	// @1148 'r' (7 columns)
+	0x00, 0x00, //            
+	0x10, 0x80, //   #    #   
+	0x1F, 0x80, //   ######   
+	0x08, 0x80, //    #   #   
+	0x10, 0x80, //   #    #   
+	0x10, 0x80, //   #    #   
+	0x00, 0x00, //            
+
+	// @1162 's' (7 columns)
+	0x00, 0x00, //            
+	0x09, 0x80, //    #  ##   
+	0x14, 0x80, //   # #  #   
+	0x14, 0x80, //   # #  #   
+	0x14, 0x80, //   # #  #   
+	0x1B, 0x00, //   ## ##    
+	0x00, 0x00, //            
+
+	// @1176 't' (7 columns)
+	0x00, 0x00, //            
+	0x10, 0x00, //   #        
+	0x3F, 0x00, //  ######    
+	0x10, 0x80, //   #    #   
+	0x10, 0x80, //   #    #   
+	0x10, 0x80, //   #    #   
+	0x01, 0x00, //       #    
+
+	// @1190 'u' (7 columns)
+	0x10, 0x00, //   #        
+	0x1F, 0x00, //   #####    
+	0x00, 0x80, //        #   
+	0x00, 0x80, //        #   
+	0x11, 0x00, //   #   #    
+	0x1F, 0x80, //   ######   
+	0x00, 0x80, //        #   
+
+	// @1204 'v' (7 columns)
+	0x10, 0x00, //   #        
+	0x1C, 0x00, //   ###      
+	0x13, 0x00, //   #  ##    
+	0x00, 0x80, //        #   
+	0x13, 0x00, //   #  ##    
+	0x1C, 0x00, //   ###      
+	0x10, 0x00, //   #        
+
+	// @1218 'w' (7 columns)
+	0x10, 0x00, //   #        
+	0x1F, 0x00, //   #####    
+	0x10, 0x80, //   #    #   
+	0x07, 0x00, //     ###    
+	0x10, 0x80, //   #    #   
+	0x1F, 0x00, //   #####    
+	0x10, 0x00, //   #        
+
+	// @1232 'x' (7 columns)
+	0x10, 0x80, //   #    #   
+	0x19, 0x80, //   ##  ##   
+	0x06, 0x00, //     ##     
+	0x06, 0x00, //     ##     
+	0x19, 0x80, //   ##  ##   
+	0x10, 0x80, //   #    #   
+	0x00, 0x00, //            
+
+	// @1246 'y' (7 columns)
+	0x10, 0x00, //   #        
+	0x18, 0x20, //   ##     # 
+	0x16, 0x20, //   # ##   # 
+	0x01, 0xE0, //       #### 
+	0x13, 0x20, //   #  ##  # 
+	0x1C, 0x00, //   ###      
+	0x10, 0x00, //   #        
+
+	// @1260 'z' (7 columns)
+	0x00, 0x00, //            
+	0x19, 0x80, //   ##  ##   
+	0x12, 0x80, //   #  # #   
+	0x14, 0x80, //   # #  #   
+	0x18, 0x80, //   ##   #   
+	0x11, 0x80, //   #   ##   
+	0x00, 0x00, //            
+
+	// @1274 '{' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x02, 0x00, //      #     
+	0x3D, 0xC0, //  #### ###  
+	0x40, 0x20, // #        # 
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @1288 '|' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x7F, 0xC0, // #########  
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @1302 '}' (7 columns)
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+	0x40, 0x20, // #        # 
+	0x3D, 0xC0, //  #### ###  
+	0x02, 0x00, //      #     
+	0x00, 0x00, //            
+	0x00, 0x00, //            
+
+	// @1316 '~' (7 columns)
+	0x00, 0x00, //            
+	0x02, 0x00, //      #     
+	0x04, 0x00, //     #      
+	0x02, 0x00, //      #     
+	0x02, 0x00, //      #     
+	0x04, 0x00, //     #      
+	0x00, 0x00, //            
+};
+
+// 11x16, 2 byte(s) per column
+const uint8_t Font16_Table_R270[] = 
+{
+	// @0 ' ' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @22 '!' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x7F, 0xA0, // ######## #     
+	0x7F, 0xA0, // ######## #     
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @44 '"' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x30, 0x00, //  ##            
+	0x3E, 0x00, //  #####         
+	0x30, 0x00, //  ##            
+	0x00, 0x00, //                
+	0x30, 0x00, //  ##            
+	0x3E, 0x00, //  #####         
+	0x30, 0x00, //  ##            
+	0x00, 0x00, //                
+
+	// @66 '#' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x05, 0x00, //     # #        
+	0x07, 0xF0, //     #######    
+	0x7F, 0xF0, // ###########    
+	0x7D, 0x00, // ##### #        
+	0x07, 0xF0, //     #######    
+	0x7F, 0xF0, // ###########    
+	0x7D, 0x00, // ##### #        
+	0x05, 0x00, //     # #        
+	0x00, 0x00, //                
+
+	// @88 '$' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x38, 0xE0, //  ###   ###     
+	0x7C, 0xE0, // #####  ###     
+	0x4E, 0x20, // #  ###   #     
+	0xC6, 0x38, //##   ##   ###   
+	0x47, 0x20, // #   ###  #     
+	0x73, 0xE0, // ###  #####     
+	0x71, 0xC0, // ###   ###      
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @110 '%' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x31, 0x00, //  ##   #        
+	0x4B, 0x00, // #  # ##        
+	0x4A, 0x00, // #  # #         
+	0x36, 0x00, //  ## ##         
+	0x06, 0xC0, //     ## ##      
+	0x05, 0x20, //     # #  #     
+	0x0D, 0x20, //    ## #  #     
+	0x08, 0xC0, //    #   ##      
+	0x00, 0x00, //                
+
+	// @132 '&' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0xC0, //        ##      
+	0x1D, 0xE0, //   ### ####     
+	0x3F, 0x20, //  ######  #     
+	0x23, 0xA0, //  #   ### #     
+	0x20, 0xC0, //  #     ##      
+	0x21, 0xE0, //  #    ####     
+	0x01, 0x20, //       #  #     
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @154 ''' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x30, 0x00, //  ##            
+	0x3E, 0x00, //  #####         
+	0x30, 0x00, //  ##            
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @176 '(' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x0F, 0xC0, //    ######      
+	0x1F, 0xE0, //   ########     
+	0x78, 0x78, // ####    ####   
+	0x60, 0x18, // ##        ##   
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @198 ')' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x60, 0x18, // ##        ##   
+	0x70, 0x38, // ###      ###   
+	0x1F, 0xF0, //   #########    
+	0x0F, 0xC0, //    ######      
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @220 '*' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x18, 0x00, //   ##           
+	0x1B, 0x00, //   ## ##        
+	0x1F, 0x00, //   #####        
+	0x7E, 0x00, // ######         
+	0x7E, 0x00, // ######         
+	0x1F, 0x00, //   #####        
+	0x1B, 0x00, //   ## ##        
+	0x18, 0x00, //   ##           
+	0x00, 0x00, //                
+
+	// @242 '+' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x02, 0x00, //      #         
+	0x02, 0x00, //      #         
+	0x02, 0x00, //      #         
+	0x1F, 0xC0, //   #######      
+	0x02, 0x00, //      #         
+	0x02, 0x00, //      #         
+	0x02, 0x00, //      #         
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @264 ',' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x1C, //           ###  
+	0x00, 0x70, //         ###    
+	0x00, 0x40, //         #      
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @286 '-' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x02, 0x00, //      #         
+	0x02, 0x00, //      #         
+	0x02, 0x00, //      #         
+	0x02, 0x00, //      #         
+	0x02, 0x00, //      #         
+	0x02, 0x00, //      #         
+	0x02, 0x00, //      #         
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @308 '.' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x60, //         ##     
+	0x00, 0x60, //         ##     
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @330 '/' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x18, //           ##   
+	0x00, 0x78, //         ####   
+	0x01, 0xE0, //       ####     
+	0x03, 0x80, //      ###       
+	0x0E, 0x00, //    ###         
+	0x3C, 0x00, //  ####          
+	0xF0, 0x00, //####            
+	0xC0, 0x00, //##              
+	0x00, 0x00, //                
+
+	// @352 '0' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x1F, 0x80, //   ######       
+	0x3F, 0xC0, //  ########      
+	0x60, 0x60, // ##      ##     
+	0x40, 0x20, // #        #     
+	0x60, 0x60, // ##      ##     
+	0x3F, 0xC0, //  ########      
+	0x1F, 0x80, //   ######       
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @374 '1' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x7F, 0xE0, // ##########     
+	0x7F, 0xE0, // ##########     
+	0x00, 0x20, //          #     
+	0x00, 0x20, //          #     
+	0x00, 0x20, //          #     
+	0x00, 0x00, //                
+
+	// @396 '2' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x18, 0x60, //   ##    ##     
+	0x38, 0xE0, //  ###   ###     
+	0x61, 0xA0, // ##    ## #     
+	0x43, 0x20, // #    ##  #     
+	0x46, 0x20, // #   ##   #     
+	0x7C, 0x20, // #####    #     
+	0x38, 0x20, //  ###     #     
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @418 '3' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x40, //  #      #      
+	0x60, 0x60, // ##      ##     
+	0x44, 0x20, // #   #    #     
+	0x44, 0x20, // #   #    #     
+	0x44, 0x20, // #   #    #     
+	0x4E, 0x20, // #  ###   #     
+	0x7F, 0xE0, // ##########     
+	0x33, 0xC0, //  ##  ####      
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @440 '4' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x01, 0x80, //       ##       
+	0x07, 0x80, //     ####       
+	0x1C, 0xA0, //   ###  # #     
+	0x70, 0xA0, // ###    # #     
+	0x7F, 0xE0, // ##########     
+	0x7F, 0xE0, // ##########     
+	0x00, 0xA0, //        # #     
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @462 '5' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x40, //         #      
+	0x7E, 0x20, // ######   #     
+	0x7C, 0x20, // #####    #     
+	0x44, 0x20, // #   #    #     
+	0x44, 0x20, // #   #    #     
+	0x47, 0xE0, // #   ######     
+	0x43, 0xC0, // #    ####      
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @484 '6' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x0F, 0x80, //    #####       
+	0x3F, 0xC0, //  ########      
+	0x32, 0x60, //  ##  #  ##     
+	0x64, 0x20, // ##  #    #     
+	0x44, 0x20, // #   #    #     
+	0x47, 0xE0, // #   ######     
+	0x43, 0xC0, // #    ####      
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @506 '7' (11 columns)
+	0x00, 0x00, //                
+	0x60, 0x00, // ##             
+	0x40, 0x00, // #              
+	0x40, 0x00, // #              
+	0x40, 0xE0, // #      ###     
+	0x4F, 0xE0, // #  #######     
+	0x7F, 0x00, // #######        
+	0x70, 0x00, // ###            
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @528 '8' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x3B, 0xC0, //  ### ####      
+	0x7F, 0xE0, // ##########     
+	0x44, 0x20, // #   #    #     
+	0x44, 0x20, // #   #    #     
+	0x44, 0x20, // #   #    #     
+	0x7F, 0xE0, // ##########     
+	0x3B, 0xC0, //  ### ####      
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @550 '9' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x3C, 0x20, //  ####    #     
+	0x7E, 0x20, // ######   #     
+	0x42, 0x20, // #    #   #     
+	0x42, 0x60, // #    #  ##     
+	0x64, 0xC0, // ##  #  ##      
+	0x3F, 0xC0, //  ########      
+	0x1F, 0x00, //   #####        
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @572 ':' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x0C, 0x60, //    ##   ##     
+	0x0C, 0x60, //    ##   ##     
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @594 ';' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x18, //           ##   
+	0x00, 0x60, //         ##     
+	0x0C, 0x40, //    ##   #      
+	0x0C, 0x00, //    ##          
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @616 '<' (11 columns)
+	0x00, 0x00, //                
+	0x02, 0x00, //      #         
+	0x02, 0x00, //      #         
+	0x05, 0x00, //     # #        
+	0x05, 0x00, //     # #        
+	0x08, 0x80, //    #   #       
+	0x10, 0x40, //   #     #      
+	0x10, 0x40, //   #     #      
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x00, 0x00, //                
+
+	// @638 '=' (11 columns)
+	0x00, 0x00, //                
+	0x05, 0x00, //     # #        
+	0x05, 0x00, //     # #        
+	0x05, 0x00, //     # #        
+	0x05, 0x00, //     # #        
+	0x05, 0x00, //     # #        
+	0x05, 0x00, //     # #        
+	0x05, 0x00, //     # #        
+	0x05, 0x00, //     # #        
+	0x05, 0x00, //     # #        
+	0x00, 0x00, //                
+
+	// @660 '>' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x10, 0x40, //   #     #      
+	0x10, 0x40, //   #     #      
+	0x08, 0x80, //    #   #       
+	0x05, 0x00, //     # #        
+	0x05, 0x00, //     # #        
+	0x02, 0x00, //      #         
+	0x02, 0x00, //      #         
+	0x00, 0x00, //                
+
+	// @682 '?' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x18, 0x00, //   ##           
+	0x38, 0x00, //  ###           
+	0x21, 0xA0, //  #    ## #     
+	0x23, 0xA0, //  #   ### #     
+	0x22, 0x00, //  #   #         
+	0x3E, 0x00, //  #####         
+	0x1C, 0x00, //   ###          
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @704 '@' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x1F, 0xC0, //   #######      
+	0x20, 0x20, //  #       #     
+	0x43, 0x10, // #    ##   #    
+	0x44, 0x90, // #   #  #  #    
+	0x44, 0x90, // #   #  #  #    
+	0x3F, 0xA0, //  ####### #     
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @726 'A' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x20, //          #     
+	0x20, 0xE0, //  #     ###     
+	0x27, 0xE0, //  #  ######     
+	0x3F, 0x20, //  ######  #     
+	0x31, 0x00, //  ##   #        
+	0x31, 0x00, //  ##   #        
+	0x3F, 0x20, //  ######  #     
+	0x07, 0xE0, //     ######     
+	0x00, 0xE0, //        ###     
+	0x00, 0x20, //          #     
+
+	// @748 'B' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x22, 0x20, //  #   #   #     
+	0x22, 0x20, //  #   #   #     
+	0x22, 0x20, //  #   #   #     
+	0x3F, 0xE0, //  #########     
+	0x1D, 0xC0, //   ### ###      
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @770 'C' (11 columns)
+	0x00, 0x00, //                
+	0x0F, 0x80, //    #####       
+	0x1F, 0xC0, //   #######      
+	0x30, 0x60, //  ##     ##     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x10, 0x40, //   #     #      
+	0x38, 0x80, //  ###   #       
+	0x00, 0x00, //                
+
+	// @792 'D' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x30, 0x60, //  ##     ##     
+	0x1F, 0xC0, //   #######      
+	0x0F, 0x80, //    #####       
+	0x00, 0x00, //                
+
+	// @814 'E' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x22, 0x20, //  #   #   #     
+	0x22, 0x20, //  #   #   #     
+	0x27, 0x20, //  #  ###  #     
+	0x20, 0x20, //  #       #     
+	0x38, 0xE0, //  ###   ###     
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @836 'F' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x22, 0x20, //  #   #   #     
+	0x22, 0x20, //  #   #   #     
+	0x27, 0x00, //  #  ###        
+	0x20, 0x00, //  #             
+	0x20, 0x00, //  #             
+	0x38, 0x00, //  ###           
+	0x00, 0x00, //                
+
+	// @858 'G' (11 columns)
+	0x00, 0x00, //                
+	0x0F, 0x80, //    #####       
+	0x1F, 0xC0, //   #######      
+	0x30, 0x60, //  ##     ##     
+	0x20, 0x20, //  #       #     
+	0x21, 0x20, //  #    #  #     
+	0x21, 0x20, //  #    #  #     
+	0x11, 0xE0, //   #   ####     
+	0x39, 0xC0, //  ###  ###      
+	0x01, 0x00, //       #        
+	0x00, 0x00, //                
+
+	// @880 'H' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x22, 0x20, //  #   #   #     
+	0x02, 0x00, //      #         
+	0x22, 0x20, //  #   #   #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x20, 0x20, //  #       #     
+	0x00, 0x00, //                
+
+	// @902 'I' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x00, 0x00, //                
+
+	// @924 'J' (11 columns)
+	0x00, 0x00, //                
+	0x01, 0xC0, //       ###      
+	0x01, 0xE0, //       ####     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xC0, //  ########      
+	0x20, 0x00, //  #             
+	0x20, 0x00, //  #             
+	0x00, 0x00, //                
+
+	// @946 'K' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x23, 0x20, //  #   ##  #     
+	0x07, 0x00, //     ###        
+	0x2D, 0x80, //  # ## ##       
+	0x38, 0xE0, //  ###   ###     
+	0x30, 0x60, //  ##     ##     
+	0x20, 0x20, //  #       #     
+	0x00, 0x00, //                
+
+	// @968 'L' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x00, 0x20, //          #     
+	0x00, 0x20, //          #     
+	0x01, 0xE0, //       ####     
+	0x00, 0x00, //                
+
+	// @990 'M' (11 columns)
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x0C, 0x20, //    ##    #     
+	0x07, 0x20, //     ###  #     
+	0x01, 0x80, //       ##       
+	0x07, 0x20, //     ###  #     
+	0x0C, 0x20, //    ##    #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x20, 0x20, //  #       #     
+
+	// @1012 'N' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x0C, 0x20, //    ##    #     
+	0x07, 0x00, //     ###        
+	0x21, 0x80, //  #    ##       
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x20, 0x00, //  #             
+	0x00, 0x00, //                
+
+	// @1034 'O' (11 columns)
+	0x00, 0x00, //                
+	0x0F, 0x80, //    #####       
+	0x1F, 0xC0, //   #######      
+	0x30, 0x60, //  ##     ##     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x30, 0x60, //  ##     ##     
+	0x1F, 0xC0, //   #######      
+	0x0F, 0x80, //    #####       
+	0x00, 0x00, //                
+
+	// @1056 'P' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x21, 0x20, //  #    #  #     
+	0x21, 0x20, //  #    #  #     
+	0x21, 0x20, //  #    #  #     
+	0x3F, 0x00, //  ######        
+	0x1E, 0x00, //   ####         
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @1078 'Q' (11 columns)
+	0x00, 0x00, //                
+	0x0F, 0x80, //    #####       
+	0x1F, 0xC0, //   #######      
+	0x30, 0x68, //  ##     ## #   
+	0x20, 0x38, //  #       ###   
+	0x20, 0x38, //  #       ###   
+	0x20, 0x28, //  #       # #   
+	0x30, 0x68, //  ##     ## #   
+	0x1F, 0xD8, //   ####### ##   
+	0x0F, 0x90, //    #####  #    
+	0x00, 0x00, //                
+
+	// @1100 'R' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x22, 0x20, //  #   #   #     
+	0x22, 0x20, //  #   #   #     
+	0x23, 0x00, //  #   ##        
+	0x3D, 0xC0, //  #### ###      
+	0x1C, 0xE0, //   ###  ###     
+	0x00, 0x20, //          #     
+	0x00, 0x20, //          #     
+
+	// @1122 'S' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x1C, 0xE0, //   ###  ###     
+	0x3E, 0xE0, //  ##### ###     
+	0x26, 0x20, //  #  ##   #     
+	0x22, 0x20, //  #   #   #     
+	0x23, 0x20, //  #   ##  #     
+	0x3B, 0xE0, //  ### #####     
+	0x39, 0xC0, //  ###  ###      
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @1144 'T' (11 columns)
+	0x00, 0x00, //                
+	0x3C, 0x00, //  ####          
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xE0, //  #########     
+	0x20, 0x20, //  #       #     
+	0x20, 0x20, //  #       #     
+	0x3C, 0x00, //  ####          
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @1166 'U' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x00, //  #             
+	0x3F, 0xC0, //  ########      
+	0x3F, 0xE0, //  #########     
+	0x20, 0x20, //  #       #     
+	0x00, 0x20, //          #     
+	0x20, 0x20, //  #       #     
+	0x3F, 0xE0, //  #########     
+	0x3F, 0xC0, //  ########      
+	0x20, 0x00, //  #             
+	0x00, 0x00, //                
+
+	// @1188 'V' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x00, //  #             
+	0x38, 0x00, //  ###           
+	0x3F, 0x00, //  ######        
+	0x27, 0xE0, //  #  ######     
+	0x00, 0x60, //         ##     
+	0x27, 0xE0, //  #  ######     
+	0x3F, 0x00, //  ######        
+	0x38, 0x00, //  ###           
+	0x20, 0x00, //  #             
+	0x00, 0x00, //                
+
+	// @1210 'W' (11 columns)
+	0x20, 0x00, //  #             
+	0x3E, 0x00, //  #####         
+	0x3F, 0xE0, //  #########     
+	0x20, 0xE0, //  #     ###     
+	0x27, 0xC0, //  #  #####      
+	0x0E, 0x00, //    ###         
+	0x27, 0xC0, //  #  #####      
+	0x20, 0xE0, //  #     ###     
+	0x3F, 0xE0, //  #########     
+	0x3E, 0x00, //  #####         
+	0x20, 0x00, //  #             
+
+	// @1232 'X' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x20, //  #       #     
+	0x30, 0x60, //  ##     ##     
+	0x38, 0xE0, //  ###   ###     
+	0x2F, 0xA0, //  # ##### #     
+	0x07, 0x00, //     ###        
+	0x2F, 0xA0, //  # ##### #     
+	0x38, 0xE0, //  ###   ###     
+	0x30, 0x60, //  ##     ##     
+	0x20, 0x20, //  #       #     
+	0x00, 0x00, //                
+
+	// @1254 'Y' (11 columns)
+	0x00, 0x00, //                
+	0x20, 0x00, //  #             
+	0x30, 0x00, //  ##            
+	0x38, 0x20, //  ###     #     
+	0x2C, 0x20, //  # ##    #     
+	0x07, 0xE0, //     ######     
+	0x07, 0xE0, //     ######     
+	0x2C, 0x20, //  # ##    #     
+	0x38, 0x20, //  ###     #     
+	0x30, 0x00, //  ##            
+	0x20, 0x00, //  #             
+
+	// @1276 'Z' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x38, 0x60, //  ###    ##     
+	0x20, 0xE0, //  #     ###     
+	0x21, 0xA0, //  #    ## #     
+	0x27, 0x20, //  #  ###  #     
+	0x2C, 0x20, //  # ##    #     
+	0x38, 0x20, //  ###     #     
+	0x30, 0xE0, //  ##    ###     
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @1298 '[' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x7F, 0xF8, // ############   
+	0x7F, 0xF8, // ############   
+	0x40, 0x08, // #          #   
+	0x40, 0x08, // #          #   
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @1320 '\' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0xC0, 0x00, //##              
+	0xF0, 0x00, //####            
+	0x3C, 0x00, //  ####          
+	0x0E, 0x00, //    ###         
+	0x03, 0x80, //      ###       
+	0x01, 0xE0, //       ####     
+	0x00, 0x78, //         ####   
+	0x00, 0x18, //           ##   
+	0x00, 0x00, //                
+
+	// @1342 ']' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x40, 0x08, // #          #   
+	0x40, 0x08, // #          #   
+	0x7F, 0xF8, // ############   
+	0x7F, 0xF8, // ############   
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @1364 '^' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x0C, 0x00, //    ##          
+	0x10, 0x00, //   #            
+	0x60, 0x00, // ##             
+	0x80, 0x00, //#               
+	0x60, 0x00, // ##             
+	0x10, 0x00, //   #            
+	0x0C, 0x00, //    ##          
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @1386 '_' (11 columns)
+	0x00, 0x01, //               #
+	0x00, 0x01, //               #
+	0x00, 0x01, //               #
+	0x00, 0x01, //               #
+	0x00, 0x01, //               #
+	0x00, 0x01, //               #
+	0x00, 0x01, //               #
+	0x00, 0x01, //               #
+	0x00, 0x01, //               #
+	0x00, 0x01, //               #
+	0x00, 0x01, //               #
+
+	// @1408 '`' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x80, 0x00, //#               
+	0x40, 0x00, // #              
+	0x20, 0x00, //  #             
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @1430 'a' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0xC0, //        ##      
+	0x09, 0xE0, //    #  ####     
+	0x09, 0x20, //    #  #  #     
+	0x09, 0x20, //    #  #  #     
+	0x09, 0x40, //    #  # #      
+	0x0F, 0xE0, //    #######     
+	0x07, 0xE0, //     ######     
+	0x00, 0x20, //          #     
+	0x00, 0x00, //                
+
+	// @1452 'b' (11 columns)
+	0x00, 0x00, //                
+	0x40, 0x20, // #        #     
+	0x7F, 0xE0, // ##########     
+	0x7F, 0xE0, // ##########     
+	0x04, 0x40, //     #   #      
+	0x08, 0x20, //    #     #     
+	0x08, 0x20, //    #     #     
+	0x0C, 0x60, //    ##   ##     
+	0x07, 0xC0, //     #####      
+	0x03, 0x80, //      ###       
+	0x00, 0x00, //                
+
+	// @1474 'c' (11 columns)
+	0x00, 0x00, //                
+	0x03, 0x80, //      ###       
+	0x07, 0xC0, //     #####      
+	0x0C, 0x60, //    ##   ##     
+	0x08, 0x20, //    #     #     
+	0x08, 0x20, //    #     #     
+	0x08, 0x20, //    #     #     
+	0x04, 0x60, //     #   ##     
+	0x0E, 0xC0, //    ### ##      
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @1496 'd' (11 columns)
+	0x00, 0x00, //                
+	0x03, 0x80, //      ###       
+	0x07, 0xC0, //     #####      
+	0x0C, 0x60, //    ##   ##     
+	0x08, 0x20, //    #     #     
+	0x08, 0x20, //    #     #     
+	0x44, 0x40, // #   #   #      
+	0x7F, 0xE0, // ##########     
+	0x7F, 0xE0, // ##########     
+	0x00, 0x20, //          #     
+	0x00, 0x00, //                
+
+	// @1518 'e' (11 columns)
+	0x00, 0x00, //                
+	0x03, 0x80, //      ###       
+	0x07, 0xC0, //     #####      
+	0x0D, 0x60, //    ## # ##     
+	0x09, 0x20, //    #  #  #     
+	0x09, 0x20, //    #  #  #     
+	0x09, 0x20, //    #  #  #     
+	0x0D, 0x20, //    ## #  #     
+	0x07, 0x60, //     ### ##     
+	0x03, 0x40, //      ## #      
+	0x00, 0x00, //                
+
+	// @1540 'f' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x08, 0x20, //    #     #     
+	0x08, 0x20, //    #     #     
+	0x3F, 0xE0, //  #########     
+	0x7F, 0xE0, // ##########     
+	0x48, 0x20, // #  #     #     
+	0x48, 0x20, // #  #     #     
+	0x48, 0x20, // #  #     #     
+	0x40, 0x00, // #              
+	0x40, 0x00, // #              
+
+	// @1562 'g' (11 columns)
+	0x00, 0x00, //                
+	0x03, 0x80, //      ###       
+	0x07, 0xC0, //     #####      
+	0x0C, 0x64, //    ##   ##  #  
+	0x08, 0x24, //    #     #  #  
+	0x08, 0x24, //    #     #  #  
+	0x04, 0x44, //     #   #   #  
+	0x0F, 0xFC, //    ##########  
+	0x0F, 0xF8, //    #########   
+	0x08, 0x00, //    #           
+	0x00, 0x00, //                
+
+	// @1584 'h' (11 columns)
+	0x00, 0x00, //                
+	0x40, 0x20, // #        #     
+	0x7F, 0xE0, // ##########     
+	0x7F, 0xE0, // ##########     
+	0x04, 0x20, //     #    #     
+	0x08, 0x00, //    #           
+	0x08, 0x20, //    #     #     
+	0x0F, 0xE0, //    #######     
+	0x07, 0xE0, //     ######     
+	0x00, 0x20, //          #     
+	0x00, 0x00, //                
+
+	// @1606 'i' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x20, //          #     
+	0x08, 0x20, //    #     #     
+	0x08, 0x20, //    #     #     
+	0x6F, 0xE0, // ## #######     
+	0x6F, 0xE0, // ## #######     
+	0x00, 0x20, //          #     
+	0x00, 0x20, //          #     
+	0x00, 0x20, //          #     
+	0x00, 0x00, //                
+
+	// @1628 'j' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x08, 0x04, //    #        #  
+	0x08, 0x04, //    #        #  
+	0x08, 0x04, //    #        #  
+	0x68, 0x04, // ## #        #  
+	0x6F, 0xFC, // ## ##########  
+	0x0F, 0xF8, //    #########   
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @1650 'k' (11 columns)
+	0x00, 0x00, //                
+	0x40, 0x20, // #        #     
+	0x7F, 0xE0, // ##########     
+	0x7F, 0xE0, // ##########     
+	0x03, 0x00, //      ##        
+	0x0F, 0xA0, //    ##### #     
+	0x0C, 0xE0, //    ##  ###     
+	0x08, 0x60, //    #    ##     
+	0x08, 0x20, //    #     #     
+	0x00, 0x20, //          #     
+	0x00, 0x00, //                
+
+	// @1672 'l' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x20, //          #     
+	0x40, 0x20, // #        #     
+	0x40, 0x20, // #        #     
+	0x7F, 0xE0, // ##########     
+	0x7F, 0xE0, // ##########     
+	0x00, 0x20, //          #     
+	0x00, 0x20, //          #     
+	0x00, 0x20, //          #     
+	0x00, 0x00, //                
+
+	// @1694 'm' (11 columns)
+	0x00, 0x00, //                
+	0x08, 0x20, //    #     #     
+	0x0F, 0xE0, //    #######     
+	0x0F, 0xE0, //    #######     
+	0x08, 0x00, //    #           
+	0x0F, 0xE0, //    #######     
+	0x0F, 0xE0, //    #######     
+	0x08, 0x00, //    #           
+	0x0F, 0xE0, //    #######     
+	0x07, 0xE0, //     ######     
+	0x00, 0x20, //          #     
+
+	// @1716 'n' (11 columns)
+	0x00, 0x00, //                
+	0x08, 0x20, //    #     #     
+	0x0F, 0xE0, //    #######     
+	0x0F, 0xE0, //    #######     
+	0x04, 0x20, //     #    #     
+	0x08, 0x00, //    #           
+	0x08, 0x20, //    #     #     
+	0x0F, 0xE0, //    #######     
+	0x07, 0xE0, //     ######     
+	0x00, 0x20, //          #     
+	0x00, 0x00, //                
+
+	// @1738 'o' (11 columns)
+	0x00, 0x00, //                
+	0x03, 0x80, //      ###       
+	0x07, 0xC0, //     #####      
+	0x0C, 0x60, //    ##   ##     
+	0x08, 0x20, //    #     #     
+	0x08, 0x20, //    #     #     
+	0x08, 0x20, //    #     #     
+	0x0C, 0x60, //    ##   ##     
+	0x07, 0xC0, //     #####      
+	0x03, 0x80, //      ###       
+	0x00, 0x00, //                
+
+	// @1760 'p' (11 columns)
+	0x00, 0x00, //                
+	0x08, 0x04, //    #        #  
+	0x0F, 0xFC, //    ##########  
+	0x0F, 0xFC, //    ##########  
+	0x04, 0x44, //     #   #   #  
+	0x08, 0x24, //    #     #  #  
+	0x08, 0x20, //    #     #     
+	0x0C, 0x60, //    ##   ##     
+	0x07, 0xC0, //     #####      
+	0x03, 0x80, //      ###       
+	0x00, 0x00, //                
+
+	// @1782 'q' (11 columns)
+	0x00, 0x00, //                
+	0x03, 0x80, //      ###       
+	0x07, 0xC0, //     #####      
+	0x0C, 0x60, //    ##   ##     
+	0x08, 0x20, //    #     #     
+	0x08, 0x24, //    #     #  #  
+	0x04, 0x44, //     #   #   #  
+	0x0F, 0xFC, //    ##########  
+	0x0F, 0xFC, //    ##########  
+	0x08, 0x04, //    #        #  
+	0x00, 0x00, //                
+
+	// @1804 'r' (11 columns)
+	0x00, 0x00, //                
+	0x08, 0x20, //    #     #     
+	0x08, 0x20, //    #     #     
+	0x0F, 0xE0, //    #######     
+	0x0F, 0xE0, //    #######     
+	0x04, 0x20, //     #    #     
+	0x08, 0x20, //    #     #     
+	0x08, 0x20, //    #     #     
+	0x0C, 0x00, //    ##          
+	0x04, 0x00, //     #          
+	0x00, 0x00, //                
+
+	// @1826 's' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x06, 0x60, //     ##  ##     
+	0x0F, 0x60, //    #### ##     
+	0x0B, 0x20, //    # ##  #     
+	0x0B, 0x20, //    # ##  #     
+	0x09, 0xA0, //    #  ## #     
+	0x0D, 0xE0, //    ## ####     
+	0x0C, 0xC0, //    ##  ##      
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @1848 't' (11 columns)
+	0x00, 0x00, //                
+	0x08, 0x00, //    #           
+	0x08, 0x00, //    #           
+	0x7F, 0xC0, // #########      
+	0x7F, 0xE0, // ##########     
+	0x08, 0x20, //    #     #     
+	0x08, 0x20, //    #     #     
+	0x08, 0x20, //    #     #     
+	0x00, 0x40, //         #      
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @1870 'u' (11 columns)
+	0x00, 0x00, //                
+	0x08, 0x00, //    #           
+	0x0F, 0xC0, //    ######      
+	0x0F, 0xE0, //    #######     
+	0x00, 0x20, //          #     
+	0x00, 0x20, //          #     
+	0x08, 0x40, //    #    #      
+	0x0F, 0xE0, //    #######     
+	0x0F, 0xE0, //    #######     
+	0x00, 0x20, //          #     
+	0x00, 0x00, //                
+
+	// @1892 'v' (11 columns)
+	0x00, 0x00, //                
+	0x08, 0x00, //    #           
+	0x0E, 0x00, //    ###         
+	0x0F, 0x80, //    #####       
+	0x09, 0xE0, //    #  ####     
+	0x00, 0x60, //         ##     
+	0x09, 0xE0, //    #  ####     
+	0x0F, 0x80, //    #####       
+	0x0E, 0x00, //    ###         
+	0x08, 0x00, //    #           
+	0x00, 0x00, //                
+
+	// @1914 'w' (11 columns)
+	0x08, 0x00, //    #           
+	0x0F, 0x00, //    ####        
+	0x0F, 0xE0, //    #######     
+	0x08, 0xE0, //    #   ###     
+	0x01, 0xC0, //       ###      
+	0x03, 0x00, //      ##        
+	0x01, 0xC0, //       ###      
+	0x08, 0xE0, //    #   ###     
+	0x0F, 0xE0, //    #######     
+	0x0F, 0x00, //    ####        
+	0x08, 0x00, //    #           
+
+	// @1936 'x' (11 columns)
+	0x00, 0x00, //                
+	0x08, 0x20, //    #     #     
+	0x08, 0x20, //    #     #     
+	0x0C, 0x60, //    ##   ##     
+	0x0F, 0xE0, //    #######     
+	0x03, 0x80, //      ###       
+	0x0F, 0xE0, //    #######     
+	0x0C, 0x60, //    ##   ##     
+	0x08, 0x20, //    #     #     
+	0x08, 0x20, //    #     #     
+	0x00, 0x00, //                
+
+	// @1958 'y' (11 columns)
+	0x00, 0x00, //                
+	0x08, 0x00, //    #           
+	0x0C, 0x04, //    ##       #  
+	0x0F, 0x04, //    ####     #  
+	0x0B, 0xCC, //    # ####  ##  
+	0x00, 0x7C, //         #####  
+	0x00, 0xF4, //        #### #  
+	0x0B, 0xC0, //    # ####      
+	0x0F, 0x00, //    ####        
+	0x0C, 0x00, //    ##          
+	0x08, 0x00, //    #           
+
+	// @1980 'z' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x0C, 0x60, //    ##   ##     
+	0x08, 0xE0, //    #   ###     
+	0x09, 0xA0, //    #  ## #     
+	0x09, 0x20, //    #  #  #     
+	0x0B, 0x20, //    # ##  #     
+	0x0E, 0x20, //    ###   #     
+	0x0C, 0x60, //    ##   ##     
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @2002 '{' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x01, 0x00, //       #        
+	0x3F, 0xF0, //  ##########    
+	0x7E, 0xF8, // ###### #####   
+	0x40, 0x08, // #          #   
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @2024 '|' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x7F, 0xF8, // ############   
+	0x7F, 0xF8, // ############   
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @2046 '}' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x40, 0x08, // #          #   
+	0x7E, 0xF8, // ###### #####   
+	0x3F, 0xF0, //  ##########    
+	0x01, 0x00, //       #        
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+
+	// @2068 '~' (11 columns)
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+	0x02, 0x00, //      #         
+	0x04, 0x00, //     #          
+	0x04, 0x00, //     #          
+	0x02, 0x00, //      #         
+	0x01, 0x00, //       #        
+	0x01, 0x00, //       #        
+	0x02, 0x00, //      #         
+	0x00, 0x00, //                
+	0x00, 0x00, //                
+};
+
+// 14x20, 3 byte(s) per column
+const uint8_t Font20_Table_R270[] = 
+{
+	// @0 ' ' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @42 '!' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x7F, 0x0C, 0x00, // #######    ##      
+	0x7F, 0xCC, 0x00, // #########  ##      
+	0x7F, 0x0C, 0x00, // #######    ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @84 '"' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x38, 0x00, 0x00, //  ###               
+	0x3F, 0x00, 0x00, //  ######            
+	0x38, 0x00, 0x00, //  ###               
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x38, 0x00, 0x00, //  ###               
+	0x3F, 0x00, 0x00, //  ######            
+	0x38, 0x00, 0x00, //  ###               
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @126 '#' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x06, 0x60, 0x00, //     ##  ##         
+	0xFF, 0xFF, 0x00, //################    
+	0xFF, 0xFF, 0x00, //################    
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x06, 0x60, 0x00, //     ##  ##         
+	0xFF, 0xFF, 0x00, //################    
+	0xFF, 0xFF, 0x00, //################    
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @168 '$' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x0E, 0x78, 0x00, //    ###  ####       
+	0x1F, 0x78, 0x00, //   ##### ####       
+	0x33, 0x18, 0x00, //  ##  ##   ##       
+	0xF3, 0x1F, 0x00, //####  ##   #####    
+	0xF3, 0x1F, 0x00, //####  ##   #####    
+	0x31, 0x98, 0x00, //  ##   ##  ##       
+	0x39, 0xF0, 0x00, //  ###  #####        
+	0x38, 0xE0, 0x00, //  ###   ###         
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @210 '%' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x38, 0xC0, 0x00, //  ###   ##          
+	0x44, 0xC0, 0x00, // #   #  ##          
+	0x45, 0x80, 0x00, // #   # ##           
+	0x45, 0x80, 0x00, // #   # ##           
+	0x39, 0x38, 0x00, //  ###  #  ###       
+	0x03, 0x44, 0x00, //      ## #   #      
+	0x03, 0x44, 0x00, //      ## #   #      
+	0x06, 0x44, 0x00, //     ##  #   #      
+	0x06, 0x38, 0x00, //     ##   ###       
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @252 '&' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x78, 0x00, //         ####       
+	0x0E, 0xF8, 0x00, //    ### #####       
+	0x0F, 0xCC, 0x00, //    ######  ##      
+	0x19, 0xCC, 0x00, //   ##  ###  ##      
+	0x18, 0xEC, 0x00, //   ##   ### ##      
+	0x18, 0x7C, 0x00, //   ##    #####      
+	0x18, 0x78, 0x00, //   ##    ####       
+	0x18, 0xEC, 0x00, //   ##   ### ##      
+	0x00, 0xCC, 0x00, //        ##  ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @294 ''' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x38, 0x00, 0x00, //  ###               
+	0x3F, 0x00, 0x00, //  ######            
+	0x38, 0x00, 0x00, //  ###               
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @336 '(' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x03, 0xF0, 0x00, //      ######        
+	0x1F, 0xFE, 0x00, //   ############     
+	0x7C, 0x0F, 0x80, // #####      #####   
+	0x60, 0x01, 0x80, // ##            ##   
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @378 ')' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x60, 0x01, 0x80, // ##            ##   
+	0x7C, 0x0F, 0x80, // #####      #####   
+	0x1F, 0xFE, 0x00, //   ############     
+	0x03, 0xF0, 0x00, //      ######        
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @420 '*' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x0C, 0x00, 0x00, //    ##              
+	0x0C, 0xC0, 0x00, //    ##  ##          
+	0x07, 0xC0, 0x00, //     #####          
+	0x7F, 0x80, 0x00, // ########           
+	0x7F, 0x80, 0x00, // ########           
+	0x07, 0xC0, 0x00, //     #####          
+	0x0C, 0xC0, 0x00, //    ##  ##          
+	0x0C, 0x00, 0x00, //    ##              
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @462 '+' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x1F, 0xF8, 0x00, //   ##########       
+	0x1F, 0xF8, 0x00, //   ##########       
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @504 ',' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x03, 0x80, //              ###   
+	0x00, 0x1F, 0x00, //           #####    
+	0x00, 0x1C, 0x00, //           ###      
+	0x00, 0x10, 0x00, //           #        
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @546 '-' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @588 '.' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x1C, 0x00, //           ###      
+	0x00, 0x1C, 0x00, //           ###      
+	0x00, 0x1C, 0x00, //           ###      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @630 '/' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x03, 0x00, //              ##    
+	0x00, 0x1F, 0x00, //           #####    
+	0x00, 0x7C, 0x00, //         #####      
+	0x01, 0xE0, 0x00, //       ####         
+	0x07, 0x80, 0x00, //     ####           
+	0x3E, 0x00, 0x00, //  #####             
+	0xF8, 0x00, 0x00, //#####               
+	0xC0, 0x00, 0x00, //##                  
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @672 '0' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x0F, 0xE0, 0x00, //    #######         
+	0x3F, 0xF8, 0x00, //  ###########       
+	0x70, 0x1C, 0x00, // ###       ###      
+	0x60, 0x0C, 0x00, // ##         ##      
+	0x60, 0x0C, 0x00, // ##         ##      
+	0x60, 0x0C, 0x00, // ##         ##      
+	0x70, 0x1C, 0x00, // ###       ###      
+	0x3F, 0xF8, 0x00, //  ###########       
+	0x0F, 0xE0, 0x00, //    #######         
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @714 '1' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x7F, 0xFC, 0x00, // #############      
+	0x7F, 0xFC, 0x00, // #############      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @756 '2' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x18, 0x0C, 0x00, //   ##       ##      
+	0x38, 0x1C, 0x00, //  ###      ###      
+	0x70, 0x3C, 0x00, // ###      ####      
+	0x60, 0x6C, 0x00, // ##      ## ##      
+	0x60, 0xCC, 0x00, // ##     ##  ##      
+	0x61, 0x8C, 0x00, // ##    ##   ##      
+	0x73, 0x0C, 0x00, // ###  ##    ##      
+	0x3E, 0x0C, 0x00, //  #####     ##      
+	0x1C, 0x0C, 0x00, //   ###      ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @798 '3' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x18, 0x00, //           ##       
+	0x30, 0x1C, 0x00, //  ##       ###      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x60, 0x0C, 0x00, // ##         ##      
+	0x63, 0x0C, 0x00, // ##   ##    ##      
+	0x63, 0x0C, 0x00, // ##   ##    ##      
+	0x63, 0x0C, 0x00, // ##   ##    ##      
+	0x77, 0x9C, 0x00, // ### ####  ###      
+	0x3F, 0xF8, 0x00, //  ###########       
+	0x1C, 0xF0, 0x00, //   ###  ####        
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @840 '4' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0xE0, 0x00, //        ###         
+	0x01, 0xE0, 0x00, //       ####         
+	0x07, 0x60, 0x00, //     ### ##         
+	0x0E, 0x60, 0x00, //    ###  ##         
+	0x38, 0x6C, 0x00, //  ###    ## ##      
+	0x70, 0x6C, 0x00, // ###     ## ##      
+	0x7F, 0xFC, 0x00, // #############      
+	0x7F, 0xFC, 0x00, // #############      
+	0x00, 0x6C, 0x00, //         ## ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @882 '5' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x18, 0x00, //           ##       
+	0x7F, 0x1C, 0x00, // #######   ###      
+	0x7F, 0x0C, 0x00, // #######    ##      
+	0x66, 0x0C, 0x00, // ##  ##     ##      
+	0x66, 0x0C, 0x00, // ##  ##     ##      
+	0x66, 0x0C, 0x00, // ##  ##     ##      
+	0x67, 0x1C, 0x00, // ##  ###   ###      
+	0x63, 0xF8, 0x00, // ##   #######       
+	0x01, 0xF0, 0x00, //       #####        
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @924 '6' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x07, 0xE0, 0x00, //     ######         
+	0x1F, 0xF8, 0x00, //   ##########       
+	0x3D, 0x98, 0x00, //  #### ##  ##       
+	0x33, 0x0C, 0x00, //  ##  ##    ##      
+	0x73, 0x0C, 0x00, // ###  ##    ##      
+	0x63, 0x0C, 0x00, // ##   ##    ##      
+	0x63, 0x9C, 0x00, // ##   ###  ###      
+	0x61, 0xF8, 0x00, // ##    ######       
+	0x60, 0xF0, 0x00, // ##     ####        
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @966 '7' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x70, 0x00, 0x00, // ###                
+	0x70, 0x00, 0x00, // ###                
+	0x60, 0x00, 0x00, // ##                 
+	0x60, 0x00, 0x00, // ##                 
+	0x60, 0x1C, 0x00, // ##        ###      
+	0x60, 0xFC, 0x00, // ##     ######      
+	0x67, 0xE0, 0x00, // ##  ######         
+	0x7F, 0x00, 0x00, // #######            
+	0x78, 0x00, 0x00, // ####               
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1008 '8' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x1C, 0xF0, 0x00, //   ###  ####        
+	0x3F, 0xF8, 0x00, //  ###########       
+	0x77, 0x9C, 0x00, // ### ####  ###      
+	0x63, 0x0C, 0x00, // ##   ##    ##      
+	0x63, 0x0C, 0x00, // ##   ##    ##      
+	0x63, 0x0C, 0x00, // ##   ##    ##      
+	0x77, 0x9C, 0x00, // ### ####  ###      
+	0x3F, 0xF8, 0x00, //  ###########       
+	0x1C, 0xF0, 0x00, //   ###  ####        
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1050 '9' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x1E, 0x0C, 0x00, //   ####     ##      
+	0x3F, 0x0C, 0x00, //  ######    ##      
+	0x73, 0x8C, 0x00, // ###  ###   ##      
+	0x61, 0x8C, 0x00, // ##    ##   ##      
+	0x61, 0x9C, 0x00, // ##    ##  ###      
+	0x61, 0x98, 0x00, // ##    ##  ##       
+	0x33, 0x78, 0x00, //  ##  ## ####       
+	0x3F, 0xF0, 0x00, //  ##########        
+	0x0F, 0xC0, 0x00, //    ######          
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1092 ':' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x07, 0x1C, 0x00, //     ###   ###      
+	0x07, 0x1C, 0x00, //     ###   ###      
+	0x07, 0x1C, 0x00, //     ###   ###      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1134 ';' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x07, 0x00, //             ###    
+	0x00, 0x1E, 0x00, //           ####     
+	0x07, 0x18, 0x00, //     ###   ##       
+	0x07, 0x10, 0x00, //     ###   #        
+	0x07, 0x00, 0x00, //     ###            
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1176 '<' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x80, 0x00, //        #           
+	0x00, 0x80, 0x00, //        #           
+	0x01, 0xC0, 0x00, //       ###          
+	0x01, 0xC0, 0x00, //       ###          
+	0x03, 0x60, 0x00, //      ## ##         
+	0x06, 0x30, 0x00, //     ##   ##        
+	0x06, 0x30, 0x00, //     ##   ##        
+	0x0C, 0x18, 0x00, //    ##     ##       
+	0x0C, 0x18, 0x00, //    ##     ##       
+	0x18, 0x0C, 0x00, //   ##       ##      
+	0x18, 0x0C, 0x00, //   ##       ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1218 '=' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x06, 0x60, 0x00, //     ##  ##         
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1260 '>' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x18, 0x0C, 0x00, //   ##       ##      
+	0x18, 0x0C, 0x00, //   ##       ##      
+	0x0C, 0x18, 0x00, //    ##     ##       
+	0x0C, 0x18, 0x00, //    ##     ##       
+	0x06, 0x30, 0x00, //     ##   ##        
+	0x06, 0x30, 0x00, //     ##   ##        
+	0x03, 0x60, 0x00, //      ## ##         
+	0x01, 0xC0, 0x00, //       ###          
+	0x01, 0xC0, 0x00, //       ###          
+	0x00, 0x80, 0x00, //        #           
+	0x00, 0x80, 0x00, //        #           
+	0x00, 0x00, 0x00, //                    
+
+	// @1302 '?' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x1C, 0x00, 0x00, //   ###              
+	0x3C, 0x00, 0x00, //  ####              
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0xCC, 0x00, //  ##    ##  ##      
+	0x31, 0xCC, 0x00, //  ##   ###  ##      
+	0x31, 0x80, 0x00, //  ##   ##           
+	0x1F, 0x00, 0x00, //   #####            
+	0x0E, 0x00, 0x00, //    ###             
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1344 '@' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x0F, 0xF0, 0x00, //    ########        
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x20, 0x02, 0x00, //  #           #     
+	0x41, 0xC2, 0x00, // #     ###    #     
+	0x42, 0x22, 0x00, // #    #   #   #     
+	0x62, 0x22, 0x00, // ##   #   #   #     
+	0x1F, 0xE4, 0x00, //   ########  #      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1386 'A' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x1C, 0x00, //           ###      
+	0x30, 0x7C, 0x00, //  ##     #####      
+	0x31, 0xEC, 0x00, //  ##   #### ##      
+	0x37, 0xE0, 0x00, //  ## ######         
+	0x3E, 0x60, 0x00, //  #####  ##         
+	0x38, 0x60, 0x00, //  ###    ##         
+	0x3F, 0x60, 0x00, //  ###### ##         
+	0x07, 0xEC, 0x00, //     ###### ##      
+	0x00, 0xFC, 0x00, //        ######      
+	0x00, 0x1C, 0x00, //           ###      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x00, 0x00, //                    
+
+	// @1428 'B' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x33, 0x8C, 0x00, //  ##  ###   ##      
+	0x1F, 0xCC, 0x00, //   #######  ##      
+	0x0E, 0xFC, 0x00, //    ### ######      
+	0x00, 0x78, 0x00, //         ####       
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1470 'C' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x07, 0xE0, 0x00, //     ######         
+	0x0F, 0xF0, 0x00, //    ########        
+	0x1C, 0x38, 0x00, //   ###    ###       
+	0x38, 0x1C, 0x00, //  ###      ###      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x18, 0x1C, 0x00, //   ##      ###      
+	0x3C, 0x38, 0x00, //  ####    ###       
+	0x3C, 0x30, 0x00, //  ####    ##        
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1512 'D' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x38, 0x1C, 0x00, //  ###      ###      
+	0x1C, 0x38, 0x00, //   ###    ###       
+	0x0F, 0xF0, 0x00, //    ########        
+	0x07, 0xE0, 0x00, //     ######         
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1554 'E' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x33, 0xCC, 0x00, //  ##  ####  ##      
+	0x33, 0xCC, 0x00, //  ##  ####  ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3C, 0x3C, 0x00, //  ####    ####      
+	0x3C, 0x3C, 0x00, //  ####    ####      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1596 'F' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x33, 0xCC, 0x00, //  ##  ####  ##      
+	0x33, 0xC0, 0x00, //  ##  ####          
+	0x30, 0x00, 0x00, //  ##                
+	0x3C, 0x00, 0x00, //  ####              
+	0x3C, 0x00, 0x00, //  ####              
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1638 'G' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x07, 0xE0, 0x00, //     ######         
+	0x1F, 0xF8, 0x00, //   ##########       
+	0x18, 0x18, 0x00, //   ##      ##       
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0xCC, 0x00, //  ##    ##  ##      
+	0x30, 0xCC, 0x00, //  ##    ##  ##      
+	0x18, 0xCC, 0x00, //   ##   ##  ##      
+	0x3C, 0xF8, 0x00, //  ####  #####       
+	0x3C, 0xF8, 0x00, //  ####  #####       
+	0x00, 0xC0, 0x00, //        ##          
+	0x00, 0x00, 0x00, //                    
+
+	// @1680 'H' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1722 'I' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1764 'J' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0xF8, 0x00, //        #####       
+	0x00, 0xF8, 0x00, //        #####       
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x0C, 0x00, //            ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x1C, 0x00, //  ##       ###      
+	0x3F, 0xF8, 0x00, //  ###########       
+	0x3F, 0xF0, 0x00, //  ##########        
+	0x30, 0x00, 0x00, //  ##                
+	0x30, 0x00, 0x00, //  ##                
+	0x00, 0x00, 0x00, //                    
+
+	// @1806 'K' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x33, 0x0C, 0x00, //  ##  ##    ##      
+	0x07, 0x80, 0x00, //     ####           
+	0x3C, 0xE0, 0x00, //  ####  ###         
+	0x38, 0x78, 0x00, //  ###    ####       
+	0x38, 0x1C, 0x00, //  ###      ###      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x00, 0x00, 0x00, //                    
+
+	// @1848 'L' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x7C, 0x00, //         #####      
+	0x00, 0x7C, 0x00, //         #####      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1890 'M' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3C, 0x0C, 0x00, //  ####      ##      
+	0x07, 0x8C, 0x00, //     ####   ##      
+	0x01, 0xE0, 0x00, //       ####         
+	0x01, 0xE0, 0x00, //       ####         
+	0x07, 0x8C, 0x00, //     ####   ##      
+	0x3C, 0x0C, 0x00, //  ####      ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x00, 0x00, 0x00, //                    
+
+	// @1932 'N' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x1E, 0x0C, 0x00, //   ####     ##      
+	0x07, 0x8C, 0x00, //     ####   ##      
+	0x31, 0xE0, 0x00, //  ##   ####         
+	0x30, 0x78, 0x00, //  ##     ####       
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x30, 0x00, 0x00, //  ##                
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @1974 'O' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x07, 0xE0, 0x00, //     ######         
+	0x0F, 0xF0, 0x00, //    ########        
+	0x1C, 0x38, 0x00, //   ###    ###       
+	0x38, 0x1C, 0x00, //  ###      ###      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x38, 0x1C, 0x00, //  ###      ###      
+	0x1C, 0x38, 0x00, //   ###    ###       
+	0x0F, 0xF0, 0x00, //    ########        
+	0x07, 0xE0, 0x00, //     ######         
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2016 'P' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x30, 0xCC, 0x00, //  ##    ##  ##      
+	0x30, 0xCC, 0x00, //  ##    ##  ##      
+	0x30, 0xCC, 0x00, //  ##    ##  ##      
+	0x30, 0xC0, 0x00, //  ##    ##          
+	0x39, 0xC0, 0x00, //  ###  ###          
+	0x1F, 0x80, 0x00, //   ######           
+	0x0F, 0x00, 0x00, //    ####            
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2058 'Q' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x07, 0xE0, 0x00, //     ######         
+	0x0F, 0xF0, 0x00, //    ########        
+	0x1C, 0x39, 0x80, //   ###    ###  ##   
+	0x38, 0x1F, 0x80, //  ###      ######   
+	0x30, 0x0F, 0x00, //  ##        ####    
+	0x30, 0x0F, 0x00, //  ##        ####    
+	0x38, 0x1F, 0x80, //  ###      ######   
+	0x1C, 0x39, 0x80, //   ###    ###  ##   
+	0x0F, 0xF3, 0x80, //    ########  ###   
+	0x07, 0xE3, 0x00, //     ######   ##    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2100 'R' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x31, 0x80, 0x00, //  ##   ##           
+	0x31, 0xC0, 0x00, //  ##   ###          
+	0x3B, 0xF0, 0x00, //  ### ######        
+	0x1F, 0x78, 0x00, //   ##### ####       
+	0x0E, 0x1C, 0x00, //    ###    ###      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x00, 0x00, //                    
+
+	// @2142 'S' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x0E, 0x3C, 0x00, //    ###   ####      
+	0x1F, 0x3C, 0x00, //   #####  ####      
+	0x3B, 0x18, 0x00, //  ### ##   ##       
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x31, 0x8C, 0x00, //  ##   ##   ##      
+	0x18, 0xDC, 0x00, //   ##   ## ###      
+	0x3C, 0xF8, 0x00, //  ####  #####       
+	0x3C, 0x70, 0x00, //  ####   ###        
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2184 'T' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x3E, 0x00, 0x00, //  #####             
+	0x3E, 0x00, 0x00, //  #####             
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x3E, 0x00, 0x00, //  #####             
+	0x3E, 0x00, 0x00, //  #####             
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2226 'U' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x00, 0x00, //  ##                
+	0x3F, 0xF0, 0x00, //  ##########        
+	0x3F, 0xF8, 0x00, //  ###########       
+	0x30, 0x1C, 0x00, //  ##       ###      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x0C, 0x00, //            ##      
+	0x30, 0x1C, 0x00, //  ##       ###      
+	0x3F, 0xF8, 0x00, //  ###########       
+	0x3F, 0xF0, 0x00, //  ##########        
+	0x30, 0x00, 0x00, //  ##                
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2268 'V' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x00, 0x00, //  ##                
+	0x3C, 0x00, 0x00, //  ####              
+	0x3F, 0x00, 0x00, //  ######            
+	0x33, 0xE0, 0x00, //  ##  #####         
+	0x00, 0xFC, 0x00, //        ######      
+	0x00, 0x1C, 0x00, //           ###      
+	0x00, 0xFC, 0x00, //        ######      
+	0x33, 0xE0, 0x00, //  ##  #####         
+	0x3F, 0x00, 0x00, //  ######            
+	0x3C, 0x00, 0x00, //  ####              
+	0x30, 0x00, 0x00, //  ##                
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2310 'W' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x00, 0x00, //  ##                
+	0x3F, 0x80, 0x00, //  #######           
+	0x3F, 0xFC, 0x00, //  ############      
+	0x30, 0x3C, 0x00, //  ##      ####      
+	0x30, 0xF8, 0x00, //  ##    #####       
+	0x07, 0xC0, 0x00, //     #####          
+	0x07, 0x00, 0x00, //     ###            
+	0x07, 0xC0, 0x00, //     #####          
+	0x30, 0xF8, 0x00, //  ##    #####       
+	0x30, 0x3C, 0x00, //  ##      ####      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x3F, 0x80, 0x00, //  #######           
+	0x30, 0x00, 0x00, //  ##                
+
+	// @2352 'X' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x38, 0x1C, 0x00, //  ###      ###      
+	0x3C, 0x3C, 0x00, //  ####    ####      
+	0x36, 0x6C, 0x00, //  ## ##  ## ##      
+	0x03, 0xC0, 0x00, //      ####          
+	0x01, 0x80, 0x00, //       ##           
+	0x03, 0xC0, 0x00, //      ####          
+	0x36, 0x6C, 0x00, //  ## ##  ## ##      
+	0x3C, 0x3C, 0x00, //  ####    ####      
+	0x38, 0x1C, 0x00, //  ###      ###      
+	0x30, 0x0C, 0x00, //  ##        ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2394 'Y' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x30, 0x00, 0x00, //  ##                
+	0x38, 0x00, 0x00, //  ###               
+	0x3C, 0x0C, 0x00, //  ####      ##      
+	0x37, 0x0C, 0x00, //  ## ###    ##      
+	0x03, 0xFC, 0x00, //      ########      
+	0x03, 0xFC, 0x00, //      ########      
+	0x37, 0x0C, 0x00, //  ## ###    ##      
+	0x3C, 0x0C, 0x00, //  ####      ##      
+	0x38, 0x00, 0x00, //  ###               
+	0x30, 0x00, 0x00, //  ##                
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2436 'Z' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x3C, 0x1C, 0x00, //  ####     ###      
+	0x3C, 0x3C, 0x00, //  ####    ####      
+	0x30, 0x6C, 0x00, //  ##     ## ##      
+	0x31, 0xCC, 0x00, //  ##   ###  ##      
+	0x33, 0x8C, 0x00, //  ##  ###   ##      
+	0x36, 0x0C, 0x00, //  ## ##     ##      
+	0x3C, 0x3C, 0x00, //  ####    ####      
+	0x38, 0x3C, 0x00, //  ###     ####      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2478 '[' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x7F, 0xFF, 0x80, // ################   
+	0x7F, 0xFF, 0x80, // ################   
+	0x60, 0x01, 0x80, // ##            ##   
+	0x60, 0x01, 0x80, // ##            ##   
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2520 '\' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0xC0, 0x00, 0x00, //##                  
+	0xF8, 0x00, 0x00, //#####               
+	0x3E, 0x00, 0x00, //  #####             
+	0x07, 0x80, 0x00, //     ####           
+	0x01, 0xE0, 0x00, //       ####         
+	0x00, 0x7C, 0x00, //         #####      
+	0x00, 0x1F, 0x00, //           #####    
+	0x00, 0x03, 0x00, //              ##    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2562 ']' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x60, 0x01, 0x80, // ##            ##   
+	0x60, 0x01, 0x80, // ##            ##   
+	0x7F, 0xFF, 0x80, // ################   
+	0x7F, 0xFF, 0x80, // ################   
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2604 '^' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x00, 0x00, //     ##             
+	0x0C, 0x00, 0x00, //    ##              
+	0x18, 0x00, 0x00, //   ##               
+	0x30, 0x00, 0x00, //  ##                
+	0x60, 0x00, 0x00, // ##                 
+	0x30, 0x00, 0x00, //  ##                
+	0x18, 0x00, 0x00, //   ##               
+	0x0C, 0x00, 0x00, //    ##              
+	0x06, 0x00, 0x00, //     ##             
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2646 '_' (14 columns)
+	0x00, 0x00, 0x30, //                  ##
+	0x00, 0x00, 0x30, //                  ##
+	0x00, 0x00, 0x30, //                  ##
+	0x00, 0x00, 0x30, //                  ##
+	0x00, 0x00, 0x30, //                  ##
+	0x00, 0x00, 0x30, //                  ##
+	0x00, 0x00, 0x30, //                  ##
+	0x00, 0x00, 0x30, //                  ##
+	0x00, 0x00, 0x30, //                  ##
+	0x00, 0x00, 0x30, //                  ##
+	0x00, 0x00, 0x30, //                  ##
+	0x00, 0x00, 0x30, //                  ##
+	0x00, 0x00, 0x30, //                  ##
+	0x00, 0x00, 0x30, //                  ##
+
+	// @2688 '`' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x40, 0x00, 0x00, // #                  
+	0x20, 0x00, 0x00, //  #                 
+	0x20, 0x00, 0x00, //  #                 
+	0x10, 0x00, 0x00, //   #                
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2730 'a' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x38, 0x00, //          ###       
+	0x02, 0x7C, 0x00, //      #  #####      
+	0x06, 0xEC, 0x00, //     ## ### ##      
+	0x06, 0xCC, 0x00, //     ## ##  ##      
+	0x06, 0xCC, 0x00, //     ## ##  ##      
+	0x06, 0xCC, 0x00, //     ## ##  ##      
+	0x06, 0xD8, 0x00, //     ## ## ##       
+	0x07, 0xFC, 0x00, //     #########      
+	0x03, 0xFC, 0x00, //      ########      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2772 'b' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x60, 0x0C, 0x00, // ##         ##      
+	0x7F, 0xFC, 0x00, // #############      
+	0x7F, 0xFC, 0x00, // #############      
+	0x03, 0x18, 0x00, //      ##   ##       
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x03, 0x18, 0x00, //      ##   ##       
+	0x03, 0xF8, 0x00, //      #######       
+	0x00, 0xE0, 0x00, //        ###         
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2814 'c' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0xF0, 0x00, //        ####        
+	0x03, 0xF8, 0x00, //      #######       
+	0x03, 0x1C, 0x00, //      ##   ###      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x02, 0x0C, 0x00, //      #     ##      
+	0x07, 0x98, 0x00, //     ####  ##       
+	0x07, 0x98, 0x00, //     ####  ##       
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2856 'd' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0xF0, 0x00, //        ####        
+	0x03, 0xF8, 0x00, //      #######       
+	0x03, 0x18, 0x00, //      ##   ##       
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x63, 0x18, 0x00, // ##   ##   ##       
+	0x7F, 0xFC, 0x00, // #############      
+	0x7F, 0xFC, 0x00, // #############      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x00, 0x00, //                    
+
+	// @2898 'e' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0xE0, 0x00, //        ###         
+	0x03, 0xF8, 0x00, //      #######       
+	0x03, 0xD8, 0x00, //      #### ##       
+	0x06, 0xCC, 0x00, //     ## ##  ##      
+	0x06, 0xCC, 0x00, //     ## ##  ##      
+	0x06, 0xCC, 0x00, //     ## ##  ##      
+	0x06, 0xCC, 0x00, //     ## ##  ##      
+	0x03, 0xCC, 0x00, //      ####  ##      
+	0x03, 0xD8, 0x00, //      #### ##       
+	0x00, 0xD8, 0x00, //        ## ##       
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2940 'f' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x3F, 0xFC, 0x00, //  ############      
+	0x7F, 0xFC, 0x00, // #############      
+	0x66, 0x0C, 0x00, // ##  ##     ##      
+	0x66, 0x0C, 0x00, // ##  ##     ##      
+	0x66, 0x0C, 0x00, // ##  ##     ##      
+	0x66, 0x0C, 0x00, // ##  ##     ##      
+	0x60, 0x00, 0x00, // ##                 
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @2982 'g' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0xE0, 0x00, //        ###         
+	0x03, 0xF8, 0x00, //      #######       
+	0x03, 0x18, 0xC0, //      ##   ##   ##  
+	0x06, 0x0C, 0xC0, //     ##     ##  ##  
+	0x06, 0x0C, 0xC0, //     ##     ##  ##  
+	0x06, 0x0C, 0xC0, //     ##     ##  ##  
+	0x06, 0x0C, 0xC0, //     ##     ##  ##  
+	0x03, 0x19, 0xC0, //      ##   ##  ###  
+	0x07, 0xFF, 0x80, //     ############   
+	0x07, 0xFF, 0x00, //     ###########    
+	0x06, 0x00, 0x00, //     ##             
+	0x00, 0x00, 0x00, //                    
+
+	// @3024 'h' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x60, 0x0C, 0x00, // ##         ##      
+	0x7F, 0xFC, 0x00, // #############      
+	0x7F, 0xFC, 0x00, // #############      
+	0x03, 0x0C, 0x00, //      ##    ##      
+	0x06, 0x00, 0x00, //     ##             
+	0x06, 0x00, 0x00, //     ##             
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x07, 0xFC, 0x00, //     #########      
+	0x03, 0xFC, 0x00, //      ########      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3066 'i' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x67, 0xFC, 0x00, // ##  #########      
+	0x67, 0xFC, 0x00, // ##  #########      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3108 'j' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0xC0, //                ##  
+	0x06, 0x00, 0xC0, //     ##         ##  
+	0x06, 0x00, 0xC0, //     ##         ##  
+	0x06, 0x00, 0xC0, //     ##         ##  
+	0x66, 0x00, 0xC0, // ##  ##         ##  
+	0x66, 0x01, 0xC0, // ##  ##        ###  
+	0x07, 0xFF, 0x80, //     ############   
+	0x07, 0xFF, 0x00, //     ###########    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3150 'k' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x60, 0x0C, 0x00, // ##         ##      
+	0x7F, 0xFC, 0x00, // #############      
+	0x7F, 0xFC, 0x00, // #############      
+	0x00, 0xC0, 0x00, //        ##          
+	0x07, 0xE0, 0x00, //     ######         
+	0x07, 0x3C, 0x00, //     ###  ####      
+	0x06, 0x1C, 0x00, //     ##    ###      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3192 'l' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x60, 0x0C, 0x00, // ##         ##      
+	0x60, 0x0C, 0x00, // ##         ##      
+	0x60, 0x0C, 0x00, // ##         ##      
+	0x7F, 0xFC, 0x00, // #############      
+	0x7F, 0xFC, 0x00, // #############      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3234 'm' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x07, 0xFC, 0x00, //     #########      
+	0x07, 0xFC, 0x00, //     #########      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x00, 0x00, //     ##             
+	0x07, 0xFC, 0x00, //     #########      
+	0x03, 0xFC, 0x00, //      ########      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x00, 0x00, //     ##             
+	0x07, 0xFC, 0x00, //     #########      
+	0x03, 0xFC, 0x00, //      ########      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x00, 0x00, //                    
+
+	// @3276 'n' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x07, 0xFC, 0x00, //     #########      
+	0x07, 0xFC, 0x00, //     #########      
+	0x03, 0x0C, 0x00, //      ##    ##      
+	0x06, 0x00, 0x00, //     ##             
+	0x06, 0x00, 0x00, //     ##             
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x07, 0xFC, 0x00, //     #########      
+	0x03, 0xFC, 0x00, //      ########      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3318 'o' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0xE0, 0x00, //        ###         
+	0x03, 0xF8, 0x00, //      #######       
+	0x03, 0x18, 0x00, //      ##   ##       
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x03, 0x18, 0x00, //      ##   ##       
+	0x03, 0xF8, 0x00, //      #######       
+	0x00, 0xE0, 0x00, //        ###         
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3360 'p' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x00, 0xC0, //     ##         ##  
+	0x07, 0xFF, 0xC0, //     #############  
+	0x07, 0xFF, 0xC0, //     #############  
+	0x03, 0x18, 0xC0, //      ##   ##   ##  
+	0x06, 0x0C, 0xC0, //     ##     ##  ##  
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x03, 0x18, 0x00, //      ##   ##       
+	0x03, 0xF8, 0x00, //      #######       
+	0x00, 0xE0, 0x00, //        ###         
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3402 'q' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0xE0, 0x00, //        ###         
+	0x03, 0xF8, 0x00, //      #######       
+	0x03, 0x18, 0x00, //      ##   ##       
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0xC0, //     ##     ##  ##  
+	0x03, 0x18, 0xC0, //      ##   ##   ##  
+	0x07, 0xFF, 0xC0, //     #############  
+	0x07, 0xFF, 0xC0, //     #############  
+	0x06, 0x00, 0xC0, //     ##         ##  
+	0x00, 0x00, 0x00, //                    
+
+	// @3444 'r' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x07, 0xFC, 0x00, //     #########      
+	0x07, 0xFC, 0x00, //     #########      
+	0x01, 0x8C, 0x00, //       ##   ##      
+	0x03, 0x0C, 0x00, //      ##    ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x07, 0x00, 0x00, //     ###            
+	0x03, 0x00, 0x00, //      ##            
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3486 's' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x03, 0x9C, 0x00, //      ###  ###      
+	0x03, 0xDC, 0x00, //      #### ###      
+	0x06, 0xCC, 0x00, //     ## ##  ##      
+	0x06, 0xCC, 0x00, //     ## ##  ##      
+	0x06, 0x6C, 0x00, //     ##  ## ##      
+	0x06, 0x6C, 0x00, //     ##  ## ##      
+	0x07, 0x78, 0x00, //     ### ####       
+	0x07, 0x38, 0x00, //     ###  ###       
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3528 't' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x00, 0x00, //     ##             
+	0x06, 0x00, 0x00, //     ##             
+	0x3F, 0xF8, 0x00, //  ###########       
+	0x3F, 0xFC, 0x00, //  ############      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x18, 0x00, //     ##    ##       
+	0x00, 0x18, 0x00, //           ##       
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3570 'u' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x00, 0x00, //     ##             
+	0x07, 0xF8, 0x00, //     ########       
+	0x07, 0xFC, 0x00, //     #########      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x0C, 0x00, //            ##      
+	0x06, 0x18, 0x00, //     ##    ##       
+	0x07, 0xFC, 0x00, //     #########      
+	0x07, 0xFC, 0x00, //     #########      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3612 'v' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x00, 0x00, //     ##             
+	0x07, 0x00, 0x00, //     ###            
+	0x07, 0xC0, 0x00, //     #####          
+	0x06, 0xF0, 0x00, //     ## ####        
+	0x00, 0x3C, 0x00, //          ####      
+	0x00, 0x0C, 0x00, //            ##      
+	0x00, 0x3C, 0x00, //          ####      
+	0x06, 0xF0, 0x00, //     ## ####        
+	0x07, 0xC0, 0x00, //     #####          
+	0x07, 0x00, 0x00, //     ###            
+	0x06, 0x00, 0x00, //     ##             
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3654 'w' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x00, 0x00, //     ##             
+	0x07, 0xC0, 0x00, //     #####          
+	0x07, 0xFC, 0x00, //     #########      
+	0x06, 0x3C, 0x00, //     ##   ####      
+	0x00, 0x70, 0x00, //         ###        
+	0x01, 0xC0, 0x00, //       ###          
+	0x00, 0x70, 0x00, //         ###        
+	0x06, 0x7C, 0x00, //     ##  #####      
+	0x07, 0xFC, 0x00, //     #########      
+	0x07, 0xC0, 0x00, //     #####          
+	0x06, 0x00, 0x00, //     ##             
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3696 'x' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x07, 0x1C, 0x00, //     ###   ###      
+	0x07, 0xBC, 0x00, //     #### ####      
+	0x00, 0xE0, 0x00, //        ###         
+	0x00, 0xE0, 0x00, //        ###         
+	0x07, 0xBC, 0x00, //     #### ####      
+	0x07, 0x1C, 0x00, //     ###   ###      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x06, 0x0C, 0x00, //     ##     ##      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3738 'y' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x06, 0x00, 0xC0, //     ##         ##  
+	0x07, 0x00, 0xC0, //     ###        ##  
+	0x07, 0xC0, 0xC0, //     #####      ##  
+	0x06, 0xF1, 0xC0, //     ## ####   ###  
+	0x00, 0x3F, 0xC0, //          ########  
+	0x00, 0x1E, 0xC0, //           #### ##  
+	0x00, 0x38, 0xC0, //          ###   ##  
+	0x06, 0xF0, 0x00, //     ## ####        
+	0x07, 0xC0, 0x00, //     #####          
+	0x07, 0x00, 0x00, //     ###            
+	0x06, 0x00, 0x00, //     ##             
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3780 'z' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x07, 0x0C, 0x00, //     ###    ##      
+	0x07, 0x1C, 0x00, //     ###   ###      
+	0x06, 0x3C, 0x00, //     ##   ####      
+	0x06, 0x6C, 0x00, //     ##  ## ##      
+	0x06, 0xCC, 0x00, //     ## ##  ##      
+	0x07, 0x8C, 0x00, //     ####   ##      
+	0x07, 0x1C, 0x00, //     ###   ###      
+	0x06, 0x1C, 0x00, //     ##    ###      
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3822 '{' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x40, 0x00, //         #          
+	0x00, 0xE0, 0x00, //        ###         
+	0x3F, 0xFF, 0x00, //  ##############    
+	0x7F, 0xBF, 0x80, // ######## #######   
+	0x60, 0x01, 0x80, // ##            ##   
+	0x60, 0x01, 0x80, // ##            ##   
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3864 '|' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x7F, 0xFF, 0x80, // ################   
+	0x7F, 0xFF, 0x80, // ################   
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3906 '}' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x60, 0x01, 0x80, // ##            ##   
+	0x60, 0x01, 0x80, // ##            ##   
+	0x7F, 0xBF, 0x80, // ######## #######   
+	0x3F, 0xFF, 0x00, //  ##############    
+	0x00, 0xE0, 0x00, //        ###         
+	0x00, 0x40, 0x00, //         #          
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+
+	// @3948 '~' (14 columns)
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+	0x01, 0x80, 0x00, //       ##           
+	0x01, 0x80, 0x00, //       ##           
+	0x03, 0x00, 0x00, //      ##            
+	0x03, 0x00, 0x00, //      ##            
+	0x03, 0x80, 0x00, //      ###           
+	0x01, 0xC0, 0x00, //       ###          
+	0x00, 0xC0, 0x00, //        ##          
+	0x00, 0xC0, 0x00, //        ##          
+	0x01, 0xC0, 0x00, //       ###          
+	0x01, 0x80, 0x00, //       ##           
+	0x00, 0x00, 0x00, //                    
+	0x00, 0x00, 0x00, //                    
+};
+
+// 17x24, 3 byte(s) per column
+const uint8_t Font24_Table_R270[] = 
+{
+	// @0 ' ' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @51 '!' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x3F, 0xE1, 0x80, //  #########    ##       
+	0x3F, 0xF9, 0x80, //  ###########  ##       
+	0x3F, 0xE1, 0x80, //  #########    ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @102 '"' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x1C, 0x00, 0x00, //   ###                  
+	0x1F, 0xC0, 0x00, //   #######              
+	0x1C, 0x00, 0x00, //   ###                  
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x1C, 0x00, 0x00, //   ###                  
+	0x1F, 0xC0, 0x00, //   #######              
+	0x1C, 0x00, 0x00, //   ###                  
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @153 '#' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0xBF, 0xC0, //       ## ########      
+	0x3F, 0xFF, 0xC0, //  ################      
+	0x3F, 0xD8, 0x00, //  ######## ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0xBF, 0xC0, //       ## ########      
+	0x3F, 0xFF, 0xC0, //  ################      
+	0x3F, 0xD8, 0x00, //  ######## ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @204 '$' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x07, 0x1F, 0x00, //     ###   #####        
+	0x0F, 0x9F, 0x00, //    #####  #####        
+	0x19, 0xCE, 0x00, //   ##  ###  ###         
+	0x18, 0xC3, 0x00, //   ##   ##    ##        
+	0x78, 0xC3, 0xF0, // ####   ##    ######    
+	0x78, 0xE3, 0xF0, // ####   ###   ######    
+	0x0E, 0x67, 0x00, //    ###  ##  ###        
+	0x1E, 0x7E, 0x00, //   ####  ######         
+	0x1E, 0x3C, 0x00, //   ####   ####          
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @255 '%' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x0F, 0x20, 0x00, //    ####  #             
+	0x1F, 0xA0, 0x00, //   ###### #             
+	0x39, 0xFE, 0x00, //  ###  ########         
+	0x30, 0xFF, 0x00, //  ##    ########        
+	0x30, 0xF3, 0x80, //  ##    ####  ###       
+	0x39, 0xE1, 0x80, //  ###  ####    ##       
+	0x1F, 0xE1, 0x80, //   ########    ##       
+	0x0F, 0xF3, 0x80, //    ########  ###       
+	0x00, 0xBF, 0x00, //        # ######        
+	0x00, 0x9E, 0x00, //        #  ####         
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @306 '&' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x0E, 0x00, //            ###         
+	0x03, 0x9F, 0x00, //      ###  #####        
+	0x07, 0xF9, 0x80, //     ########  ##       
+	0x0C, 0x71, 0x80, //    ##   ###   ##       
+	0x0C, 0x39, 0x80, //    ##    ###  ##       
+	0x0C, 0x1D, 0x80, //    ##     ### ##       
+	0x0E, 0x0F, 0x80, //    ###     #####       
+	0x0E, 0x0F, 0x00, //    ###     ####        
+	0x0C, 0x1F, 0x80, //    ##     ######       
+	0x00, 0x19, 0x80, //           ##  ##       
+	0x00, 0x19, 0x80, //           ##  ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @357 ''' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x1C, 0x00, 0x00, //   ###                  
+	0x1F, 0xC0, 0x00, //   #######              
+	0x1C, 0x00, 0x00, //   ###                  
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @408 '(' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0xFC, 0x00, //        ######          
+	0x07, 0xFF, 0x00, //     ###########        
+	0x0F, 0xFF, 0xC0, //    ##############      
+	0x1F, 0x03, 0xE0, //   #####      #####     
+	0x3C, 0x00, 0xF0, //  ####          ####    
+	0x30, 0x00, 0x30, //  ##              ##    
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @459 ')' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x30, 0x00, 0x30, //  ##              ##    
+	0x3C, 0x00, 0xF0, //  ####          ####    
+	0x1F, 0x03, 0xE0, //   #####      #####     
+	0x0F, 0xFF, 0xC0, //    ##############      
+	0x03, 0xFF, 0x80, //      ###########       
+	0x00, 0xFC, 0x00, //        ######          
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @510 '*' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x06, 0x00, 0x00, //     ##                 
+	0x06, 0x00, 0x00, //     ##                 
+	0x07, 0x30, 0x00, //     ###  ##            
+	0x03, 0xF0, 0x00, //      ######            
+	0x3F, 0xC0, 0x00, //  ########              
+	0x3F, 0xC0, 0x00, //  ########              
+	0x03, 0xF0, 0x00, //      ######            
+	0x07, 0x30, 0x00, //     ###  ##            
+	0x06, 0x00, 0x00, //     ##                 
+	0x06, 0x00, 0x00, //     ##                 
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @561 '+' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x0F, 0xFF, 0x00, //    ############        
+	0x0F, 0xFF, 0x00, //    ############        
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @612 ',' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x18, //                   ##   
+	0x00, 0x00, 0xF8, //                #####   
+	0x00, 0x03, 0xE0, //              #####     
+	0x00, 0x03, 0x80, //              ###       
+	0x00, 0x02, 0x00, //              #         
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @663 '-' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @714 '.' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x03, 0x80, //              ###       
+	0x00, 0x03, 0x80, //              ###       
+	0x00, 0x03, 0x80, //              ###       
+	0x00, 0x03, 0x80, //              ###       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @765 '/' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x70, //                 ###    
+	0x00, 0x01, 0xF0, //               #####    
+	0x00, 0x07, 0xC0, //             #####      
+	0x00, 0x1F, 0x00, //           #####        
+	0x00, 0x78, 0x00, //         ####           
+	0x01, 0xE0, 0x00, //       ####             
+	0x0F, 0x80, 0x00, //    #####               
+	0x3E, 0x00, 0x00, //  #####                 
+	0xF8, 0x00, 0x00, //#####                   
+	0xE0, 0x00, 0x00, //###                     
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @816 '0' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x03, 0xF8, 0x00, //      #######           
+	0x0F, 0xFE, 0x00, //    ###########         
+	0x1C, 0x07, 0x00, //   ###       ###        
+	0x30, 0x01, 0x80, //  ##           ##       
+	0x30, 0x01, 0x80, //  ##           ##       
+	0x30, 0x01, 0x80, //  ##           ##       
+	0x30, 0x01, 0x80, //  ##           ##       
+	0x1C, 0x07, 0x00, //   ###       ###        
+	0x0F, 0xFE, 0x00, //    ###########         
+	0x03, 0xF8, 0x00, //      #######           
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @867 '1' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x0C, 0x01, 0x80, //    ##         ##       
+	0x0C, 0x01, 0x80, //    ##         ##       
+	0x1C, 0x01, 0x80, //   ###         ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x3F, 0xFF, 0x80, //  ###############       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @918 '2' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x0E, 0x01, 0x80, //    ###        ##       
+	0x1E, 0x03, 0x80, //   ####       ###       
+	0x18, 0x07, 0x80, //   ##        ####       
+	0x30, 0x0D, 0x80, //  ##        ## ##       
+	0x30, 0x19, 0x80, //  ##       ##  ##       
+	0x30, 0x31, 0x80, //  ##      ##   ##       
+	0x30, 0x31, 0x80, //  ##      ##   ##       
+	0x30, 0x61, 0x80, //  ##     ##    ##       
+	0x18, 0xC1, 0x80, //   ##   ##     ##       
+	0x1F, 0x81, 0x80, //   ######      ##       
+	0x07, 0x01, 0x80, //     ###       ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @969 '3' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x03, 0x00, //              ##        
+	0x18, 0x03, 0x80, //   ##         ###       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x30, 0xC1, 0x80, //  ##    ##     ##       
+	0x30, 0xC1, 0x80, //  ##    ##     ##       
+	0x30, 0xC1, 0x80, //  ##    ##     ##       
+	0x39, 0xE1, 0x80, //  ###  ####    ##       
+	0x1F, 0x63, 0x00, //   ##### ##   ##        
+	0x0E, 0x3F, 0x00, //    ###   ######        
+	0x00, 0x1E, 0x00, //           ####         
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1020 '4' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x1C, 0x00, //           ###          
+	0x00, 0x3C, 0x00, //          ####          
+	0x00, 0xEC, 0x00, //        ### ##          
+	0x03, 0xCC, 0x00, //      ####  ##          
+	0x07, 0x0D, 0x80, //     ###    ## ##       
+	0x1C, 0x0D, 0x80, //   ###      ## ##       
+	0x38, 0x0D, 0x80, //  ###       ## ##       
+	0x3F, 0xFF, 0x80, //  ###############       
+	0x3F, 0xFF, 0x80, //  ###############       
+	0x00, 0x0D, 0x80, //            ## ##       
+	0x00, 0x0D, 0x80, //            ## ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1071 '5' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x03, 0x00, //              ##        
+	0x3F, 0xC3, 0x00, //  ########    ##        
+	0x3F, 0xC1, 0x80, //  ########     ##       
+	0x30, 0xC1, 0x80, //  ##    ##     ##       
+	0x31, 0x81, 0x80, //  ##   ##      ##       
+	0x31, 0x81, 0x80, //  ##   ##      ##       
+	0x31, 0x81, 0x80, //  ##   ##      ##       
+	0x31, 0x81, 0x80, //  ##   ##      ##       
+	0x30, 0xC3, 0x00, //  ##    ##    ##        
+	0x30, 0xFF, 0x00, //  ##    ########        
+	0x00, 0x3C, 0x00, //          ####          
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1122 '6' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x01, 0xFC, 0x00, //       #######          
+	0x07, 0xFF, 0x00, //     ###########        
+	0x0E, 0x63, 0x00, //    ###  ##   ##        
+	0x1C, 0xC1, 0x80, //   ###  ##     ##       
+	0x18, 0xC1, 0x80, //   ##   ##     ##       
+	0x30, 0xC1, 0x80, //  ##    ##     ##       
+	0x30, 0xC1, 0x80, //  ##    ##     ##       
+	0x30, 0x63, 0x80, //  ##     ##   ###       
+	0x30, 0x7F, 0x00, //  ##     #######        
+	0x30, 0x1E, 0x00, //  ##       ####         
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1173 '7' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x3C, 0x00, 0x00, //  ####                  
+	0x3C, 0x00, 0x00, //  ####                  
+	0x30, 0x00, 0x00, //  ##                    
+	0x30, 0x00, 0x00, //  ##                    
+	0x30, 0x03, 0x80, //  ##          ###       
+	0x30, 0x1F, 0x80, //  ##       ######       
+	0x30, 0xFE, 0x00, //  ##    #######         
+	0x37, 0xF0, 0x00, //  ## #######            
+	0x3F, 0x80, 0x00, //  #######               
+	0x3C, 0x00, 0x00, //  ####                  
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1224 '8' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x0E, 0x1E, 0x00, //    ###    ####         
+	0x1F, 0x3F, 0x00, //   #####  ######        
+	0x39, 0xE3, 0x80, //  ###  ####   ###       
+	0x30, 0xC1, 0x80, //  ##    ##     ##       
+	0x30, 0xC1, 0x80, //  ##    ##     ##       
+	0x30, 0xC1, 0x80, //  ##    ##     ##       
+	0x30, 0xC1, 0x80, //  ##    ##     ##       
+	0x39, 0xE3, 0x80, //  ###  ####   ###       
+	0x1F, 0x3F, 0x00, //   #####  ######        
+	0x0E, 0x1E, 0x00, //    ###    ####         
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1275 '9' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x0F, 0x01, 0x80, //    ####       ##       
+	0x1F, 0xC1, 0x80, //   #######     ##       
+	0x38, 0xC1, 0x80, //  ###   ##     ##       
+	0x30, 0x61, 0x80, //  ##     ##    ##       
+	0x30, 0x61, 0x80, //  ##     ##    ##       
+	0x30, 0x63, 0x00, //  ##     ##   ##        
+	0x30, 0x67, 0x00, //  ##     ##  ###        
+	0x18, 0xCE, 0x00, //   ##   ##  ###         
+	0x1F, 0xFC, 0x00, //   ###########          
+	0x07, 0xF0, 0x00, //     #######            
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1326 ':' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x03, 0x83, 0x80, //      ###     ###       
+	0x03, 0x83, 0x80, //      ###     ###       
+	0x03, 0x83, 0x80, //      ###     ###       
+	0x03, 0x83, 0x80, //      ###     ###       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1377 ';' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x60, //                 ##     
+	0x00, 0x03, 0xC0, //              ####      
+	0x03, 0x87, 0x80, //      ###    ####       
+	0x03, 0x86, 0x00, //      ###    ##         
+	0x03, 0x84, 0x00, //      ###    #          
+	0x03, 0x80, 0x00, //      ###               
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1428 '<' (17 columns)
+	0x00, 0x20, 0x00, //          #             
+	0x00, 0x20, 0x00, //          #             
+	0x00, 0x70, 0x00, //         ###            
+	0x00, 0x70, 0x00, //         ###            
+	0x00, 0xD8, 0x00, //        ## ##           
+	0x00, 0xD8, 0x00, //        ## ##           
+	0x01, 0x8C, 0x00, //       ##   ##          
+	0x01, 0x8C, 0x00, //       ##   ##          
+	0x03, 0x06, 0x00, //      ##     ##         
+	0x03, 0x06, 0x00, //      ##     ##         
+	0x06, 0x03, 0x00, //     ##       ##        
+	0x0E, 0x03, 0x80, //    ###       ###       
+	0x0C, 0x01, 0x80, //    ##         ##       
+	0x0C, 0x01, 0x80, //    ##         ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1479 '=' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x01, 0x98, 0x00, //       ##  ##           
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1530 '>' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x0C, 0x01, 0x80, //    ##         ##       
+	0x0C, 0x01, 0x80, //    ##         ##       
+	0x0E, 0x03, 0x80, //    ###       ###       
+	0x06, 0x03, 0x00, //     ##       ##        
+	0x03, 0x06, 0x00, //      ##     ##         
+	0x03, 0x06, 0x00, //      ##     ##         
+	0x01, 0x8C, 0x00, //       ##   ##          
+	0x01, 0x8C, 0x00, //       ##   ##          
+	0x00, 0xD8, 0x00, //        ## ##           
+	0x00, 0xD8, 0x00, //        ## ##           
+	0x00, 0x70, 0x00, //         ###            
+	0x00, 0x70, 0x00, //         ###            
+	0x00, 0x20, 0x00, //          #             
+	0x00, 0x20, 0x00, //          #             
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1581 '?' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x07, 0x00, 0x00, //     ###                
+	0x0F, 0x00, 0x00, //    ####                
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x39, 0x80, //   ##     ###  ##       
+	0x18, 0x39, 0x80, //   ##     ###  ##       
+	0x18, 0x70, 0x00, //   ##    ###            
+	0x1C, 0xE0, 0x00, //   ###  ###             
+	0x0F, 0xC0, 0x00, //    ######              
+	0x07, 0x80, 0x00, //     ####               
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1632 '@' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x03, 0xFE, 0x00, //      #########         
+	0x0F, 0xFF, 0x80, //    #############       
+	0x1C, 0x01, 0xC0, //   ###         ###      
+	0x38, 0x00, 0xE0, //  ###           ###     
+	0x30, 0xF0, 0x60, //  ##    ####     ##     
+	0x31, 0xF8, 0x60, //  ##   ######    ##     
+	0x33, 0x8C, 0x60, //  ##  ###   ##   ##     
+	0x3B, 0x0C, 0x60, //  ### ##    ##   ##     
+	0x1F, 0xFC, 0xC0, //   ###########  ##      
+	0x0F, 0xFC, 0xC0, //    ##########  ##      
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1683 'A' (17 columns)
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x03, 0x80, //              ###       
+	0x18, 0x0F, 0x80, //   ##       #####       
+	0x18, 0x3D, 0x80, //   ##     #### ##       
+	0x18, 0xF9, 0x80, //   ##   #####  ##       
+	0x1B, 0xD8, 0x00, //   ## #### ##           
+	0x1F, 0x18, 0x00, //   #####   ##           
+	0x1C, 0x18, 0x00, //   ###     ##           
+	0x0F, 0x19, 0x80, //    ####   ##  ##       
+	0x03, 0xF9, 0x80, //      #######  ##       
+	0x00, 0xF9, 0x80, //        #####  ##       
+	0x00, 0x1F, 0x80, //           ######       
+	0x00, 0x07, 0x80, //             ####       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x00, 0x00, //                        
+
+	// @1734 'B' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x1C, 0xE1, 0x80, //   ###  ###    ##       
+	0x0F, 0xF1, 0x80, //    ########   ##       
+	0x07, 0xBF, 0x00, //     #### ######        
+	0x00, 0x1E, 0x00, //           ####         
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1785 'C' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x01, 0xF8, 0x00, //       ######           
+	0x07, 0xFE, 0x00, //     ##########         
+	0x0E, 0x07, 0x00, //    ###      ###        
+	0x0C, 0x03, 0x00, //    ##        ##        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x0C, 0x03, 0x80, //    ##        ###       
+	0x1F, 0x07, 0x00, //   #####     ###        
+	0x1F, 0x06, 0x00, //   #####     ##         
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1836 'D' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x0C, 0x03, 0x80, //    ##        ###       
+	0x0E, 0x07, 0x00, //    ###      ###        
+	0x07, 0xFE, 0x00, //     ##########         
+	0x01, 0xF8, 0x00, //       ######           
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1887 'E' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x19, 0xF9, 0x80, //   ##  ######  ##       
+	0x19, 0xF9, 0x80, //   ##  ######  ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0x0F, 0x80, //   #####    #####       
+	0x1F, 0x0F, 0x80, //   #####    #####       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1938 'F' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x19, 0xF9, 0x80, //   ##  ######  ##       
+	0x19, 0xF9, 0x80, //   ##  ######  ##       
+	0x18, 0x00, 0x00, //   ##                   
+	0x18, 0x00, 0x00, //   ##                   
+	0x1F, 0x00, 0x00, //   #####                
+	0x1F, 0x00, 0x00, //   #####                
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @1989 'G' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x01, 0xFC, 0x00, //       #######          
+	0x07, 0xFE, 0x00, //     ##########         
+	0x0E, 0x07, 0x00, //    ###      ###        
+	0x0C, 0x03, 0x00, //    ##        ##        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x31, 0x80, //   ##     ##   ##       
+	0x18, 0x31, 0x80, //   ##     ##   ##       
+	0x18, 0x31, 0x80, //   ##     ##   ##       
+	0x0C, 0x33, 0x80, //    ##    ##  ###       
+	0x1F, 0x3F, 0x00, //   #####  ######        
+	0x1F, 0x3F, 0x00, //   #####  ######        
+	0x00, 0x30, 0x00, //          ##            
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2040 'H' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x60, 0x00, //         ##             
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2091 'I' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2142 'J' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x3F, 0x00, //          ######        
+	0x00, 0x3F, 0x00, //          ######        
+	0x00, 0x01, 0x80, //               ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x03, 0x00, //   ##         ##        
+	0x1F, 0xFF, 0x00, //   #############        
+	0x1F, 0xFC, 0x00, //   ###########          
+	0x18, 0x00, 0x00, //   ##                   
+	0x18, 0x00, 0x00, //   ##                   
+	0x18, 0x00, 0x00, //   ##                   
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2193 'K' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x18, 0x31, 0x80, //   ##     ##   ##       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0xE1, 0x80, //   ##   ###    ##       
+	0x01, 0xF0, 0x00, //       #####            
+	0x03, 0x38, 0x00, //      ##  ###           
+	0x1E, 0x1E, 0x00, //   ####    ####         
+	0x1C, 0x0F, 0x80, //   ###      #####       
+	0x18, 0x03, 0x80, //   ##         ###       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x00, 0x00, //                        
+
+	// @2244 'L' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x1F, 0x80, //           ######       
+	0x00, 0x1F, 0x80, //           ######       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2295 'M' (17 columns)
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x0F, 0x01, 0x80, //    ####       ##       
+	0x03, 0xC1, 0x80, //      ####     ##       
+	0x00, 0xF1, 0x80, //        ####   ##       
+	0x00, 0x38, 0x00, //          ###           
+	0x00, 0x38, 0x00, //          ###           
+	0x00, 0xF1, 0x80, //        ####   ##       
+	0x03, 0xC1, 0x80, //      ####     ##       
+	0x0F, 0x01, 0x80, //    ####       ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x00, 0x00, 0x00, //                        
+
+	// @2346 'N' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x07, 0x01, 0x80, //     ###       ##       
+	0x03, 0xC1, 0x80, //      ####     ##       
+	0x01, 0xE1, 0x80, //       ####    ##       
+	0x18, 0x78, 0x00, //   ##    ####           
+	0x18, 0x3C, 0x00, //   ##     ####          
+	0x18, 0x0E, 0x00, //   ##       ###         
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x18, 0x00, 0x00, //   ##                   
+	0x18, 0x00, 0x00, //   ##                   
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2397 'O' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x01, 0xF8, 0x00, //       ######           
+	0x07, 0xFE, 0x00, //     ##########         
+	0x0F, 0x0F, 0x00, //    ####    ####        
+	0x0C, 0x03, 0x00, //    ##        ##        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x0C, 0x03, 0x00, //    ##        ##        
+	0x0F, 0x0F, 0x00, //    ####    ####        
+	0x07, 0xFE, 0x00, //     ##########         
+	0x01, 0xF8, 0x00, //       ######           
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2448 'P' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x18, 0x31, 0x80, //   ##     ##   ##       
+	0x18, 0x31, 0x80, //   ##     ##   ##       
+	0x18, 0x31, 0x80, //   ##     ##   ##       
+	0x18, 0x31, 0x80, //   ##     ##   ##       
+	0x18, 0x30, 0x00, //   ##     ##            
+	0x1C, 0x60, 0x00, //   ###   ##             
+	0x0F, 0xE0, 0x00, //    #######             
+	0x07, 0x80, 0x00, //     ####               
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2499 'Q' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x01, 0xF8, 0x00, //       ######           
+	0x07, 0xFE, 0x00, //     ##########         
+	0x0F, 0x0F, 0x30, //    ####    ####  ##    
+	0x0C, 0x03, 0xF0, //    ##        ######    
+	0x18, 0x01, 0xE0, //   ##          ####     
+	0x18, 0x01, 0xE0, //   ##          ####     
+	0x18, 0x01, 0xE0, //   ##          ####     
+	0x18, 0x01, 0xE0, //   ##          ####     
+	0x0C, 0x03, 0x30, //    ##        ##  ##    
+	0x0F, 0x0F, 0x30, //    ####    ####  ##    
+	0x07, 0xFE, 0x70, //     ##########  ###    
+	0x01, 0xF8, 0x60, //       ######    ##     
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2550 'R' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0x70, 0x00, //   ##    ###            
+	0x18, 0x78, 0x00, //   ##    ####           
+	0x1C, 0xDE, 0x00, //   ###  ## ####         
+	0x0F, 0xCF, 0x00, //    ######  ####        
+	0x07, 0x83, 0x80, //     ####     ###       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2601 'S' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x07, 0x8F, 0x80, //     ####   #####       
+	0x0F, 0xCF, 0x80, //    ######  #####       
+	0x1C, 0xC3, 0x00, //   ###  ##    ##        
+	0x18, 0xE1, 0x80, //   ##   ###    ##       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0x71, 0x80, //   ##    ###   ##       
+	0x0C, 0x33, 0x80, //    ##    ##  ###       
+	0x1F, 0x3F, 0x00, //   #####  ######        
+	0x1F, 0x1E, 0x00, //   #####   ####         
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2652 'T' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x1F, 0x80, 0x00, //   ######               
+	0x1F, 0x80, 0x00, //   ######               
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1F, 0x80, 0x00, //   ######               
+	0x1F, 0x80, 0x00, //   ######               
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2703 'U' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x00, 0x00, //   ##                   
+	0x18, 0x00, 0x00, //   ##                   
+	0x1F, 0xFC, 0x00, //   ###########          
+	0x1F, 0xFF, 0x00, //   #############        
+	0x18, 0x03, 0x00, //   ##         ##        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x03, 0x00, //   ##         ##        
+	0x1F, 0xFF, 0x00, //   #############        
+	0x1F, 0xFC, 0x00, //   ###########          
+	0x18, 0x00, 0x00, //   ##                   
+	0x18, 0x00, 0x00, //   ##                   
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2754 'V' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x00, 0x00, //   ##                   
+	0x18, 0x00, 0x00, //   ##                   
+	0x1C, 0x00, 0x00, //   ###                  
+	0x1F, 0x80, 0x00, //   ######               
+	0x1B, 0xE0, 0x00, //   ## #####             
+	0x18, 0x7C, 0x00, //   ##    #####          
+	0x18, 0x1F, 0x00, //   ##      #####        
+	0x00, 0x03, 0x80, //              ###       
+	0x18, 0x1F, 0x00, //   ##      #####        
+	0x18, 0x7C, 0x00, //   ##    #####          
+	0x1B, 0xE0, 0x00, //   ## #####             
+	0x1F, 0x80, 0x00, //   ######               
+	0x1C, 0x00, 0x00, //   ###                  
+	0x18, 0x00, 0x00, //   ##                   
+	0x18, 0x00, 0x00, //   ##                   
+	0x00, 0x00, 0x00, //                        
+
+	// @2805 'W' (17 columns)
+	0x18, 0x00, 0x00, //   ##                   
+	0x18, 0x00, 0x00, //   ##                   
+	0x1F, 0x00, 0x00, //   #####                
+	0x1F, 0xF8, 0x00, //   ##########           
+	0x18, 0xFF, 0x80, //   ##   #########       
+	0x18, 0x0F, 0x80, //   ##       #####       
+	0x18, 0x3E, 0x00, //   ##     #####         
+	0x00, 0xF0, 0x00, //        ####            
+	0x01, 0xC0, 0x00, //       ###              
+	0x00, 0xF8, 0x00, //        #####           
+	0x18, 0x3E, 0x00, //   ##     #####         
+	0x18, 0x0F, 0x80, //   ##       #####       
+	0x18, 0xFF, 0x80, //   ##   #########       
+	0x1F, 0xF8, 0x00, //   ##########           
+	0x1F, 0x00, 0x00, //   #####                
+	0x18, 0x00, 0x00, //   ##                   
+	0x18, 0x00, 0x00, //   ##                   
+
+	// @2856 'X' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x1C, 0x03, 0x80, //   ###        ###       
+	0x1E, 0x07, 0x80, //   ####      ####       
+	0x1B, 0x0D, 0x80, //   ## ##    ## ##       
+	0x19, 0x99, 0x80, //   ##  ##  ##  ##       
+	0x00, 0xF0, 0x00, //        ####            
+	0x00, 0xF0, 0x00, //        ####            
+	0x19, 0x99, 0x80, //   ##  ##  ##  ##       
+	0x1B, 0x0D, 0x80, //   ## ##    ## ##       
+	0x1E, 0x07, 0x80, //   ####      ####       
+	0x1C, 0x03, 0x80, //   ###        ###       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x18, 0x01, 0x80, //   ##          ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2907 'Y' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x18, 0x00, 0x00, //   ##                   
+	0x18, 0x00, 0x00, //   ##                   
+	0x1C, 0x00, 0x00, //   ###                  
+	0x1E, 0x01, 0x80, //   ####        ##       
+	0x1B, 0x81, 0x80, //   ## ###      ##       
+	0x01, 0xC1, 0x80, //       ###     ##       
+	0x00, 0x7F, 0x80, //         ########       
+	0x00, 0x7F, 0x80, //         ########       
+	0x19, 0xC1, 0x80, //   ##  ###     ##       
+	0x1B, 0x81, 0x80, //   ## ###      ##       
+	0x1E, 0x01, 0x80, //   ####        ##       
+	0x1C, 0x00, 0x00, //   ###                  
+	0x18, 0x00, 0x00, //   ##                   
+	0x18, 0x00, 0x00, //   ##                   
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @2958 'Z' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x03, 0x80, //              ###       
+	0x1F, 0x87, 0x80, //   ######    ####       
+	0x1F, 0x8D, 0x80, //   ######   ## ##       
+	0x18, 0x19, 0x80, //   ##      ##  ##       
+	0x18, 0x31, 0x80, //   ##     ##   ##       
+	0x18, 0x61, 0x80, //   ##    ##    ##       
+	0x18, 0xC1, 0x80, //   ##   ##     ##       
+	0x19, 0x81, 0x80, //   ##  ##      ##       
+	0x1B, 0x01, 0x80, //   ## ##       ##       
+	0x1E, 0x1F, 0x80, //   ####    ######       
+	0x1C, 0x1F, 0x80, //   ###     ######       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3009 '[' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x3F, 0xFF, 0xF0, //  ##################    
+	0x3F, 0xFF, 0xF0, //  ##################    
+	0x30, 0x00, 0x30, //  ##              ##    
+	0x30, 0x00, 0x30, //  ##              ##    
+	0x30, 0x00, 0x30, //  ##              ##    
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3060 '\' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0xE0, 0x00, 0x00, //###                     
+	0xF8, 0x00, 0x00, //#####                   
+	0x3E, 0x00, 0x00, //  #####                 
+	0x0F, 0x80, 0x00, //    #####               
+	0x01, 0xE0, 0x00, //       ####             
+	0x00, 0x78, 0x00, //         ####           
+	0x00, 0x1F, 0x00, //           #####        
+	0x00, 0x07, 0xC0, //             #####      
+	0x00, 0x01, 0xF0, //               #####    
+	0x00, 0x00, 0x70, //                 ###    
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3111 ']' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x30, 0x00, 0x30, //  ##              ##    
+	0x30, 0x00, 0x30, //  ##              ##    
+	0x30, 0x00, 0x30, //  ##              ##    
+	0x3F, 0xFF, 0xF0, //  ##################    
+	0x3F, 0xFF, 0xF0, //  ##################    
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3162 '^' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x01, 0x80, 0x00, //       ##               
+	0x03, 0x00, 0x00, //      ##                
+	0x0E, 0x00, 0x00, //    ###                 
+	0x1C, 0x00, 0x00, //   ###                  
+	0x38, 0x00, 0x00, //  ###                   
+	0x70, 0x00, 0x00, // ###                    
+	0x38, 0x00, 0x00, //  ###                   
+	0x1C, 0x00, 0x00, //   ###                  
+	0x0E, 0x00, 0x00, //    ###                 
+	0x03, 0x00, 0x00, //      ##                
+	0x01, 0x80, 0x00, //       ##               
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3213 '_' (17 columns)
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x03, //                      ##
+	0x00, 0x00, 0x00, //                        
+
+	// @3264 '`' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x60, 0x00, 0x00, // ##                     
+	0x60, 0x00, 0x00, // ##                     
+	0x30, 0x00, 0x00, //  ##                    
+	0x18, 0x00, 0x00, //   ##                   
+	0x18, 0x00, 0x00, //   ##                   
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3315 'a' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x0E, 0x00, //            ###         
+	0x01, 0x1F, 0x00, //       #   #####        
+	0x03, 0x19, 0x80, //      ##   ##  ##       
+	0x03, 0x31, 0x80, //      ##  ##   ##       
+	0x03, 0x31, 0x80, //      ##  ##   ##       
+	0x03, 0x31, 0x80, //      ##  ##   ##       
+	0x03, 0x31, 0x80, //      ##  ##   ##       
+	0x03, 0x33, 0x00, //      ##  ##  ##        
+	0x01, 0xFF, 0x80, //       ##########       
+	0x00, 0xFF, 0x80, //        #########       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3366 'b' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x30, 0x01, 0x80, //  ##           ##       
+	0x30, 0x01, 0x80, //  ##           ##       
+	0x3F, 0xFF, 0x80, //  ###############       
+	0x3F, 0xFF, 0x80, //  ###############       
+	0x01, 0x83, 0x00, //       ##     ##        
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x01, 0x83, 0x00, //       ##     ##        
+	0x01, 0xFF, 0x00, //       #########        
+	0x00, 0x7C, 0x00, //         #####          
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3417 'c' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x7C, 0x00, //         #####          
+	0x00, 0xFE, 0x00, //        #######         
+	0x01, 0xC7, 0x00, //       ###   ###        
+	0x01, 0x83, 0x00, //       ##     ##        
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x01, 0x83, 0x80, //       ##     ###       
+	0x03, 0xE7, 0x00, //      #####  ###        
+	0x03, 0xE6, 0x00, //      #####  ##         
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3468 'd' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x7C, 0x00, //         #####          
+	0x01, 0xFF, 0x00, //       #########        
+	0x01, 0x83, 0x00, //       ##     ##        
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x33, 0x01, 0x80, //  ##  ##       ##       
+	0x31, 0x83, 0x00, //  ##   ##     ##        
+	0x3F, 0xFF, 0x80, //  ###############       
+	0x3F, 0xFF, 0x80, //  ###############       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3519 'e' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x7C, 0x00, //         #####          
+	0x01, 0xFF, 0x00, //       #########        
+	0x01, 0xB3, 0x00, //       ## ##  ##        
+	0x03, 0x31, 0x80, //      ##  ##   ##       
+	0x03, 0x31, 0x80, //      ##  ##   ##       
+	0x03, 0x31, 0x80, //      ##  ##   ##       
+	0x03, 0x31, 0x80, //      ##  ##   ##       
+	0x03, 0x31, 0x80, //      ##  ##   ##       
+	0x03, 0x31, 0x80, //      ##  ##   ##       
+	0x01, 0xB1, 0x80, //       ## ##   ##       
+	0x01, 0xF3, 0x00, //       #####  ##        
+	0x00, 0x73, 0x00, //         ###  ##        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3570 'f' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x0F, 0xFF, 0x80, //    #############       
+	0x1F, 0xFF, 0x80, //   ##############       
+	0x33, 0x01, 0x80, //  ##  ##       ##       
+	0x33, 0x01, 0x80, //  ##  ##       ##       
+	0x33, 0x01, 0x80, //  ##  ##       ##       
+	0x33, 0x01, 0x80, //  ##  ##       ##       
+	0x33, 0x01, 0x80, //  ##  ##       ##       
+	0x33, 0x00, 0x00, //  ##  ##                
+	0x30, 0x00, 0x00, //  ##                    
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3621 'g' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x7C, 0x00, //         #####          
+	0x01, 0xFF, 0x00, //       #########        
+	0x01, 0x83, 0x0C, //       ##     ##    ##  
+	0x03, 0x01, 0x8C, //      ##       ##   ##  
+	0x03, 0x01, 0x8C, //      ##       ##   ##  
+	0x03, 0x01, 0x8C, //      ##       ##   ##  
+	0x03, 0x01, 0x8C, //      ##       ##   ##  
+	0x03, 0x01, 0x8C, //      ##       ##   ##  
+	0x01, 0x83, 0x18, //       ##     ##   ##   
+	0x03, 0xFF, 0xF8, //      ###############   
+	0x03, 0xFF, 0xF0, //      ##############    
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0x00, 0x00, //      ##                
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3672 'h' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x30, 0x01, 0x80, //  ##           ##       
+	0x30, 0x01, 0x80, //  ##           ##       
+	0x3F, 0xFF, 0x80, //  ###############       
+	0x3F, 0xFF, 0x80, //  ###############       
+	0x01, 0x81, 0x80, //       ##      ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x81, 0x80, //      ###      ##       
+	0x01, 0xFF, 0x80, //       ##########       
+	0x00, 0xFF, 0x80, //        #########       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3723 'i' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x01, 0x80, //               ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x33, 0xFF, 0x80, //  ##  ###########       
+	0x33, 0xFF, 0x80, //  ##  ###########       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3774 'j' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x03, 0x00, 0x0C, //      ##            ##  
+	0x03, 0x00, 0x0C, //      ##            ##  
+	0x03, 0x00, 0x0C, //      ##            ##  
+	0x03, 0x00, 0x0C, //      ##            ##  
+	0x03, 0x00, 0x0C, //      ##            ##  
+	0x33, 0x00, 0x0C, //  ##  ##            ##  
+	0x33, 0x00, 0x18, //  ##  ##           ##   
+	0x03, 0xFF, 0xF8, //      ###############   
+	0x03, 0xFF, 0xF0, //      ##############    
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3825 'k' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x30, 0x01, 0x80, //  ##           ##       
+	0x30, 0x01, 0x80, //  ##           ##       
+	0x3F, 0xFF, 0x80, //  ###############       
+	0x3F, 0xFF, 0x80, //  ###############       
+	0x00, 0x38, 0x00, //          ###           
+	0x00, 0x7C, 0x00, //         #####          
+	0x03, 0xEE, 0x00, //      ##### ###         
+	0x03, 0x87, 0x80, //      ###    ####       
+	0x03, 0x03, 0x80, //      ##      ###       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3876 'l' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x01, 0x80, //               ##       
+	0x30, 0x01, 0x80, //  ##           ##       
+	0x30, 0x01, 0x80, //  ##           ##       
+	0x30, 0x01, 0x80, //  ##           ##       
+	0x30, 0x01, 0x80, //  ##           ##       
+	0x3F, 0xFF, 0x80, //  ###############       
+	0x3F, 0xFF, 0x80, //  ###############       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @3927 'm' (17 columns)
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0xFF, 0x80, //      ###########       
+	0x03, 0xFF, 0x80, //      ###########       
+	0x01, 0x81, 0x80, //       ##      ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0xFF, 0x80, //      ###########       
+	0x01, 0xFF, 0x80, //       ##########       
+	0x03, 0x81, 0x80, //      ###      ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0xFF, 0x80, //      ###########       
+	0x01, 0xFF, 0x80, //       ##########       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x00, 0x00, //                        
+
+	// @3978 'n' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0xFF, 0x80, //      ###########       
+	0x03, 0xFF, 0x80, //      ###########       
+	0x01, 0x81, 0x80, //       ##      ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x81, 0x80, //      ###      ##       
+	0x01, 0xFF, 0x80, //       ##########       
+	0x00, 0xFF, 0x80, //        #########       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4029 'o' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x7C, 0x00, //         #####          
+	0x00, 0xFE, 0x00, //        #######         
+	0x01, 0xC7, 0x00, //       ###   ###        
+	0x01, 0x83, 0x00, //       ##     ##        
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x01, 0x83, 0x00, //       ##     ##        
+	0x01, 0xC7, 0x00, //       ###   ###        
+	0x00, 0xFE, 0x00, //        #######         
+	0x00, 0x7C, 0x00, //         #####          
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4080 'p' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x03, 0x00, 0x0C, //      ##            ##  
+	0x03, 0x00, 0x0C, //      ##            ##  
+	0x03, 0xFF, 0xFC, //      ################  
+	0x03, 0xFF, 0xFC, //      ################  
+	0x01, 0x83, 0x0C, //       ##     ##    ##  
+	0x03, 0x01, 0x8C, //      ##       ##   ##  
+	0x03, 0x01, 0x8C, //      ##       ##   ##  
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x01, 0x83, 0x00, //       ##     ##        
+	0x01, 0xFF, 0x00, //       #########        
+	0x00, 0x7C, 0x00, //         #####          
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4131 'q' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x7C, 0x00, //         #####          
+	0x01, 0xFF, 0x00, //       #########        
+	0x01, 0x83, 0x00, //       ##     ##        
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x8C, //      ##       ##   ##  
+	0x03, 0x01, 0x8C, //      ##       ##   ##  
+	0x01, 0x83, 0x0C, //       ##     ##    ##  
+	0x03, 0xFF, 0xFC, //      ################  
+	0x03, 0xFF, 0xFC, //      ################  
+	0x03, 0x00, 0x0C, //      ##            ##  
+	0x03, 0x00, 0x0C, //      ##            ##  
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4182 'r' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0xFF, 0x80, //      ###########       
+	0x03, 0xFF, 0x80, //      ###########       
+	0x00, 0xC1, 0x80, //        ##     ##       
+	0x01, 0x81, 0x80, //       ##      ##       
+	0x03, 0x81, 0x80, //      ###      ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x80, 0x00, //      ###               
+	0x01, 0x80, 0x00, //       ##               
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4233 's' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0xE7, 0x80, //        ###  ####       
+	0x01, 0xF7, 0x80, //       ##### ####       
+	0x03, 0x31, 0x80, //      ##  ##   ##       
+	0x03, 0x31, 0x80, //      ##  ##   ##       
+	0x03, 0x31, 0x80, //      ##  ##   ##       
+	0x03, 0x39, 0x80, //      ##  ###  ##       
+	0x03, 0x19, 0x80, //      ##   ##  ##       
+	0x03, 0x1B, 0x80, //      ##   ## ###       
+	0x03, 0xDF, 0x00, //      #### #####        
+	0x03, 0xCE, 0x00, //      ####  ###         
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4284 't' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0x00, 0x00, //      ##                
+	0x3F, 0xFE, 0x00, //  #############         
+	0x3F, 0xFF, 0x00, //  ##############        
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x03, 0x80, //      ##      ###       
+	0x00, 0x03, 0x00, //              ##        
+	0x00, 0x03, 0x00, //              ##        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4335 'u' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0xFE, 0x00, //      #########         
+	0x03, 0xFF, 0x00, //      ##########        
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x03, 0x00, //      ##      ##        
+	0x03, 0xFF, 0x80, //      ###########       
+	0x03, 0xFF, 0x80, //      ###########       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x01, 0x80, //               ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4386 'v' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0xC0, 0x00, //      ####              
+	0x03, 0xF0, 0x00, //      ######            
+	0x03, 0x3E, 0x00, //      ##  #####         
+	0x00, 0x0F, 0x80, //            #####       
+	0x00, 0x03, 0x80, //              ###       
+	0x00, 0x03, 0x80, //              ###       
+	0x00, 0x0F, 0x80, //            #####       
+	0x03, 0x3E, 0x00, //      ##  #####         
+	0x03, 0xF0, 0x00, //      ######            
+	0x03, 0xC0, 0x00, //      ####              
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0x00, 0x00, //      ##                
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4437 'w' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0xE0, 0x00, //      #####             
+	0x03, 0xFE, 0x00, //      #########         
+	0x03, 0x1F, 0x80, //      ##   ######       
+	0x00, 0x0F, 0x80, //            #####       
+	0x00, 0x7C, 0x00, //         #####          
+	0x00, 0xE0, 0x00, //        ###             
+	0x00, 0x7C, 0x00, //         #####          
+	0x00, 0x0F, 0x80, //            #####       
+	0x03, 0x1F, 0x80, //      ##   ######       
+	0x03, 0xFC, 0x00, //      ########          
+	0x03, 0xE0, 0x00, //      #####             
+	0x03, 0x00, 0x00, //      ##                
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4488 'x' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x83, 0x80, //      ###     ###       
+	0x03, 0xC7, 0x80, //      ####   ####       
+	0x03, 0x6D, 0x80, //      ## ## ## ##       
+	0x00, 0x38, 0x00, //          ###           
+	0x00, 0x38, 0x00, //          ###           
+	0x03, 0x6D, 0x80, //      ## ## ## ##       
+	0x03, 0xC7, 0x80, //      ####   ####       
+	0x03, 0x83, 0x80, //      ###     ###       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x03, 0x01, 0x80, //      ##       ##       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4539 'y' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0x00, 0x0C, //      ##            ##  
+	0x03, 0x80, 0x0C, //      ###           ##  
+	0x03, 0xE0, 0x0C, //      #####         ##  
+	0x03, 0x78, 0x0C, //      ## ####       ##  
+	0x03, 0x1E, 0x1C, //      ##   ####    ###  
+	0x00, 0x07, 0x7C, //             ### #####  
+	0x00, 0x03, 0xEC, //              ##### ##  
+	0x00, 0x07, 0x8C, //             ####   ##  
+	0x00, 0x1E, 0x00, //           ####         
+	0x03, 0x78, 0x00, //      ## ####           
+	0x03, 0xE0, 0x00, //      #####             
+	0x03, 0x80, 0x00, //      ###               
+	0x03, 0x00, 0x00, //      ##                
+	0x03, 0x00, 0x00, //      ##                
+	0x00, 0x00, 0x00, //                        
+
+	// @4590 'z' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x03, 0xC1, 0x80, //      ####     ##       
+	0x03, 0xC3, 0x80, //      ####    ###       
+	0x03, 0x07, 0x80, //      ##     ####       
+	0x03, 0x0D, 0x80, //      ##    ## ##       
+	0x03, 0x19, 0x80, //      ##   ##  ##       
+	0x03, 0x31, 0x80, //      ##  ##   ##       
+	0x03, 0x61, 0x80, //      ## ##    ##       
+	0x03, 0xC1, 0x80, //      ####     ##       
+	0x03, 0x87, 0x80, //      ###    ####       
+	0x03, 0x07, 0x80, //      ##     ####       
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4641 '{' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x10, 0x00, //           #            
+	0x00, 0x38, 0x00, //          ###           
+	0x1F, 0xFF, 0xE0, //   ################     
+	0x3F, 0xEF, 0xF0, //  ######### ########    
+	0x30, 0x00, 0x30, //  ##              ##    
+	0x30, 0x00, 0x30, //  ##              ##    
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4692 '|' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x3F, 0xFF, 0xF0, //  ##################    
+	0x3F, 0xFF, 0xF0, //  ##################    
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4743 '}' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x30, 0x00, 0x30, //  ##              ##    
+	0x30, 0x00, 0x30, //  ##              ##    
+	0x3F, 0xEF, 0xF0, //  ######### ########    
+	0x1F, 0xFF, 0xE0, //   ################     
+	0x00, 0x38, 0x00, //          ###           
+	0x00, 0x10, 0x00, //           #            
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+
+	// @4794 '~' (17 columns)
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x30, 0x00, //          ##            
+	0x00, 0x70, 0x00, //         ###            
+	0x00, 0xE0, 0x00, //        ###             
+	0x00, 0xC0, 0x00, //        ##              
+	0x00, 0xE0, 0x00, //        ###             
+	0x00, 0x70, 0x00, //         ###            
+	0x00, 0x38, 0x00, //          ###           
+	0x00, 0x18, 0x00, //           ##           
+	0x00, 0x38, 0x00, //          ###           
+	0x00, 0x70, 0x00, //         ###            
+	0x00, 0x60, 0x00, //         ##             
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+	0x00, 0x00, 0x00, //                        
+};
@@ -58,6 +58,9 @@ typedef struct _tFont
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  const uint8_t *table_r270; // glyphs one column per line, see extras/font_r270.py (NULL if none)
+  const uint8_t *packed;     // glyphs as unpadded lines instead of table, see extras/font_pack.py (NULL if none)
+  const uint8_t *packed_map; // packed glyph of each character from ' ' (NULL if all are packed)
   
 } sFONT;
 
@@ -68,6 +71,12 @@ typedef struct                                          // 汉字字模数据结
   const char matrix[MAX_HEIGHT_FONT*MAX_WIDTH_FONT/8];  // 点阵码数据
 }CH_CN;
 
+typedef struct
+{
+  uint16_t code;                                        // Unicode code point of the glyph
+  uint16_t glyph;                                       // its position in the CH_CN table
+}CH_CN_INDEX;
+
 typedef struct
 {    
   const CH_CN *table;
@@ -75,6 +84,8 @@ typedef struct
   uint16_t ASCII_Width;
   uint16_t Width;
   uint16_t Height;
+  const CH_CN_INDEX *index; // table positions sorted by code, see extras/font_cn_index.py (NULL if none)
+  uint16_t index_size;       // entries in index, it is only searched when this equals size
   
 }cFONT;
 
@@ -84,6 +95,15 @@ extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
 
+extern const uint8_t Font24_Table_R270[];
+extern const uint8_t Font20_Table_R270[];
+extern const uint8_t Font16_Table_R270[];
+extern const uint8_t Font12_Table_R270[];
+extern const uint8_t Font8_Table_R270[];
+
+extern const CH_CN_INDEX Font12CN_Index[];
+extern const CH_CN_INDEX Font24CN_Index[];
+
 extern cFONT Font12CN;
 extern cFONT Font24CN;
 // extern const unsigned char Font16_Table[];
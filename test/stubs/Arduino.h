@@ -0,0 +1,43 @@
+// Host stand-in for the Arduino core, declarations only, see test/support/native_host.h
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#define HIGH 1
+#define LOW  0
+#define INPUT        0
+#define OUTPUT       1
+#define INPUT_PULLUP 2
+#define RISING  1
+#define FALLING 2
+#define CHANGE  3
+#define IRAM_ATTR
+#define digitalPinToInterrupt(p) (p)
+#define SERIAL_8N1 0
+
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+void pinMode(uint8_t pin, uint8_t mode);
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t pin);
+
+// Serial output is dropped, tests report through Unity and printf
+struct HardwareSerial {
+    void begin(unsigned long) {}
+    void begin(unsigned long, int, int, int) {}
+    template<class T> size_t print(T) { return 0; }
+    template<class T> size_t println(T) { return 0; }
+    size_t printf(const char *, ...) { return 0; }
+    size_t write(const uint8_t *, size_t) { return 0; }
+    void flush() {}
+    int available() { return 0; }
+    int read() { return -1; }
+};
+extern HardwareSerial Serial;
+extern HardwareSerial Serial2;
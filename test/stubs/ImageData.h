@@ -0,0 +1,2 @@
+// Host stand-in for the sketch's bitmap header, Display.cpp includes it but draws no bitmaps
+#pragma once
@@ -0,0 +1,13 @@
+// Host stand-in for the Arduino I2C library
+#pragma once
+#include "Arduino.h"
+
+struct TwoWire {
+    void begin(int, int) {}
+    void beginTransmission(uint8_t) {}
+    uint8_t endTransmission(bool = true) { return 0; }
+    uint8_t requestFrom(uint8_t, uint8_t) { return 0; }
+    int available() { return 0; }
+    int read() { return -1; }
+};
+extern TwoWire Wire;
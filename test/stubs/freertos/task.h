@@ -0,0 +1,23 @@
+// Host stand-in for FreeRTOS tasks, the tests run single threaded
+#pragma once
+#include "FreeRTOS.h"
+
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define taskENTER_CRITICAL(m)     (void)(m)
+#define taskEXIT_CRITICAL(m)      (void)(m)
+#define taskENTER_CRITICAL_ISR(m) (void)(m)
+#define taskEXIT_CRITICAL_ISR(m)  (void)(m)
+
+void vTaskDelay(TickType_t ticks);
+void taskYIELD(void);
+TickType_t xTaskGetTickCount(void);
+TickType_t xTaskGetTickCountFromISR(void);
+BaseType_t xTaskCreatePinnedToCore(void (*fn)(void *), const char *name, uint32_t stack, void *arg,
+                                   UBaseType_t prio, TaskHandle_t *handle, BaseType_t core);
+void vTaskDelete(TaskHandle_t task);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *woken);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+BaseType_t xPortGetCoreID(void);
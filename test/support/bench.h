@@ -0,0 +1,27 @@
+/*****************************************************************************
+* | File      	:   bench.h
+* | Function    :   Host timing for the native benchmarks
+* | Info        :   Host numbers compare code paths with each other, they are not
+*                   ESP32 timings
+******************************************************************************/
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "native_host.h"
+
+#define BENCH_TRIALS 15
+
+// Microseconds per call of fn, best of BENCH_TRIALS runs of reps calls, the minimum filters scheduler noise
+template<class F> double bench_us(int reps, F fn)
+{
+    double best = 0;
+    for (int t = 0; t < BENCH_TRIALS; t++) {
+        unsigned long t0 = micros();
+        for (int r = 0; r < reps; r++) fn(r);
+        double us = (double)(micros() - t0) / reps;
+        if (t == 0 || us < best) best = us;
+    }
+    return best;
+}
+
+#endif
@@ -0,0 +1,78 @@
+/*****************************************************************************
+* | File      	:   native_host.h
+* | Function    :   Host definitions for the Arduino, Wire and FreeRTOS stubs in test/stubs
+* | Info        :   Include once per test suite, every suite is a single translation unit
+*                   that includes the src .cpp files it exercises
+******************************************************************************/
+#ifndef NATIVE_HOST_H
+#define NATIVE_HOST_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <chrono>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "freertos/queue.h"
+
+// Output pin levels as last written, input pins (BUSY) read from native_pin_in
+uint8_t native_pins[64];
+uint8_t native_pin_in[64];
+unsigned long native_pin_writes = 0;
+// FreeRTOS tick count, only moved by the tests so timing dependent code is deterministic
+TickType_t native_ticks = 0;
+
+HardwareSerial Serial;
+HardwareSerial Serial2;
+TwoWire Wire;
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+    native_pins[pin] = val;
+    ++native_pin_writes;
+}
+int digitalRead(uint8_t pin) { return native_pin_in[pin]; }
+void pinMode(uint8_t, uint8_t) {}
+void delay(unsigned long) {}
+void attachInterrupt(uint8_t, void (*)(void), int) {}
+void detachInterrupt(uint8_t) {}
+
+// Wall clock, used by the code under test for its own throughput logs and by the benchmarks
+unsigned long micros(void)
+{
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+unsigned long millis(void) { return micros() / 1000; }
+
+void vTaskDelay(TickType_t ticks) { native_ticks += ticks; }
+void taskYIELD(void) {}
+TickType_t xTaskGetTickCount(void) { return native_ticks; }
+TickType_t xTaskGetTickCountFromISR(void) { return native_ticks; }
+// No second core here, callers fall back to doing the work themselves
+BaseType_t xTaskCreatePinnedToCore(void (*)(void *), const char *, uint32_t, void *, UBaseType_t, TaskHandle_t *, BaseType_t) { return pdFALSE; }
+void vTaskDelete(TaskHandle_t) {}
+TaskHandle_t xTaskGetCurrentTaskHandle(void) { return (TaskHandle_t)1; }
+void vTaskNotifyGiveFromISR(TaskHandle_t, BaseType_t *) {}
+BaseType_t xTaskNotifyGive(TaskHandle_t) { return pdPASS; }
+// Nothing notifies on the host, a take with a timeout waits all of it out
+uint32_t ulTaskNotifyTake(BaseType_t, TickType_t ticks)
+{
+    if (ticks != portMAX_DELAY) native_ticks += ticks;
+    return 0;
+}
+BaseType_t xPortGetCoreID(void) { return 0; }
+
+// Single threaded, every take succeeds
+SemaphoreHandle_t xSemaphoreCreateMutex(void) { return (SemaphoreHandle_t)1; }
+SemaphoreHandle_t xSemaphoreCreateBinary(void) { return (SemaphoreHandle_t)1; }
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t, UBaseType_t) { return (SemaphoreHandle_t)1; }
+BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+BaseType_t xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
+void vSemaphoreDelete(SemaphoreHandle_t) {}
+
+QueueHandle_t xQueueCreate(UBaseType_t, UBaseType_t) { return (QueueHandle_t)1; }
+BaseType_t xQueueSend(QueueHandle_t, const void *, TickType_t) { return pdTRUE; }
+BaseType_t xQueueReceive(QueueHandle_t, void *, TickType_t) { return pdFALSE; }
+
+#endif
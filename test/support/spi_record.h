@@ -0,0 +1,94 @@
+/*****************************************************************************
+* | File      	:   spi_record.h
+* | Function    :   Recording EPD link, stands in for DEV_Config.cpp
+* | Info        :   Every byte written is logged with the DC level it went out under,
+*                   so a sequence can be compared byte for byte with a golden one
+******************************************************************************/
+#ifndef SPI_RECORD_H
+#define SPI_RECORD_H
+
+#include "native_host.h"
+#include "DEV_Config.h"
+
+#include <vector>
+
+typedef struct {
+    UBYTE dc;   // 0 command, 1 data
+    UBYTE byte;
+} SpiByte;
+
+std::vector<SpiByte> spi_stream;
+bool spi_record_enabled = true;    // false only counts, keeps the stub out of benchmark timings
+unsigned long spi_byte_calls = 0;  // DEV_SPI_WriteByte
+unsigned long spi_bulk_calls = 0;  // DEV_SPI_WriteBulk
+std::vector<UBYTE> spi_read_bytes; // returned by DEV_SPI_ReadByte in order, 0 once empty
+static size_t spi_read_pos = 0;
+static UDOUBLE spi_stat_bytes = 0;
+
+// Forget everything recorded, counters included
+void spi_record_reset(void)
+{
+    spi_stream.clear();
+    spi_byte_calls = 0;
+    spi_bulk_calls = 0;
+    spi_read_bytes.clear();
+    spi_read_pos = 0;
+    native_pin_writes = 0;
+}
+
+static void spi_record(UBYTE byte)
+{
+    if (!spi_record_enabled) return;
+    SpiByte b = {native_pins[EPD_DC_PIN], byte};
+    spi_stream.push_back(b);
+}
+
+UBYTE DEV_Module_Init(void) { return 0; }
+void GPIO_Mode(UWORD, UWORD) {}
+void DEV_Delay_ms(unsigned int ms) { native_ticks += ms; }
+
+void DEV_SPI_WriteByte(UBYTE data)
+{
+    ++spi_byte_calls;
+    spi_record(data);
+}
+
+UBYTE DEV_SPI_ReadByte()
+{
+    return spi_read_pos < spi_read_bytes.size() ? spi_read_bytes[spi_read_pos++] : 0;
+}
+
+void DEV_SPI_WriteBulk(const UBYTE *pData, UDOUBLE len)
+{
+    ++spi_bulk_calls;
+    for (UDOUBLE i = 0; i < len; i++) spi_record(pData[i]);
+    spi_stat_bytes += len;
+}
+
+void DEV_SPI_Write_nByte(UBYTE *pData, UDOUBLE len)
+{
+    DEV_SPI_WriteBulk(pData, len);
+}
+
+void DEV_SPI_GetStats(UDOUBLE *bytes, UDOUBLE *us)
+{
+    if (bytes) *bytes = spi_stat_bytes;
+    if (us) *us = 0;
+}
+
+void DEV_SPI_ResetStats(void)
+{
+    spi_stat_bytes = 0;
+}
+
+// Recorded stream equals the expected (dc, byte) pairs
+bool spi_stream_equals(const std::vector<SpiByte> &expect)
+{
+    if (expect.size() != spi_stream.size()) return false;
+    for (size_t i = 0; i < expect.size(); i++) {
+        if (expect[i].dc != spi_stream[i].dc || expect[i].byte != spi_stream[i].byte) return false;
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,172 @@
+/*****************************************************************************
+* | File      	:   test_main.cpp
+* | Function    :   USE_BANDED_PAINT display lists replayed band by band against direct painting
+* | Info        :   Random draw calls are recorded once, replayed into 1 to 8 bands of
+*                   the memory rows and must leave the same image as drawing them
+*                   straight away, for every rotation, mirror and scale. The Display.cpp
+*                   pages go through its own paintBands the same way. Build with
+*                   USE_NATIVE_4GRAY 0 and 1 for both 4gray layouts:
+*                   pio test -e native -e native_4gray_planes -f test_banded_paint
+******************************************************************************/
+#define USE_BANDED_PAINT 1
+#include <unity.h>
+#include "spi_record.h"
+#include "Display.cpp"
+#include "EPD_3in7.cpp"
+#include "GUI_Paint.cpp"
+#include "fonts/font8.cpp"
+#include "fonts/font12.cpp"
+#include "fonts/font16.cpp"
+#include "fonts/font20.cpp"
+#include "fonts/font24.cpp"
+#include "fonts/font_r270.cpp"
+
+#define CANVAS_WIDTH  280 // the panel's
+#define CANVAS_HEIGHT 480
+#define CANVAS_BYTES (CANVAS_WIDTH / 8 * CANVAS_HEIGHT * 2) // a 4 gray canvas, both layouts
+#define LIST_DRAWS 40 // draw calls per recorded list, well inside PAINT_LIST_OPS
+
+static UBYTE direct_image[CANVAS_BYTES], banded_image[CANVAS_BYTES];
+static PAINT_LIST list;
+static sFONT *fonts[] = {&Font8, &Font12, &Font16, &Font20, &Font24};
+static const int band_counts[] = {1, 2, 3, 5, 8};
+
+static UWORD randomColor(UBYTE scale)
+{
+    static const UWORD grays[] = {WHITE, GRAY1, GRAY2, BLACK};
+    return scale == 2 ? (rand() & 1 ? WHITE : BLACK) : grays[rand() % 4];
+}
+
+// LIST_DRAWS random calls, the same ones for the same seed whether they are drawn or recorded
+static void drawRandom(PAINT *ctx, unsigned seed)
+{
+    char str[9];
+    srand(seed);
+    UWORD w = ctx->Width, h = ctx->Height;
+    UBYTE scale = (UBYTE)ctx->Scale;
+    if (seed & 1) PaintCtx_Clear(ctx, randomColor(scale));
+    for (int d = 0; d < LIST_DRAWS; d++) {
+        UWORD x0 = rand() % w, y0 = rand() % h;
+        UWORD x1 = x0 + rand() % (w - x0), y1 = y0 + rand() % (h - y0);
+        UWORD color = randomColor(scale);
+        DOT_PIXEL dot = (DOT_PIXEL)(DOT_PIXEL_1X1 + rand() % 3);
+        sFONT *font = fonts[rand() % 5];
+        switch (rand() % 8) {
+        case 0:
+            PaintCtx_ClearWindows(ctx, x0, y0, x1, y1, color);
+            break;
+        case 1:
+            PaintCtx_DrawPoint(ctx, x0, y0, color, dot, (DOT_STYLE)(DOT_FILL_AROUND + rand() % 2));
+            break;
+        case 2:
+            PaintCtx_DrawLine(ctx, x0, y0, x1, y1, color, dot, (LINE_STYLE)(rand() % 2));
+            break;
+        case 3:
+            PaintCtx_DrawRectangle(ctx, x0, y0, x1, y1, color, dot, (DRAW_FILL)(rand() % 2));
+            break;
+        case 4:
+            PaintCtx_DrawCircle(ctx, x0, y0, 1 + rand() % 60, color, dot, (DRAW_FILL)(rand() % 2));
+            break;
+        case 5:
+            PaintCtx_DrawChar(ctx, x0, y0, (char)(' ' + rand() % 95), font, color,
+                              rand() & 1 ? FONT_BACKGROUND : randomColor(scale));
+            break;
+        case 6: {
+            int len = 1 + rand() % 8;
+            for (int i = 0; i < len; i++) str[i] = (char)(' ' + rand() % 95);
+            str[len] = '\0';
+            PaintCtx_DrawString_EN(ctx, x0, y0, str, font, color, rand() & 1 ? FONT_BACKGROUND : randomColor(scale));
+            break;
+        }
+        default:
+            PaintCtx_DrawNum(ctx, x0, y0, rand() - RAND_MAX / 2, font, color, randomColor(scale));
+            break;
+        }
+    }
+}
+
+// Replays list into bands equal parts of the memory rows, each through its own copy of ctx like paintBands
+static void replayBands(const PAINT *ctx, int bands)
+{
+    for (int b = 0; b < bands; b++) {
+        PAINT band = *ctx;
+        band.List = NULL;
+        PaintCtx_SetBand(&band, ctx->HeightMemory * b / bands, ctx->HeightMemory * (b + 1) / bands);
+        PaintCtx_Replay(&band, &list);
+    }
+}
+
+void setUp(void)
+{
+    spi_record_reset();
+    spi_record_enabled = false;
+}
+
+void tearDown(void) {}
+
+// Random lists in every rotation, mirror and scale, replayed into 1 to 8 bands
+static void test_random_lists(void)
+{
+    static const UWORD rotates[] = {ROTATE_0, ROTATE_90, ROTATE_180, ROTATE_270};
+    unsigned seed = 21;
+    for (int r = 0; r < 4; r++) {
+        for (UBYTE mirror = MIRROR_NONE; mirror <= MIRROR_ORIGIN; mirror++) {
+            for (UBYTE scale = 2; scale <= 4; scale += 2, seed++) {
+                PAINT ctx;
+                PaintCtx_NewImage(&ctx, direct_image, CANVAS_WIDTH, CANVAS_HEIGHT, rotates[r], WHITE);
+                PaintCtx_SetScale(&ctx, scale);
+                PaintCtx_SetMirroring(&ctx, mirror);
+                for (UDOUBLE i = 0; i < CANVAS_BYTES; i++) direct_image[i] = (UBYTE)(i * 7 + seed);
+                drawRandom(&ctx, seed);
+
+                PaintCtx_SelectImage(&ctx, banded_image);
+                PaintCtx_Record(&ctx, &list);
+                drawRandom(&ctx, seed);
+                PaintCtx_Record(&ctx, NULL);
+                TEST_ASSERT_FALSE(list.Incomplete);
+                for (size_t n = 0; n < sizeof(band_counts) / sizeof(band_counts[0]); n++) {
+                    for (UDOUBLE i = 0; i < CANVAS_BYTES; i++) banded_image[i] = (UBYTE)(i * 7 + seed);
+                    replayBands(&ctx, band_counts[n]);
+                    TEST_ASSERT_EQUAL_MEMORY(direct_image, banded_image, CANVAS_BYTES);
+                }
+            }
+        }
+    }
+}
+
+// Display.cpp's pages recorded as paintCurrentPageBanded does and replayed through paintBands
+static void test_pages_through_paint_bands(void)
+{
+    static const PageType pages[] = {PAGE_BOOT, PAGE_HOME, PAGE_IDLE, PAGE_COMMAND};
+    modem_powered = modem_ready = modem_net = true;
+    sms_unread_count = 2;
+    gnss_data.gnss_on = true;
+    cmd_buffer.history_count = CMD_HISTORY_LINES;
+    for (int i = 0; i < CMD_HISTORY_LINES; i++)
+        snprintf(cmd_buffer.history[i], CMD_BUFFER_SIZE, "$ AT+COPS? reply %02d: +COPS: 0,0", i);
+    for (size_t p = 0; p < sizeof(pages) / sizeof(pages[0]); p++) {
+        setPage(pages[p]);
+        paintCurrentPage();
+        UDOUBLE bytes = Paint.Image == image_buf4 ? image_size4 : image_size1;
+        memcpy(direct_image, Paint.Image, bytes);
+        memset(Paint.Image, 0x5A, bytes);
+
+        Paint_Record(&page_list);
+        paintCurrentPage();
+        Paint_Record(NULL);
+        TEST_ASSERT_FALSE(page_list.Incomplete);
+        band_next = 0;
+        paintBands();
+        TEST_ASSERT_EQUAL_MEMORY(direct_image, Paint.Image, bytes);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Display_Init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_random_lists);
+    RUN_TEST(test_pages_through_paint_bands);
+    return UNITY_END();
+}
@@ -0,0 +1,87 @@
+/*****************************************************************************
+* | File      	:   test_main.cpp
+* | Function    :   BUSY timeouts reported to the callers of the refresh routines
+* | Info        :   A command sent while a refresh runs waits it out first. If that
+*                   wait times out, the next *_Start, WaitIdle or init must return 1,
+*                   once, instead of the timeout being dropped
+******************************************************************************/
+#include <unity.h>
+#include "spi_record.h"
+#include "EPD_3in7.cpp"
+
+static UBYTE frame[EPD_3IN7_PLANE_BYTES];
+
+// Starts a 1gray refresh that never ends by itself, BUSY stays high
+static void startStuckRefresh(void)
+{
+    native_pin_in[EPD_BUSY_PIN] = 0;
+    TEST_ASSERT_EQUAL_UINT8(0, EPD_3IN7_1Gray_Display_Start(frame));
+    native_pin_in[EPD_BUSY_PIN] = 1;
+}
+
+// A LUT the controller does not hold yet, so commands go out
+static void sendCommandsWhileBusy(void)
+{
+    UBYTE lut = epd_state.lut == EPD_3IN7_LUT_1GRAY_GC ? EPD_3IN7_LUT_1GRAY_DU : EPD_3IN7_LUT_1GRAY_GC;
+    EPD_3IN7_Load_LUT(lut);
+    TEST_ASSERT_FALSE(refresh_pending);
+    native_pin_in[EPD_BUSY_PIN] = 0;
+}
+
+void setUp(void)
+{
+    spi_record_reset();
+    native_pin_in[EPD_BUSY_PIN] = 0;
+    EPD_3IN7_1Gray_Init();
+    EPD_3IN7_WaitIdle();
+}
+
+void tearDown(void)
+{
+    native_pin_in[EPD_BUSY_PIN] = 0;
+}
+
+static void test_next_start_reports_timeout(void)
+{
+    startStuckRefresh();
+    sendCommandsWhileBusy();
+    TEST_ASSERT_EQUAL_UINT8(1, EPD_3IN7_1Gray_Display_Start(frame));
+    // Reported once, the refresh just started is fine
+    TEST_ASSERT_EQUAL_UINT8(0, EPD_3IN7_WaitIdle());
+}
+
+static void test_wait_idle_reports_timeout(void)
+{
+    startStuckRefresh();
+    sendCommandsWhileBusy();
+    TEST_ASSERT_EQUAL_UINT8(1, EPD_3IN7_WaitIdle());
+    TEST_ASSERT_EQUAL_UINT8(0, EPD_3IN7_WaitIdle());
+}
+
+static void test_init_reports_timeout(void)
+{
+    startStuckRefresh();
+    TEST_ASSERT_EQUAL_UINT8(1, EPD_3IN7_1Gray_Init());
+    native_pin_in[EPD_BUSY_PIN] = 0;
+    TEST_ASSERT_EQUAL_UINT8(0, EPD_3IN7_WaitIdle());
+}
+
+static void test_no_timeout_no_report(void)
+{
+    TEST_ASSERT_EQUAL_UINT8(0, EPD_3IN7_1Gray_Display_Start(frame));
+    EPD_3IN7_Load_LUT(EPD_3IN7_LUT_1GRAY_A2);
+    TEST_ASSERT_EQUAL_UINT8(0, EPD_3IN7_1Gray_Display_Start(frame));
+    TEST_ASSERT_EQUAL_UINT8(0, EPD_3IN7_WaitIdle());
+}
+
+int main(int argc, char **argv)
+{
+    memset(frame, 0xFF, sizeof(frame));
+
+    UNITY_BEGIN();
+    RUN_TEST(test_next_start_reports_timeout);
+    RUN_TEST(test_wait_idle_reports_timeout);
+    RUN_TEST(test_init_reports_timeout);
+    RUN_TEST(test_no_timeout_no_report);
+    return UNITY_END();
+}
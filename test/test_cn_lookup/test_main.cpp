@@ -0,0 +1,97 @@
+/*****************************************************************************
+* | File      	:   test_main.cpp
+* | Function    :   CN glyph lookup through the sorted code point index
+* | Info        :   Paint_FindGlyphCN must find what a front to back table scan
+*                   finds, and must scan instead of searching an index whose
+*                   entry count no longer matches its table
+******************************************************************************/
+#include <unity.h>
+#include "native_host.h"
+#include "GUI_Paint.cpp"
+
+// UTF-8 keys as the font*CN.c tables store them, 'A', 'a', U+4F60, U+597D, U+4F60 again, U+6811
+static const CH_CN table[] = {
+    {{0xE4, 0xBD, 0xA0}, {1}},
+    {{0xE5, 0xA5, 0xBD}, {2}},
+    {{'a'}, {3}},
+    {{'A'}, {4}},
+    {{0xE4, 0xBD, 0xA0}, {5}},
+    {{0xE6, 0xA0, 0x91}, {6}},
+};
+#define TABLE_SIZE (sizeof(table) / sizeof(table[0]))
+static const UDOUBLE codes[] = {0x4F60, 0x597D, 'a', 'A', 0x4F60, 0x6811};
+
+// What extras/font_cn_index.py emits for the table, equal codes in table order
+static const CH_CN_INDEX index_full[TABLE_SIZE] = {
+    {0x0041, 3}, {0x0061, 2}, {0x4F60, 0}, {0x4F60, 4}, {0x597D, 1}, {0x6811, 5},
+};
+
+// Front to back, as Paint_DrawString_CN looked glyphs up before the index
+static const CH_CN *scan(UDOUBLE Code)
+{
+    for (size_t i = 0; i < TABLE_SIZE; i++) {
+        if (Paint_GlyphCode(&table[i]) == Code) return &table[i];
+    }
+    return NULL;
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+static void test_index_matches_scan(void)
+{
+    cFONT font = {table, TABLE_SIZE, 8, 16, 16, index_full, TABLE_SIZE};
+    for (size_t i = 0; i < TABLE_SIZE; i++) {
+        TEST_ASSERT_EQUAL_PTR(scan(codes[i]), Paint_FindGlyphCN(&font, codes[i]));
+    }
+    TEST_ASSERT_EQUAL_PTR(&table[0], Paint_FindGlyphCN(&font, 0x4F60));
+    TEST_ASSERT_NULL(Paint_FindGlyphCN(&font, 'b'));
+    TEST_ASSERT_NULL(Paint_FindGlyphCN(&font, 0xFFFF));
+}
+
+// A glyph was added to the table and the index was not regenerated: its count is one short
+// The index must not be read past its end, the table is scanned and the new glyph found
+static void test_short_index_scans(void)
+{
+    CH_CN_INDEX *stale = (CH_CN_INDEX *)malloc((TABLE_SIZE - 1) * sizeof(CH_CN_INDEX));
+    static const CH_CN_INDEX old_index[TABLE_SIZE - 1] = {
+        {0x0041, 3}, {0x0061, 2}, {0x4F60, 0}, {0x4F60, 4}, {0x597D, 1},
+    };
+    memcpy(stale, old_index, sizeof(old_index));
+    cFONT font = {table, TABLE_SIZE, 8, 16, 16, stale, TABLE_SIZE - 1};
+    for (size_t i = 0; i < TABLE_SIZE; i++) {
+        TEST_ASSERT_EQUAL_PTR(scan(codes[i]), Paint_FindGlyphCN(&font, codes[i]));
+    }
+    TEST_ASSERT_NULL(Paint_FindGlyphCN(&font, 'b'));
+    free(stale);
+}
+
+// A glyph was removed: the index is one entry long, positions past the table are never used
+static void test_long_index_scans(void)
+{
+    static const CH_CN_INDEX long_index[TABLE_SIZE + 1] = {
+        {0x0041, 3}, {0x0061, 2}, {0x4F60, 0}, {0x4F60, 4}, {0x597D, 1}, {0x6811, 5}, {0x7EA2, 6},
+    };
+    cFONT font = {table, TABLE_SIZE, 8, 16, 16, long_index, TABLE_SIZE + 1};
+    TEST_ASSERT_NULL(Paint_FindGlyphCN(&font, 0x7EA2));
+    TEST_ASSERT_EQUAL_PTR(&table[5], Paint_FindGlyphCN(&font, 0x6811));
+}
+
+static void test_no_index_scans(void)
+{
+    cFONT font = {table, TABLE_SIZE, 8, 16, 16, NULL, 0};
+    for (size_t i = 0; i < TABLE_SIZE; i++) {
+        TEST_ASSERT_EQUAL_PTR(scan(codes[i]), Paint_FindGlyphCN(&font, codes[i]));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_index_matches_scan);
+    RUN_TEST(test_short_index_scans);
+    RUN_TEST(test_long_index_scans);
+    RUN_TEST(test_no_index_scans);
+    return UNITY_END();
+}
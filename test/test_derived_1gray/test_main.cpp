@@ -0,0 +1,124 @@
+/*****************************************************************************
+* | File      	:   test_main.cpp
+* | Function    :   USE_DERIVED_1GRAY transfers against a 1gray copy of the frame
+* | Info        :   EPD_3IN7_1Gray_Display(_Part)_From4Gray_Start threshold the 4gray
+*                   canvas while streaming it. For random frames and windows the link
+*                   must carry the same bytes as EPD_3IN7_4Gray_ToMono followed by
+*                   EPD_3IN7_1Gray_Display(_Part)_Start, from the same driver state
+******************************************************************************/
+#include <unity.h>
+#include "spi_record.h"
+#include "EPD_3in7.cpp"
+
+#define FRAMES 50
+
+static UBYTE image[EPD_3IN7_PLANE_BYTES * 2];
+static UBYTE mono[EPD_3IN7_PLANE_BYTES];
+static std::vector<SpiByte> derived_stream;
+
+// A 4gray frame: random grays, or BLACK/WHITE only as a partial page paints it
+static void randomFrame(bool gray)
+{
+    for (UDOUBLE i = 0; i < sizeof(image); i++) {
+        UBYTE b = (UBYTE)rand();
+        if (!gray) {
+#if USE_NATIVE_4GRAY
+            // Both planes carry the same bit for BLACK and WHITE
+            if (i >= EPD_3IN7_PLANE_BYTES) b = image[i - EPD_3IN7_PLANE_BYTES];
+#else
+            // Each 2 bit pixel 00 or 11
+            b = (UBYTE)(((b & 0x55) << 1) | (b & 0x55));
+#endif
+        }
+        image[i] = b;
+    }
+}
+
+typedef UBYTE (*SendFn)(int x0, int y0, int x1, int y1);
+
+// Runs derived then direct from the same controller shadow and pending refresh, both streams must match
+static void compareSends(SendFn derived, SendFn direct, int x0, int y0, int x1, int y1)
+{
+    EPD_3IN7_STATE state = epd_state;
+    bool pending = refresh_pending;
+
+    spi_record_reset();
+    UBYTE derived_status = derived(x0, y0, x1, y1);
+    derived_stream = spi_stream;
+    EPD_3IN7_STATE derived_state = epd_state;
+
+    epd_state = state;
+    refresh_pending = pending;
+    spi_record_reset();
+    UBYTE direct_status = direct(x0, y0, x1, y1);
+
+    TEST_ASSERT_EQUAL_UINT8(direct_status, derived_status);
+    TEST_ASSERT_TRUE(spi_stream_equals(derived_stream));
+    TEST_ASSERT_EQUAL_MEMORY(&epd_state, &derived_state, sizeof(epd_state));
+}
+
+static UBYTE derivedFrame(int, int, int, int)
+{
+    return EPD_3IN7_1Gray_Display_From4Gray_Start(image);
+}
+
+static UBYTE directFrame(int, int, int, int)
+{
+    EPD_3IN7_4Gray_ToMono(image, mono);
+    return EPD_3IN7_1Gray_Display_Start(mono);
+}
+
+static UBYTE derivedWindow(int x0, int y0, int x1, int y1)
+{
+    return EPD_3IN7_1Gray_Display_Part_From4Gray_Start(image, x0, y0, x1, y1);
+}
+
+static UBYTE directWindow(int x0, int y0, int x1, int y1)
+{
+    EPD_3IN7_4Gray_ToMono(image, mono);
+    return EPD_3IN7_1Gray_Display_Part_Start(mono, x0, y0, x1, y1);
+}
+
+void setUp(void)
+{
+    srand(23);
+    spi_record_reset();
+}
+
+void tearDown(void) {}
+
+// Whole frames, alternating gray and BLACK/WHITE content and the 1gray waveforms
+static void test_full_frames(void)
+{
+    static const UBYTE luts[] = {EPD_3IN7_LUT_1GRAY_GC, EPD_3IN7_LUT_1GRAY_DU, EPD_3IN7_LUT_1GRAY_A2};
+    for (int f = 0; f < FRAMES; f++) {
+        randomFrame(f & 1);
+        EPD_3IN7_1Gray_SetWaveform(luts[f % 3]);
+        compareSends(derivedFrame, directFrame, 0, 0, 0, 0);
+    }
+}
+
+// Windows of any size and alignment, whole row ones take the single run threshold
+static void test_windows(void)
+{
+    for (int f = 0; f < FRAMES; f++) {
+        randomFrame(f & 1);
+        int x0 = rand() % EPD_3IN7_WIDTH, y0 = rand() % EPD_3IN7_HEIGHT;
+        int x1 = x0 + rand() % (EPD_3IN7_WIDTH - x0), y1 = y0 + rand() % (EPD_3IN7_HEIGHT - y0);
+        if (f % 5 == 0) {
+            x0 = 0;
+            x1 = EPD_3IN7_WIDTH - 1;
+        }
+        compareSends(derivedWindow, directWindow, x0, y0, x1, y1);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    EPD_3IN7_1Gray_Init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_full_frames);
+    RUN_TEST(test_windows);
+    return UNITY_END();
+}
@@ -0,0 +1,160 @@
+/*****************************************************************************
+* | File      	:   test_main.cpp
+* | Function    :   Glyph line blits against the pixel path they replace
+* | Info        :   Every character is drawn from the pre-rotated columns of
+*                   font_r270.cpp and from the font's own rows pixel by pixel,
+*                   the framebuffers must match, a stale font_r270.cpp fails here.
+*                   The ROTATE_0 row blit of the landscape canvas is checked too
+******************************************************************************/
+#include <unity.h>
+#include "native_host.h"
+#include "GUI_Paint.cpp"
+#include "fonts/font8.cpp"
+#include "fonts/font12.cpp"
+#include "fonts/font16.cpp"
+#include "fonts/font20.cpp"
+#include "fonts/font24.cpp"
+#include "fonts/font_r270.cpp"
+
+#define CANVAS_WIDTH  280 // the panel's, drawn through a rotation like Display.cpp does
+#define CANVAS_HEIGHT 480
+#define CANVAS_BYTES (CANVAS_WIDTH / 8 * CANVAS_HEIGHT * 2) // a 4 gray canvas, both layouts
+#define FUZZ_DRAWS 4000
+
+static sFONT *fonts[] = {&Font8, &Font12, &Font16, &Font20, &Font24};
+#define FONT_COUNT (sizeof(fonts) / sizeof(fonts[0]))
+static sFONT pixel_fonts[FONT_COUNT]; // same glyphs without table_r270, always the pixel path
+static UBYTE blit_image[CANVAS_BYTES], pixel_image[CANVAS_BYTES];
+
+typedef struct {
+    UWORD rotate;
+    UBYTE mirror;
+    UBYTE scale;
+} Canvas;
+
+// Both canvases set up alike and filled with the same noise, so trimmed bits show up too
+static void setupCanvases(const Canvas *c)
+{
+    for (UDOUBLE i = 0; i < CANVAS_BYTES; i++) blit_image[i] = pixel_image[i] = (UBYTE)rand();
+    Paint_NewImage(pixel_image, CANVAS_WIDTH, CANVAS_HEIGHT, c->rotate, WHITE);
+    Paint_SetScale(c->scale);
+    Paint_SetMirroring(c->mirror);
+}
+
+static void drawBoth(UWORD x, UWORD y, const char *str, size_t f, UWORD fg, UWORD bg)
+{
+    Paint_SelectImage(blit_image);
+    Paint_DrawString_EN(x, y, str, fonts[f], fg, bg);
+    Paint_SelectImage(pixel_image);
+    Paint_DrawString_EN(x, y, str, &pixel_fonts[f], fg, bg);
+}
+
+static UWORD randomColor(UBYTE scale)
+{
+    static const UWORD grays[] = {WHITE, GRAY1, GRAY2, BLACK};
+    return scale == 2 ? (rand() & 1 ? WHITE : BLACK) : grays[rand() % 4];
+}
+
+void setUp(void)
+{
+    srand(18);
+}
+
+void tearDown(void) {}
+
+// Every glyph of every font on the panel's 270 degree canvas, both scales and background modes
+static void test_every_glyph_r270(void)
+{
+    char str[2] = {0, 0};
+    for (UBYTE scale = 2; scale <= 4; scale += 2) {
+        Canvas c = {ROTATE_270, MIRROR_NONE, scale};
+        setupCanvases(&c);
+        for (size_t f = 0; f < FONT_COUNT; f++) {
+            UWORD x = 0, y = 0;
+            for (char ch = ' '; ch <= '~'; ch++) {
+                if (x + fonts[f]->Width > Paint.Width) {
+                    x = 0;
+                    y = (y + fonts[f]->Height) % (Paint.Height - fonts[f]->Height);
+                }
+                str[0] = ch;
+                drawBoth(x, y, str, f, BLACK, ch & 1 ? WHITE : (scale == 2 ? BLACK : GRAY2));
+                x += fonts[f]->Width;
+            }
+            TEST_ASSERT_EQUAL_MEMORY(pixel_image, blit_image, CANVAS_BYTES);
+        }
+    }
+}
+
+// Every glyph on a ROTATE_0 canvas, table rows blitted as they are, against the same canvas turned
+// 180 degrees and mirrored about the origin, which lands on the same bytes through the pixel path
+static void test_every_glyph_r0(void)
+{
+    char str[2] = {0, 0};
+    for (UBYTE scale = 2; scale <= 4; scale += 2) {
+        Canvas c = {ROTATE_0, MIRROR_NONE, scale};
+        setupCanvases(&c);
+        for (size_t f = 0; f < FONT_COUNT; f++) {
+            UWORD x = 0, y = 0;
+            for (char ch = ' '; ch <= '~'; ch++) {
+                if (x + fonts[f]->Width > Paint.Width) {
+                    x = 0;
+                    y = (y + fonts[f]->Height) % (Paint.Height - fonts[f]->Height);
+                }
+                str[0] = ch;
+                UWORD bg = ch & 1 ? WHITE : (scale == 2 ? BLACK : GRAY2);
+                Paint_SelectImage(blit_image);
+                Paint_SetRotate(ROTATE_0);
+                Paint_SetMirroring(MIRROR_NONE);
+                Paint_DrawString_EN(x, y, str, fonts[f], BLACK, bg);
+                Paint_SelectImage(pixel_image);
+                Paint_SetRotate(ROTATE_180);
+                Paint_SetMirroring(MIRROR_ORIGIN);
+                Paint_DrawString_EN(x, y, str, fonts[f], BLACK, bg);
+                x += fonts[f]->Width;
+            }
+            TEST_ASSERT_EQUAL_MEMORY(pixel_image, blit_image, CANVAS_BYTES);
+        }
+    }
+}
+
+// Random strings across rotations, mirrors, scales, colours, positions and clip rectangles
+static void test_fuzz_strings(void)
+{
+    static const UWORD rotates[] = {ROTATE_0, ROTATE_90, ROTATE_180, ROTATE_270};
+    char str[9];
+    for (int d = 0; d < FUZZ_DRAWS; d++) {
+        if (d % 100 == 0) {
+            Canvas c = {rotates[rand() % 4], (UBYTE)(rand() % 4 == 0 ? rand() % 4 : MIRROR_NONE),
+                        (UBYTE)(rand() & 1 ? 4 : 2)};
+            setupCanvases(&c);
+        }
+        Canvas c = {Paint.Rotate, (UBYTE)Paint.Mirror, (UBYTE)Paint.Scale};
+        size_t f = rand() % FONT_COUNT;
+        int len = 1 + rand() % 8;
+        for (int i = 0; i < len; i++) str[i] = (char)(' ' + rand() % 95);
+        str[len] = '\0';
+        if (rand() % 3 == 0) {
+            UWORD x0 = rand() % Paint.Width, y0 = rand() % Paint.Height;
+            Paint_SetClip(x0, y0, x0 + rand() % Paint.Width, y0 + rand() % Paint.Height);
+        } else {
+            Paint_ResetClip();
+        }
+        drawBoth(rand() % Paint.Width, rand() % Paint.Height, str, f,
+                 randomColor(c.scale), rand() & 1 ? FONT_BACKGROUND : randomColor(c.scale));
+        if (d % 100 == 99) TEST_ASSERT_EQUAL_MEMORY(pixel_image, blit_image, CANVAS_BYTES);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    for (size_t f = 0; f < FONT_COUNT; f++) {
+        pixel_fonts[f] = *fonts[f];
+        pixel_fonts[f].table_r270 = NULL;
+    }
+
+    UNITY_BEGIN();
+    RUN_TEST(test_every_glyph_r270);
+    RUN_TEST(test_every_glyph_r0);
+    RUN_TEST(test_fuzz_strings);
+    return UNITY_END();
+}
@@ -0,0 +1,226 @@
+/*****************************************************************************
+* | File      	:   test_main.cpp
+* | Function    :   2bpp to plane conversion kernels against the original scalar loops
+* | Info        :   EPD_3IN7_4Gray_Split must match the per pixel if/else chain the
+*                   driver shipped with, byte for byte, and is timed against it.
+*                   The word kernels are swept over source alignments and lengths
+*                   so their aligned prologues and byte tails are covered too
+******************************************************************************/
+#include <unity.h>
+#include "spi_record.h"
+#include "EPD_3in7.cpp"
+
+static UBYTE image[EPD_3IN7_PLANE_BYTES * 2 + 4]; // room to offset a whole frame
+static UBYTE old24[EPD_3IN7_PLANE_BYTES], old26[EPD_3IN7_PLANE_BYTES];
+static UBYTE new24[EPD_3IN7_PLANE_BYTES], new26[EPD_3IN7_PLANE_BYTES];
+
+#define SWEEP_BYTES 40  // plane bytes, several words plus every tail length
+#define SENTINEL 0x5A
+
+/******************************************************************************
+function :	The pre-series EPD_3IN7_4Gray_Display conversion, RAM 0x24 pass then 0x26 pass
+parameter:
+******************************************************************************/
+static void oldConvert(const UBYTE *Image, UBYTE *P24, UBYTE *P26)
+{
+    UDOUBLE i,j,k;
+    UBYTE temp1,temp2,temp3;
+
+    for(i=0;i<16800;i++){
+        temp3=0;
+        for(j=0; j<2; j++) {
+            temp1 = Image[i*2+j];
+            for(k=0; k<2; k++) {
+                temp2 = temp1&0xC0;
+                if(temp2 == 0xC0)
+                    temp3 |= 0x01;//white
+                else if(temp2 == 0x00)
+                    temp3 |= 0x00;  //black
+                else if(temp2 == 0x80)
+                    temp3 |= 0x00;  //gray1
+                else //0x40
+                    temp3 |= 0x01; //gray2
+                temp3 <<= 1;
+
+                temp1 <<= 2;
+                temp2 = temp1&0xC0 ;
+                if(temp2 == 0xC0)  //white
+                    temp3 |= 0x01;
+                else if(temp2 == 0x00) //black
+                    temp3 |= 0x00;
+                else if(temp2 == 0x80)
+                    temp3 |= 0x00; //gray1
+                else    //0x40
+                    temp3 |= 0x01;	//gray2
+                if(j!=1 || k!=1)
+                    temp3 <<= 1;
+
+                temp1 <<= 2;
+            }
+        }
+        P24[i] = temp3;
+    }
+    for(i=0; i<16800; i++) {
+        temp3=0;
+        for(j=0; j<2; j++) {
+            temp1 = Image[i*2+j];
+            for(k=0; k<2; k++) {
+                temp2 = temp1&0xC0 ;
+                if(temp2 == 0xC0)
+                    temp3 |= 0x01;//white
+                else if(temp2 == 0x00)
+                    temp3 |= 0x00;  //black
+                else if(temp2 == 0x80)
+                    temp3 |= 0x01;  //gray1
+                else //0x40
+                    temp3 |= 0x00; //gray2
+                temp3 <<= 1;
+
+                temp1 <<= 2;
+                temp2 = temp1&0xC0 ;
+                if(temp2 == 0xC0)  //white
+                    temp3 |= 0x01;
+                else if(temp2 == 0x00) //black
+                    temp3 |= 0x00;
+                else if(temp2 == 0x80)
+                    temp3 |= 0x01; //gray1
+                else    //0x40
+                    temp3 |= 0x00;	//gray2
+                if(j!=1 || k!=1)
+                    temp3 <<= 1;
+
+                temp1 <<= 2;
+            }
+        }
+        P26[i] = temp3;
+    }
+}
+
+// Plane bytes i of a 2bpp run one pixel at a time: RAM 0x24 takes bit 0 of each pixel, 0x26 bit 1
+static void scalarSplit(const UBYTE *Src, UBYTE *P24, UBYTE *P26, UDOUBLE Bytes)
+{
+    for (UDOUBLE i = 0; i < Bytes; i++) {
+        UBYTE b24 = 0, b26 = 0;
+        for (int px = 0; px < 8; px++) {
+            UBYTE pixel = (Src[2 * i + px / 4] >> (6 - 2 * (px % 4))) & 3;
+            b24 = (UBYTE)(b24 << 1) | (pixel & 1);
+            b26 = (UBYTE)(b26 << 1) | (pixel >> 1);
+        }
+        P24[i] = b24;
+        P26[i] = b26;
+    }
+}
+
+void setUp(void)
+{
+    srand(3);
+    for (UDOUBLE i = 0; i < sizeof(image); i++) image[i] = (UBYTE)rand();
+}
+
+void tearDown(void) {}
+
+// Every 2bpp byte value in both halves of a plane byte
+static void test_split_matches_old_all_byte_values(void)
+{
+    for (UDOUBLE i = 0; i < sizeof(image); i++) image[i] = (UBYTE)(i % 256 + i / 512);
+    oldConvert(image, old24, old26);
+    EPD_3IN7_4Gray_Split(image, new24, new26, EPD_3IN7_PLANE_BYTES);
+    TEST_ASSERT_EQUAL_MEMORY(old24, new24, sizeof(old24));
+    TEST_ASSERT_EQUAL_MEMORY(old26, new26, sizeof(old26));
+}
+
+static void test_split_matches_old_random_frame(void)
+{
+    oldConvert(image, old24, old26);
+    EPD_3IN7_4Gray_Split(image, new24, new26, EPD_3IN7_PLANE_BYTES);
+    TEST_ASSERT_EQUAL_MEMORY(old24, new24, sizeof(old24));
+    TEST_ASSERT_EQUAL_MEMORY(old26, new26, sizeof(old26));
+}
+
+// Source offsets 0-3 from a word boundary, every length up to SWEEP_BYTES, nothing written past Bytes
+static void test_split_alignment_sweep(void)
+{
+    for (int off = 0; off < 4; off++) {
+        for (UDOUBLE len = 0; len <= SWEEP_BYTES; len++) {
+            scalarSplit(image + off, old24, old26, len);
+            memset(new24, SENTINEL, SWEEP_BYTES + 1);
+            memset(new26, SENTINEL, SWEEP_BYTES + 1);
+            EPD_3IN7_4Gray_Split(image + off, new24, new26, len);
+            TEST_ASSERT_EQUAL_MEMORY(old24, new24, len);
+            TEST_ASSERT_EQUAL_MEMORY(old26, new26, len);
+            TEST_ASSERT_EQUAL_UINT8(SENTINEL, new24[len]);
+            TEST_ASSERT_EQUAL_UINT8(SENTINEL, new26[len]);
+        }
+    }
+}
+
+// The 0x24 half alone, for runs starting at any image alignment and byte of a row
+static void test_to_mono_span_alignment_sweep(void)
+{
+    for (int off = 0; off < 4; off++) {
+        for (UWORD xbyte = 0; xbyte < 4; xbyte++) {
+            for (UDOUBLE len = 0; len <= SWEEP_BYTES; len++) {
+                scalarSplit(image + off + 2 * xbyte + 2 * EPD_3IN7_LINE_BYTES, old24, old26, len);
+                memset(new24, SENTINEL, SWEEP_BYTES + 1);
+                EPD_3IN7_4Gray_ToMonoSpan(image + off, 1, xbyte, len, new24);
+                TEST_ASSERT_EQUAL_MEMORY(old24, new24, len);
+                TEST_ASSERT_EQUAL_UINT8(SENTINEL, new24[len]);
+            }
+        }
+    }
+}
+
+// One gray pixel anywhere in a black and white frame, in the prologue, the words or the tail
+static void test_is_mono_alignment_sweep(void)
+{
+    static const UBYTE mono[] = {0x00, 0xFF, 0x3C, 0xC3};
+    static const UDOUBLE at[] = {0, 1, 2, 3, 4, 5, 7, 8, 1001, EPD_3IN7_PLANE_BYTES * 2 - 5,
+                                 EPD_3IN7_PLANE_BYTES * 2 - 4, EPD_3IN7_PLANE_BYTES * 2 - 1};
+    for (int off = 0; off < 4; off++) {
+        UBYTE *frame = image + off;
+        for (UDOUBLE i = 0; i < EPD_3IN7_PLANE_BYTES * 2; i++) frame[i] = mono[(i + off) % 4];
+        TEST_ASSERT_EQUAL_UINT8(1, EPD_3IN7_4Gray_IsMono(frame));
+        for (size_t a = 0; a < sizeof(at) / sizeof(at[0]); a++) {
+            for (int px = 0; px < 4; px++) {
+                UBYTE keep = frame[at[a]];
+                frame[at[a]] ^= 0x40 >> (2 * px); // 00 <-> 01, 11 <-> 10
+                TEST_ASSERT_EQUAL_UINT8(0, EPD_3IN7_4Gray_IsMono(frame));
+                frame[at[a]] = keep;
+            }
+        }
+        TEST_ASSERT_EQUAL_UINT8(1, EPD_3IN7_4Gray_IsMono(frame));
+    }
+}
+
+// Both planes of a full frame, old two pass loop vs one EPD_3IN7_4Gray_Split pass
+static void test_split_timing(void)
+{
+    const int reps = 200;
+    unsigned long t0 = micros();
+    for (int r = 0; r < reps; r++) {
+        oldConvert(image, old24, old26);
+        image[r] ^= old24[r];   // keep the loop from being hoisted
+    }
+    unsigned long t1 = micros();
+    for (int r = 0; r < reps; r++) {
+        EPD_3IN7_4Gray_Split(image, new24, new26, EPD_3IN7_PLANE_BYTES);
+        image[r] ^= new24[r];
+    }
+    unsigned long t2 = micros();
+    double old_us = (double)(t1 - t0) / reps, new_us = (double)(t2 - t1) / reps;
+    printf("full frame, both planes: old scalar %.1f us, EPD_3IN7_4Gray_Split %.1f us (%.1fx)\n",
+           old_us, new_us, old_us / new_us);
+    TEST_ASSERT_LESS_THAN(old_us, new_us);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_split_matches_old_all_byte_values);
+    RUN_TEST(test_split_matches_old_random_frame);
+    RUN_TEST(test_split_alignment_sweep);
+    RUN_TEST(test_to_mono_span_alignment_sweep);
+    RUN_TEST(test_is_mono_alignment_sweep);
+    RUN_TEST(test_split_timing);
+    return UNITY_END();
+}
@@ -0,0 +1,190 @@
+/*****************************************************************************
+* | File      	:   test_main.cpp
+* | Function    :   USE_PACKED_FONTS glyphs against the byte padded tables
+* | Info        :   font_packed.cpp must decode to the font*.cpp rows, and strings
+*                   drawn from it must match the padded fonts in every Paint setup.
+*                   A stale font_packed.cpp fails here. Also times both
+******************************************************************************/
+#define USE_PACKED_FONTS 1
+#include <unity.h>
+#include "bench.h"
+#include "GUI_Paint.cpp"
+#include "fonts/font8.cpp"
+#include "fonts/font12.cpp"
+#include "fonts/font16.cpp"
+#include "fonts/font20.cpp"
+#include "fonts/font24.cpp"
+#include "fonts/font_r270.cpp"
+#include "fonts/font_packed.cpp"
+
+#define CANVAS_WIDTH  280 // the panel's, drawn through a rotation like Display.cpp does
+#define CANVAS_HEIGHT 480
+#define CANVAS_BYTES (CANVAS_WIDTH / 8 * CANVAS_HEIGHT * 2) // a 4 gray canvas, both layouts
+#define FUZZ_DRAWS 4000
+#define BENCH_REPS 100
+
+static sFONT *packed_fonts[] = {&Font8, &Font12, &Font16, &Font20, &Font24};
+#define FONT_COUNT (sizeof(packed_fonts) / sizeof(packed_fonts[0]))
+// The byte padded tables the packed streams were generated from
+static sFONT padded_fonts[FONT_COUNT] = {
+    {Font8_Table,  5,  8,  Font8_Table_R270,  NULL, NULL},
+    {Font12_Table, 7,  12, Font12_Table_R270, NULL, NULL},
+    {Font16_Table, 11, 16, Font16_Table_R270, NULL, NULL},
+    {Font20_Table, 14, 20, Font20_Table_R270, NULL, NULL},
+    {Font24_Table, 17, 24, Font24_Table_R270, NULL, NULL},
+};
+static UBYTE packed_image[CANVAS_BYTES], padded_image[CANVAS_BYTES];
+
+// Both canvases set up alike and filled with the same noise, so trimmed bits show up too
+static void setupCanvases(UWORD rotate, UBYTE mirror, UBYTE scale)
+{
+    for (UDOUBLE i = 0; i < CANVAS_BYTES; i++) packed_image[i] = padded_image[i] = (UBYTE)rand();
+    Paint_NewImage(padded_image, CANVAS_WIDTH, CANVAS_HEIGHT, rotate, WHITE);
+    Paint_SetScale(scale);
+    Paint_SetMirroring(mirror);
+}
+
+static void drawBoth(UWORD x, UWORD y, const char *str, sFONT *packed, sFONT *padded, UWORD fg, UWORD bg)
+{
+    Paint_SelectImage(packed_image);
+    Paint_DrawString_EN(x, y, str, packed, fg, bg);
+    Paint_SelectImage(padded_image);
+    Paint_DrawString_EN(x, y, str, padded, fg, bg);
+}
+
+static UWORD randomColor(UBYTE scale)
+{
+    static const UWORD grays[] = {WHITE, GRAY1, GRAY2, BLACK};
+    return scale == 2 ? (rand() & 1 ? WHITE : BLACK) : grays[rand() % 4];
+}
+
+// 12 lines of 29 characters, as on the command page
+static void drawText(sFONT *font)
+{
+    char line[32];
+    for (int l = 0; l < 12; l++) {
+        snprintf(line, sizeof(line), "$ AT+CSQ reply %02d: +CSQ: 21,9", l);
+        Paint_DrawString_EN(4, 4 + l * font->Height, line, font, BLACK, WHITE);
+    }
+}
+
+void setUp(void)
+{
+    srand(25);
+}
+
+void tearDown(void) {}
+
+// Every glyph unpacked back into the padded row layout equals its font*.cpp rows
+static void test_unpack_matches_tables(void)
+{
+    UBYTE glyph[PAINT_GLYPH_BYTES];
+    for (size_t f = 0; f < FONT_COUNT; f++) {
+        const sFONT *font = packed_fonts[f];
+        UDOUBLE bytes = (font->Width + 7) / 8 * font->Height;
+        TEST_ASSERT_NULL(font->table);
+        TEST_ASSERT_NULL(font->table_r270);
+        TEST_ASSERT_EQUAL_UINT16(padded_fonts[f].Width, font->Width);
+        TEST_ASSERT_EQUAL_UINT16(padded_fonts[f].Height, font->Height);
+        for (int c = 0; c < 95; c++) {
+            Paint_UnpackGlyph(font, c, glyph);
+            TEST_ASSERT_EQUAL_MEMORY(padded_fonts[f].table + c * bytes, glyph, bytes);
+        }
+    }
+}
+
+// Every glyph of every font on the panel's 270 degree canvas, both scales and background modes
+static void test_every_glyph_r270(void)
+{
+    char str[2] = {0, 0};
+    for (UBYTE scale = 2; scale <= 4; scale += 2) {
+        setupCanvases(ROTATE_270, MIRROR_NONE, scale);
+        for (size_t f = 0; f < FONT_COUNT; f++) {
+            UWORD x = 0, y = 0, w = padded_fonts[f].Width, h = padded_fonts[f].Height;
+            for (char ch = ' '; ch <= '~'; ch++) {
+                if (x + w > Paint.Width) {
+                    x = 0;
+                    y = (y + h) % (Paint.Height - h);
+                }
+                str[0] = ch;
+                drawBoth(x, y, str, packed_fonts[f], &padded_fonts[f], BLACK,
+                         ch & 1 ? WHITE : (scale == 2 ? BLACK : GRAY2));
+                x += w;
+            }
+            TEST_ASSERT_EQUAL_MEMORY(padded_image, packed_image, CANVAS_BYTES);
+        }
+    }
+}
+
+// Random strings across rotations, mirrors, scales, colours, positions and clip rectangles
+static void test_fuzz_strings(void)
+{
+    static const UWORD rotates[] = {ROTATE_0, ROTATE_90, ROTATE_180, ROTATE_270};
+    char str[9];
+    for (int d = 0; d < FUZZ_DRAWS; d++) {
+        if (d % 100 == 0) {
+            setupCanvases(rotates[rand() % 4], (UBYTE)(rand() % 4 == 0 ? rand() % 4 : MIRROR_NONE),
+                          (UBYTE)(rand() & 1 ? 4 : 2));
+        }
+        size_t f = rand() % FONT_COUNT;
+        int len = 1 + rand() % 8;
+        for (int i = 0; i < len; i++) str[i] = (char)(' ' + rand() % 95);
+        str[len] = '\0';
+        if (rand() % 3 == 0) {
+            UWORD x0 = rand() % Paint.Width, y0 = rand() % Paint.Height;
+            Paint_SetClip(x0, y0, x0 + rand() % Paint.Width, y0 + rand() % Paint.Height);
+        } else {
+            Paint_ResetClip();
+        }
+        drawBoth(rand() % Paint.Width, rand() % Paint.Height, str, packed_fonts[f], &padded_fonts[f],
+                 randomColor(Paint.Scale), rand() & 1 ? FONT_BACKGROUND : randomColor(Paint.Scale));
+        if (d % 100 == 99) TEST_ASSERT_EQUAL_MEMORY(padded_image, packed_image, CANVAS_BYTES);
+    }
+}
+
+// A --chars build: characters go through packed_map, ones left out draw as a space
+static void test_packed_map(void)
+{
+    static UBYTE map[95];
+    sFONT mapped = Font12;
+    mapped.packed_map = map;
+    for (int c = 0; c < 95; c++) map[c] = (UBYTE)c;
+    map['A' - ' '] = 'B' - ' ';
+    map['x' - ' '] = 0;
+
+    setupCanvases(ROTATE_270, MIRROR_NONE, 2);
+    drawBoth(10, 10, "ABCxyz", &mapped, &padded_fonts[1], BLACK, WHITE);
+    Paint_SelectImage(padded_image);
+    Paint_DrawString_EN(10, 10, "BBC yz", &padded_fonts[1], BLACK, WHITE);
+    TEST_ASSERT_EQUAL_MEMORY(padded_image, packed_image, CANVAS_BYTES);
+}
+
+// Command page text on the 270 degree canvas, packed columns vs the padded pre-rotated table
+static void test_packed_timing(void)
+{
+    for (size_t f = 2; f < FONT_COUNT; f++) {
+        sFONT *packed = packed_fonts[f], *padded = &padded_fonts[f];
+        double pixels = 12 * 29.0 * padded->Width * padded->Height;
+        for (UBYTE scale = 2; scale <= 4; scale += 2) {
+            setupCanvases(ROTATE_270, MIRROR_NONE, scale);
+            Paint_SelectImage(packed_image);
+            double packed_us = bench_us(BENCH_REPS, [packed](int) { drawText(packed); });
+            Paint_SelectImage(padded_image);
+            double padded_us = bench_us(BENCH_REPS, [padded](int) { drawText(padded); });
+            TEST_ASSERT_EQUAL_MEMORY(padded_image, packed_image, CANVAS_BYTES);
+            printf("Font%u scale %u, 12 lines: packed %.1f us (%.2f ns/pixel), padded %.1f us (%.2f ns/pixel)\n",
+                   padded->Height, scale, packed_us, packed_us * 1000 / pixels, padded_us, padded_us * 1000 / pixels);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_unpack_matches_tables);
+    RUN_TEST(test_every_glyph_r270);
+    RUN_TEST(test_fuzz_strings);
+    RUN_TEST(test_packed_map);
+    RUN_TEST(test_packed_timing);
+    return UNITY_END();
+}
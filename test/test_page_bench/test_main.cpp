@@ -0,0 +1,248 @@
+/*****************************************************************************
+* | File      	:   test_main.cpp
+* | Function    :   Paint plus transfer cost of the home and command pages, text paint cost
+*                   per pixel and per page render
+* | Info        :   Runs Display.cpp's own page code against the recording link,
+*                   with the SPI stream only counted so the stub stays out of the timings.
+*                   Build it once per canvas layout to compare them:
+*                   pio test -e native -e native_landscape -f test_page_bench
+*                   Banded painting is compiled in to time it, pages still paint directly
+*                   since no band workers start on the host
+******************************************************************************/
+#define USE_BANDED_PAINT 1
+#include <unity.h>
+#include "spi_record.h"
+#include "bench.h"
+#include "Display.cpp"
+#include "EPD_3in7.cpp"
+#include "GUI_Paint.cpp"
+#include "fonts/font8.cpp"
+#include "fonts/font12.cpp"
+#include "fonts/font16.cpp"
+#include "fonts/font20.cpp"
+#include "fonts/font24.cpp"
+#include "fonts/font_r270.cpp"
+
+#define BENCH_REPS 100
+#define COMMAND_LINES 12
+#define LAYOUT (USE_LANDSCAPE_PAINT ? "landscape" : "portrait")
+
+// Font20 without its pre-rotated columns, every glyph pixel goes through Paint.WritePixel
+static sFONT pixel_font20;
+static UBYTE reference[EPD_3IN7_PLANE_BYTES * 2];
+
+// Home page with every status line and the GNSS column populated
+static void fillHomeState(void)
+{
+    modem_powered = modem_ready = modem_net = true;
+    sms_unread_count = 3;
+    wifi_data.wifi_on = wifi_data.wifi_connected = true;
+    signal_data.rsrq = 22;
+    signal_data.rsrp = 50;
+    gnss_data.gnss_on = true;
+    strcpy(gnss_data.time, "123456");
+    strcpy(gnss_data.date, "170226");
+    strcpy(gnss_data.altitude, "212.5");
+    strcpy(gnss_data.speed, "0.4");
+    gnss_data.latitude = 59.329323;
+    gnss_data.longitude = 18.068581;
+}
+
+// Command page with its history full of wrapped 30 character Font20 lines
+static void fillCommandState(void)
+{
+    cmd_buffer.history_count = CMD_HISTORY_LINES;
+    for (int i = 0; i < CMD_HISTORY_LINES; i++) {
+        snprintf(cmd_buffer.history[i], CMD_BUFFER_SIZE, "$ AT+CSQ reply %02d: +CSQ: 21,99 OK", i);
+    }
+    strcpy(cmd_buffer.input, "AT+CREG?");
+}
+
+// The command page's text: COMMAND_LINES lines of 29 Font20 characters, black on white
+static void drawCommandText(sFONT *font)
+{
+    char line[32];
+    for (int l = 0; l < COMMAND_LINES; l++) {
+        snprintf(line, sizeof(line), "$ AT+CSQ reply %02d: +CSQ: 21,9", l);
+        Paint_DrawString_EN(4, 4 + l * font->Height, line, font, BLACK, WHITE);
+    }
+}
+
+// Bytes of the canvas paintConfigureForMode selected
+static UWORD canvasBytes(void)
+{
+    return Paint.Image == image_buf4 ? image_size4 : image_size1;
+}
+
+void setUp(void)
+{
+    spi_record_reset();
+    spi_record_enabled = false;
+}
+
+void tearDown(void) {}
+
+// Full GC refresh of the home page: paint, gray check, convert and send
+static void test_home_page_paint_and_transfer(void)
+{
+    fillHomeState();
+    setPage(PAGE_HOME);
+
+    double paint_us = bench_us(BENCH_REPS, [](int) { paintCurrentPage(); });
+    double total_us = bench_us(BENCH_REPS, [](int) { displayCurrentPageFull(); });
+    printf("%s home page: paint %.1f us, transfer %.1f us, total %.1f us\n",
+           LAYOUT, paint_us, total_us - paint_us, total_us);
+    TEST_ASSERT_TRUE(partial_ram_valid);
+}
+
+// A keystroke on the command page: repaint the 1gray canvas, diff it and send the changed window
+// The diff and transfer are timed again on their own, against the frame the keystroke replaced
+static void test_command_page_paint_and_transfer(void)
+{
+    static uint32_t before[DIFF_STRIPS][GHOST_TILES_X];
+    fillCommandState();
+    setPage(PAGE_COMMAND);
+    displayCurrentPageFull();
+    Display_HandlePartialUpdate();
+
+    // Alternate between two inputs, every call has one changed character to send
+    size_t input_len = strlen(cmd_buffer.input);
+    double total_us = bench_us(BENCH_REPS, [input_len](int r) {
+        cmd_buffer.input[input_len] = r & 1 ? 'a' : 'b';
+        cmd_buffer.input[input_len + 1] = '\0';
+        Display_HandlePartialUpdate();
+    });
+    memcpy(before, frame1_hash, sizeof(before));
+    cmd_buffer.input[input_len] = 'c';
+    Display_HandlePartialUpdate();
+
+    double copy_us = bench_us(BENCH_REPS, [](int) { memcpy(frame1_hash, before, sizeof(before)); });
+    double transfer_us = bench_us(BENCH_REPS, [](int) {
+        memcpy(frame1_hash, before, sizeof(before));
+        schedulePartialFrame(0);
+    }) - copy_us;
+    // The hashes now match the painted frame, nothing left to send
+    TEST_ASSERT_FALSE(schedulePartialFrame(0));
+    printf("%s command page keystroke: paint %.1f us, diff + transfer %.1f us, total %.1f us\n",
+           LAYOUT, total_us - transfer_us, transfer_us, total_us);
+}
+
+// Home and boot page paint, direct vs recorded once and replayed into PAINT_BANDS bands by paintBands
+// The host replays every band on one thread, on the device the two band workers split them
+static void test_pages_banded_vs_direct(void)
+{
+    static const PageType pages[] = {PAGE_HOME, PAGE_BOOT};
+    fillHomeState();
+    for (size_t p = 0; p < sizeof(pages) / sizeof(pages[0]); p++) {
+        setPage(pages[p]);
+        double direct_us = bench_us(BENCH_REPS, [](int) { paintCurrentPage(); });
+        memcpy(reference, Paint.Image, canvasBytes());
+        double record_us = bench_us(BENCH_REPS, [](int) {
+            Paint_Record(&page_list);
+            paintCurrentPage();
+            Paint_Record(NULL);
+        });
+        TEST_ASSERT_FALSE(page_list.Incomplete);
+        double replay_us = bench_us(BENCH_REPS, [](int) {
+            band_next = 0;
+            paintBands();
+        });
+        TEST_ASSERT_EQUAL_MEMORY(reference, Paint.Image, canvasBytes());
+        printf("%s %s page paint: direct %.1f us, banded record %.1f us + %d band replay %.1f us (one thread)\n",
+               LAYOUT, pages[p] == PAGE_HOME ? "home" : "boot", direct_us, record_us, PAINT_BANDS, replay_us);
+    }
+}
+
+// One 30 character line per font through Paint_DrawString_EN, blitted as pre-rotated columns at
+// 270 degrees, or as table rows on the landscape canvas
+static void test_string_blit_per_font(void)
+{
+    static sFONT *fonts[] = {&Font12, &Font16, &Font20, &Font24};
+    static const char *line = "$ AT+CSQ reply 07: +CSQ: 21,9";
+    for (int gray = 1; gray <= 4; gray += 3) {
+        paintConfigureForMode(gray);
+        for (size_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+            sFONT *font = fonts[f];
+            double us = bench_us(BENCH_REPS * 10, [font](int r) {
+                Paint_DrawString_EN(10, 10 + (r % 8) * font->Height, line, font, WHITE, BLACK);
+            });
+            printf("%s %dgray Font%-2u line: %.2f us, %.2f ns/pixel\n", LAYOUT, gray, font->Height, us,
+                   us * 1000 / (strlen(line) * font->Width * font->Height));
+        }
+    }
+}
+
+// Command page text through the pixel path, generic Paint_SetPixelAny vs the writer Paint_SelectWriter
+// picks for the canvas, same image either way, the gap is too small to assert on a busy host
+// pixel_font20 only misses the blit at 270 degrees, the landscape canvas blits its table rows
+static void test_command_page_per_pixel(void)
+{
+#if USE_LANDSCAPE_PAINT
+    TEST_IGNORE_MESSAGE("no pixel path font on the landscape canvas");
+#endif
+    const double pixels = COMMAND_LINES * 29.0 * Font20.Width * Font20.Height;
+    for (int gray = 1; gray <= 4; gray += 3) {
+        paintConfigureForMode(gray);
+        Paint.WritePixel = Paint_SetPixelAny;
+        Paint_Clear(WHITE);
+        drawCommandText(&pixel_font20);
+        memcpy(reference, Paint.Image, canvasBytes());
+        double any_us = bench_us(BENCH_REPS, [](int) { drawCommandText(&pixel_font20); });
+
+        Paint_SelectWriter(&Paint);
+        Paint_Clear(WHITE);
+        drawCommandText(&pixel_font20);
+        TEST_ASSERT_EQUAL_MEMORY(reference, Paint.Image, canvasBytes());
+        double fixed_us = bench_us(BENCH_REPS, [](int) { drawCommandText(&pixel_font20); });
+
+        printf("%dgray command page text, pixel path: Paint_SetPixelAny %.1f us (%.2f ns/pixel), "
+               "selected writer %.1f us (%.2f ns/pixel)\n",
+               gray, any_us, any_us * 1000 / pixels, fixed_us, fixed_us * 1000 / pixels);
+    }
+}
+
+// Full command page render, clear plus text: Font20's pre-rotated column blits vs the pixel path
+static void test_command_page_render(void)
+{
+#if USE_LANDSCAPE_PAINT
+    TEST_IGNORE_MESSAGE("no pixel path font on the landscape canvas");
+#endif
+    for (int gray = 1; gray <= 4; gray += 3) {
+        paintConfigureForMode(gray);
+        Paint_Clear(WHITE);
+        drawCommandText(&pixel_font20);
+        memcpy(reference, Paint.Image, canvasBytes());
+        double pixel_us = bench_us(BENCH_REPS, [](int) {
+            Paint_Clear(WHITE);
+            drawCommandText(&pixel_font20);
+        });
+
+        Paint_Clear(WHITE);
+        drawCommandText(&Font20);
+        TEST_ASSERT_EQUAL_MEMORY(reference, Paint.Image, canvasBytes());
+        double blit_us = bench_us(BENCH_REPS, [](int) {
+            Paint_Clear(WHITE);
+            drawCommandText(&Font20);
+        });
+
+        printf("%dgray command page render: pixel path %.1f us, column blit %.1f us (%.1fx)\n",
+               gray, pixel_us, blit_us, pixel_us / blit_us);
+        TEST_ASSERT_LESS_THAN(pixel_us, blit_us);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Display_Init();
+    pixel_font20 = Font20;
+    pixel_font20.table_r270 = NULL;
+
+    UNITY_BEGIN();
+    RUN_TEST(test_home_page_paint_and_transfer);
+    RUN_TEST(test_command_page_paint_and_transfer);
+    RUN_TEST(test_pages_banded_vs_direct);
+    RUN_TEST(test_string_blit_per_font);
+    RUN_TEST(test_command_page_per_pixel);
+    RUN_TEST(test_command_page_render);
+    return UNITY_END();
+}
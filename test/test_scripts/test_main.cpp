@@ -0,0 +1,232 @@
+/*****************************************************************************
+* | File      	:   test_main.cpp
+* | Function    :   EPD command scripts against the pre-script driver's SPI stream
+* | Info        :   The golden sequences below were recorded from the driver as it was
+*                   before the command scripts (SendCommand/SendData call by call), as
+*                   command, data length, data. Init, display option, LUT and sleep must
+*                   put exactly the same (DC, byte) stream on the wire
+******************************************************************************/
+#include <unity.h>
+#include "spi_record.h"
+#include "EPD_3in7.cpp"
+
+static const UBYTE golden_init_4Gray[] =
+{
+0x12, 0,
+0x46, 1, 0xF7,
+0x47, 1, 0xF7,
+0x01, 3, 0xDF, 0x01, 0x00,
+0x03, 1, 0x00,
+0x04, 3, 0x41, 0xA8, 0x32,
+0x11, 1, 0x03,
+0x3C, 1, 0x00,
+0x0C, 5, 0xAE, 0xC7, 0xC3, 0xC0, 0xC0,
+0x18, 1, 0x80,
+0x2C, 1, 0x44,
+0x37, 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x44, 4, 0x00, 0x00, 0x17, 0x01,
+0x45, 4, 0x00, 0x00, 0xDF, 0x01,
+0x22, 1, 0xCF,
+};
+static const UBYTE golden_init_1Gray[] =
+{
+0x12, 0,
+0x46, 1, 0xF7,
+0x47, 1, 0xF7,
+0x01, 3, 0xDF, 0x01, 0x00,
+0x03, 1, 0x00,
+0x04, 3, 0x41, 0xA8, 0x32,
+0x11, 1, 0x03,
+0x3C, 1, 0x00,
+0x0C, 5, 0xAE, 0xC7, 0xC3, 0xC0, 0xC0,
+0x18, 1, 0x80,
+0x2C, 1, 0x44,
+0x37, 10, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF,
+0x44, 4, 0x00, 0x00, 0x17, 0x01,
+0x45, 4, 0x00, 0x00, 0xDF, 0x01,
+0x22, 1, 0xCF,
+};
+static const UBYTE golden_lut_4Gray_GC[] =
+{
+0x32, 105,
+0x2A, 0x06, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x28, 0x06, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x20, 0x06, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x14, 0x06, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0x02, 0x0A, 0x00, 0x00, 0x00, 0x08, 0x08, 0x02,
+0x00, 0x02, 0x02, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x22, 0x22, 0x22, 0x22, 0x22,
+};
+static const UBYTE golden_lut_1Gray_GC[] =
+{
+0x32, 105,
+0x2A, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x05, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x2A, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x05, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0x03, 0x0A, 0x00, 0x02, 0x06, 0x0A, 0x05, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x22, 0x22, 0x22, 0x22, 0x22,
+};
+static const UBYTE golden_lut_1Gray_DU[] =
+{
+0x32, 105,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x0A, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x05, 0x05, 0x00, 0x05, 0x03, 0x05, 0x05, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x22, 0x22, 0x22, 0x22, 0x22,
+};
+static const UBYTE golden_lut_1Gray_A2[] =
+{
+0x32, 105,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x22, 0x22, 0x22, 0x22, 0x22,
+};
+static const UBYTE golden_sleep[] =
+{
+0x10, 1, 0x03,
+};
+
+// The 0x37 display option phases of the two init sequences above
+static const UBYTE golden_option_4Gray[] =
+{
+0x37, 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+static const UBYTE golden_option_1Gray[] =
+{
+0x37, 10, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+// Golden listing to the (DC, byte) pairs it puts on the wire
+static std::vector<SpiByte> expand(const UBYTE *Golden, size_t Len)
+{
+    std::vector<SpiByte> out;
+    for (size_t i = 0; i < Len; i += 2 + Golden[i + 1]) {
+        SpiByte cmd = {0, Golden[i]};
+        out.push_back(cmd);
+        for (UBYTE k = 0; k < Golden[i + 1]; k++) {
+            SpiByte data = {1, Golden[i + 2 + k]};
+            out.push_back(data);
+        }
+    }
+    return out;
+}
+
+#define ASSERT_STREAM(golden) TEST_ASSERT_TRUE_MESSAGE(spi_stream_equals(expand(golden, sizeof(golden))), #golden)
+
+void setUp(void)
+{
+    spi_record_reset();
+}
+
+void tearDown(void) {}
+
+static void test_init_4gray(void)
+{
+    EPD_3IN7_4Gray_Init();
+    ASSERT_STREAM(golden_init_4Gray);
+}
+
+static void test_init_1gray(void)
+{
+    EPD_3IN7_1Gray_Init();
+    ASSERT_STREAM(golden_init_1Gray);
+}
+
+// Switching gray mode on a running panel sends just the option phase, once
+static void test_option_switch(void)
+{
+    EPD_3IN7_4Gray_Init();
+    spi_record_reset();
+    EPD_3IN7_SetGrayMode(1);
+    ASSERT_STREAM(golden_option_1Gray);
+
+    spi_record_reset();
+    EPD_3IN7_SetGrayMode(1);
+    TEST_ASSERT_EQUAL_UINT(0, spi_stream.size());
+
+    EPD_3IN7_SetGrayMode(4);
+    ASSERT_STREAM(golden_option_4Gray);
+}
+
+// Each table at the stock temperature band, loaded once after init
+static void test_lut_tables(void)
+{
+    TEST_ASSERT_EQUAL_UINT8(EPD_3IN7_TEMP_BAND_STOCK, EPD_3IN7_GetTempBand());
+    EPD_3IN7_4Gray_Init();
+
+    spi_record_reset();
+    EPD_3IN7_Load_LUT(EPD_3IN7_LUT_4GRAY_GC);
+    ASSERT_STREAM(golden_lut_4Gray_GC);
+    spi_record_reset();
+    EPD_3IN7_Load_LUT(EPD_3IN7_LUT_1GRAY_GC);
+    ASSERT_STREAM(golden_lut_1Gray_GC);
+    spi_record_reset();
+    EPD_3IN7_Load_LUT(EPD_3IN7_LUT_1GRAY_DU);
+    ASSERT_STREAM(golden_lut_1Gray_DU);
+    spi_record_reset();
+    EPD_3IN7_Load_LUT(EPD_3IN7_LUT_1GRAY_A2);
+    ASSERT_STREAM(golden_lut_1Gray_A2);
+
+    // Already loaded, the state cache skips it
+    spi_record_reset();
+    EPD_3IN7_Load_LUT(EPD_3IN7_LUT_1GRAY_A2);
+    TEST_ASSERT_EQUAL_UINT(0, spi_stream.size());
+}
+
+static void test_sleep(void)
+{
+    EPD_3IN7_Sleep();
+    ASSERT_STREAM(golden_sleep);
+}
+
+// Sleep forgets the cached registers, the next init and LUT go out in full again
+static void test_init_after_sleep(void)
+{
+    EPD_3IN7_4Gray_Init();
+    EPD_3IN7_Load_LUT(EPD_3IN7_LUT_4GRAY_GC);
+    EPD_3IN7_Sleep();
+
+    spi_record_reset();
+    EPD_3IN7_4Gray_Init();
+    ASSERT_STREAM(golden_init_4Gray);
+    spi_record_reset();
+    EPD_3IN7_Load_LUT(EPD_3IN7_LUT_4GRAY_GC);
+    ASSERT_STREAM(golden_lut_4Gray_GC);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_init_4gray);
+    RUN_TEST(test_init_1gray);
+    RUN_TEST(test_option_switch);
+    RUN_TEST(test_lut_tables);
+    RUN_TEST(test_sleep);
+    RUN_TEST(test_init_after_sleep);
+    return UNITY_END();
+}
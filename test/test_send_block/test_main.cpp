@@ -0,0 +1,124 @@
+/*****************************************************************************
+* | File      	:   test_main.cpp
+* | Function    :   EPD_3IN7_SendDataBlock vs the per byte EPD_3IN7_SendData loop
+* | Info        :   Same (DC, byte) stream, GPIO and SPI driver calls counted per byte
+******************************************************************************/
+#include <unity.h>
+#include "spi_record.h"
+#include "EPD_3in7.cpp"
+
+typedef struct {
+    unsigned long pin_writes;
+    unsigned long spi_calls;
+    double host_us;
+} SendCost;
+
+static UBYTE frame[EPD_3IN7_PLANE_BYTES];
+static const int REPS = 20;
+
+void setUp(void)
+{
+    spi_record_reset();
+    srand(2);
+    for (UDOUBLE i = 0; i < sizeof(frame); i++) frame[i] = (UBYTE)rand();
+}
+
+void tearDown(void) {}
+
+// The data phase as it was sent before the block API, DC and CS driven for every byte
+static void sendPerByte(const UBYTE *Data, UDOUBLE Len)
+{
+    EPD_3IN7_SendCommand(0x24);
+    for (UDOUBLE i = 0; i < Len; i++) EPD_3IN7_SendData(Data[i]);
+}
+
+static void sendBlock(const UBYTE *Data, UDOUBLE Len)
+{
+    EPD_3IN7_SendCommand(0x24);
+    EPD_3IN7_SendDataBlock(Data, Len);
+}
+
+static SendCost measure(void (*send)(const UBYTE *, UDOUBLE), UDOUBLE Len)
+{
+    SendCost cost;
+    spi_record_reset();
+    send(frame, Len);
+    cost.pin_writes = native_pin_writes;
+    cost.spi_calls = spi_byte_calls + spi_bulk_calls;
+
+    unsigned long t0 = micros();
+    for (int r = 0; r < REPS; r++) {
+        spi_stream.clear();
+        send(frame, Len);
+    }
+    cost.host_us = (double)(micros() - t0) / REPS;
+    return cost;
+}
+
+static void test_block_stream_matches_per_byte(void)
+{
+    const UDOUBLE lens[] = {1, 2, 105, 1000, EPD_3IN7_PLANE_BYTES};
+    for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+        spi_record_reset();
+        sendPerByte(frame, lens[i]);
+        std::vector<SpiByte> before = spi_stream;
+
+        spi_record_reset();
+        sendBlock(frame, lens[i]);
+        TEST_ASSERT_TRUE(spi_stream_equals(before));
+    }
+}
+
+// One 0x24 plane: the per byte path costs 3 GPIO writes and a driver call per byte,
+// the block path a fixed handful for the whole phase
+static void test_block_calls_per_byte(void)
+{
+    const UDOUBLE len = EPD_3IN7_PLANE_BYTES;
+    SendCost before = measure(sendPerByte, len);
+    SendCost after = measure(sendBlock, len);
+
+    TEST_ASSERT_EQUAL_UINT(3 * len + 3, before.pin_writes);
+    TEST_ASSERT_EQUAL_UINT(len + 1, before.spi_calls);
+    TEST_ASSERT_EQUAL_UINT(4, after.pin_writes);
+    TEST_ASSERT_EQUAL_UINT(2, after.spi_calls);
+
+    printf("plane %u B  per byte: %.3f GPIO writes/B, %.3f SPI calls/B, %.2f ns/B host\n", (unsigned)len,
+           (double)before.pin_writes / len, (double)before.spi_calls / len, before.host_us * 1000 / len);
+    printf("plane %u B  block:    %.5f GPIO writes/B, %.5f SPI calls/B, %.2f ns/B host\n", (unsigned)len,
+           (double)after.pin_writes / len, (double)after.spi_calls / len, after.host_us * 1000 / len);
+}
+
+// Whole refreshes through the public API, GPIO and driver calls per payload byte
+static void test_display_calls_per_byte(void)
+{
+    static UBYTE image4[EPD_3IN7_PLANE_BYTES * 2];
+    memset(image4, 0xA5, sizeof(image4));
+
+    spi_record_reset();
+    EPD_3IN7_1Gray_Display(frame);
+    EPD_3IN7_WaitIdle();
+    unsigned long bytes1 = spi_stream.size(), pins1 = native_pin_writes, calls1 = spi_byte_calls + spi_bulk_calls;
+
+    spi_record_reset();
+    EPD_3IN7_4Gray_Display(image4);
+    EPD_3IN7_WaitIdle();
+    unsigned long bytes4 = spi_stream.size(), pins4 = native_pin_writes, calls4 = spi_byte_calls + spi_bulk_calls;
+
+    printf("1Gray_Display: %lu B sent, %.4f GPIO writes/B, %.4f SPI calls/B (per byte path: 3, 1)\n",
+           bytes1, (double)pins1 / bytes1, (double)calls1 / bytes1);
+    printf("4Gray_Display: %lu B sent, %.4f GPIO writes/B, %.4f SPI calls/B (per byte path: 3, 1)\n",
+           bytes4, (double)pins4 / bytes4, (double)calls4 / bytes4);
+    TEST_ASSERT_LESS_THAN(0.05, (double)pins1 / bytes1);
+    TEST_ASSERT_LESS_THAN(0.05, (double)pins4 / bytes4);
+    TEST_ASSERT_LESS_THAN(0.05, (double)calls1 / bytes1);
+    TEST_ASSERT_LESS_THAN(0.05, (double)calls4 / bytes4);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_block_stream_matches_per_byte);
+    RUN_TEST(test_block_calls_per_byte);
+    RUN_TEST(test_display_calls_per_byte);
+    return UNITY_END();
+}
@@ -0,0 +1,183 @@
+/*****************************************************************************
+* | File      	:   test_main.cpp
+* | Function    :   DEV_SPI_WriteBulk against a recording SPI master driver
+* | Info        :   Checks chunking, the in flight limit and CS framing, and compares
+*                   bulk vs per-byte transactions for a full plane
+******************************************************************************/
+#include <unity.h>
+#include "native_host.h"
+#include "DEV_Config.cpp"
+
+#include <vector>
+
+// Recording SPI master: queued transactions complete in order when their result is taken
+struct SpiCall {
+    const UBYTE *tx;
+    UDOUBLE bytes;
+    UBYTE cs;           // CS level when the transaction was queued
+};
+static std::vector<SpiCall> spi_queued;
+static std::vector<spi_transaction_t *> spi_in_flight;
+static UDOUBLE spi_max_in_flight = 0;
+static UDOUBLE spi_polled = 0;
+static UDOUBLE spi_results = 0;
+static int spi_bus_held = 0;
+static bool spi_slot_reused = false;
+static bool spi_bus_violation = false;
+
+esp_err_t spi_bus_initialize(spi_host_device_t, const spi_bus_config_t *, int) { return ESP_OK; }
+esp_err_t spi_bus_add_device(spi_host_device_t, const spi_device_interface_config_t *, spi_device_handle_t *handle)
+{
+    *handle = (spi_device_handle_t)1;
+    return ESP_OK;
+}
+esp_err_t spi_device_polling_transmit(spi_device_handle_t, spi_transaction_t *)
+{
+    ++spi_polled;
+    return ESP_OK;
+}
+esp_err_t spi_device_queue_trans(spi_device_handle_t, spi_transaction_t *t, uint32_t)
+{
+    for (size_t i = 0; i < spi_in_flight.size(); i++) {
+        if (spi_in_flight[i] == t) spi_slot_reused = true;
+    }
+    if (spi_bus_held != 1) spi_bus_violation = true;
+    SpiCall call = {(const UBYTE *)t->tx_buffer, (UDOUBLE)(t->length / 8), native_pins[EPD_CS_PIN]};
+    spi_queued.push_back(call);
+    spi_in_flight.push_back(t);
+    if (spi_in_flight.size() > spi_max_in_flight) spi_max_in_flight = spi_in_flight.size();
+    return ESP_OK;
+}
+esp_err_t spi_device_get_trans_result(spi_device_handle_t, spi_transaction_t **t, uint32_t)
+{
+    if (spi_in_flight.empty()) {
+        *t = NULL;
+        return ESP_FAIL;
+    }
+    *t = spi_in_flight.front();
+    spi_in_flight.erase(spi_in_flight.begin());
+    ++spi_results;
+    return ESP_OK;
+}
+esp_err_t spi_device_acquire_bus(spi_device_handle_t, uint32_t) { ++spi_bus_held; return ESP_OK; }
+void spi_device_release_bus(spi_device_handle_t) { --spi_bus_held; }
+
+static UBYTE src[EPD_SPI_MAX_CHUNK * 8];
+
+void setUp(void)
+{
+    spi_queued.clear();
+    spi_in_flight.clear();
+    spi_max_in_flight = 0;
+    spi_polled = 0;
+    spi_results = 0;
+    spi_bus_held = 0;
+    spi_slot_reused = false;
+    spi_bus_violation = false;
+    for (UDOUBLE i = 0; i < sizeof(src); i++) src[i] = (UBYTE)(i * 7 + (i >> 8));
+    DEV_SPI_ResetStats();
+}
+
+void tearDown(void) {}
+
+// Chunks must tile the source in order, none over EPD_SPI_MAX_CHUNK, all sent under one low CS
+static void checkBulk(UDOUBLE len)
+{
+    DEV_SPI_WriteBulk(src, len);
+
+    UDOUBLE chunks = (len + EPD_SPI_MAX_CHUNK - 1) / EPD_SPI_MAX_CHUNK;
+    TEST_ASSERT_EQUAL_UINT(chunks, spi_queued.size());
+    UDOUBLE offset = 0;
+    for (size_t i = 0; i < spi_queued.size(); i++) {
+        UDOUBLE expect = len - offset < EPD_SPI_MAX_CHUNK ? len - offset : EPD_SPI_MAX_CHUNK;
+        TEST_ASSERT_TRUE(spi_queued[i].tx == src + offset);
+        TEST_ASSERT_EQUAL_UINT(expect, spi_queued[i].bytes);
+        TEST_ASSERT_EQUAL_UINT8(GPIO_PIN_RESET, spi_queued[i].cs);
+        offset += spi_queued[i].bytes;
+    }
+    TEST_ASSERT_EQUAL_UINT(len, offset);
+
+    // Everything queued is waited for before CS goes high and the bus is released
+    TEST_ASSERT_EQUAL_UINT(0, spi_in_flight.size());
+    TEST_ASSERT_EQUAL_UINT(chunks, spi_results);
+    TEST_ASSERT_LESS_OR_EQUAL(EPD_SPI_QUEUE_DEPTH, spi_max_in_flight);
+    TEST_ASSERT_FALSE(spi_slot_reused);
+    TEST_ASSERT_FALSE(spi_bus_violation);
+    TEST_ASSERT_EQUAL_INT(0, spi_bus_held);
+    TEST_ASSERT_EQUAL_UINT8(GPIO_PIN_SET, native_pins[EPD_CS_PIN]);
+    TEST_ASSERT_EQUAL_UINT(0, spi_polled);
+
+    UDOUBLE bytes, us;
+    DEV_SPI_GetStats(&bytes, &us);
+    TEST_ASSERT_EQUAL_UINT(len, bytes);
+}
+
+static void test_bulk_zero_length_sends_nothing(void)
+{
+    DEV_SPI_WriteBulk(src, 0);
+    TEST_ASSERT_EQUAL_UINT(0, spi_queued.size());
+    TEST_ASSERT_EQUAL_INT(0, spi_bus_held);
+}
+
+static void test_bulk_single_byte(void) { checkBulk(1); }
+static void test_bulk_one_chunk(void) { checkBulk(EPD_SPI_MAX_CHUNK); }
+static void test_bulk_chunk_plus_one(void) { checkBulk(EPD_SPI_MAX_CHUNK + 1); }
+static void test_bulk_queue_depth_multiple(void) { checkBulk(EPD_SPI_MAX_CHUNK * EPD_SPI_QUEUE_DEPTH); }
+
+// More chunks than queue slots with a short tail, the in flight limit must be reached and held
+static void test_bulk_over_queue_depth_with_tail(void)
+{
+    UDOUBLE len = EPD_SPI_MAX_CHUNK * (EPD_SPI_QUEUE_DEPTH + 2) + 1000;
+    checkBulk(len);
+    TEST_ASSERT_EQUAL_UINT(EPD_SPI_QUEUE_DEPTH, spi_max_in_flight);
+    TEST_ASSERT_EQUAL_UINT(1000, spi_queued.back().bytes);
+}
+
+// A 280x480 1bpp plane, the size of every full frame phase
+static void test_bulk_plane(void)
+{
+    checkBulk(280 / 8 * 480);
+    TEST_ASSERT_EQUAL_UINT(5, spi_queued.size());
+    TEST_ASSERT_EQUAL_UINT(16800 - 4 * EPD_SPI_MAX_CHUNK, spi_queued.back().bytes);
+}
+
+// Driver calls and host time for one plane sent per byte (the pre bulk path) vs in bulk
+// Host time only covers this code and the stub, the bus time is the same for both paths
+static void test_bulk_vs_per_byte_plane(void)
+{
+    const UDOUBLE len = 280 / 8 * 480;
+    const int reps = 50;
+
+    unsigned long t0 = micros();
+    for (int r = 0; r < reps; r++) {
+        for (UDOUBLE i = 0; i < len; i++) DEV_SPI_WriteByte(src[i]);
+    }
+    unsigned long t1 = micros();
+    UDOUBLE per_byte_calls = spi_polled / reps;
+    for (int r = 0; r < reps; r++) DEV_SPI_WriteBulk(src, len);
+    unsigned long t2 = micros();
+    UDOUBLE bulk_calls = (spi_queued.size() + spi_results) / reps;
+
+    TEST_ASSERT_EQUAL_UINT(len, per_byte_calls);
+    TEST_ASSERT_EQUAL_UINT(2 * ((len + EPD_SPI_MAX_CHUNK - 1) / EPD_SPI_MAX_CHUNK), bulk_calls);
+    double per_byte_us = (double)(t1 - t0) / reps, bulk_us = (double)(t2 - t1) / reps;
+    printf("plane %u B: per byte %u driver calls, %u CS toggles, %.1f us host; bulk %u driver calls, 1 CS toggle, %.2f us host\n",
+           (unsigned)len, (unsigned)per_byte_calls, (unsigned)len, per_byte_us, (unsigned)bulk_calls, bulk_us);
+    printf("wire time at %u MHz: %.0f us either way\n", EPD_SPI_CLOCK_HZ / 1000000, len * 8.0 * 1e6 / EPD_SPI_CLOCK_HZ);
+}
+
+int main(int argc, char **argv)
+{
+    DEV_Module_Init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bulk_zero_length_sends_nothing);
+    RUN_TEST(test_bulk_single_byte);
+    RUN_TEST(test_bulk_one_chunk);
+    RUN_TEST(test_bulk_chunk_plus_one);
+    RUN_TEST(test_bulk_queue_depth_multiple);
+    RUN_TEST(test_bulk_over_queue_depth_with_tail);
+    RUN_TEST(test_bulk_plane);
+    RUN_TEST(test_bulk_vs_per_byte_plane);
+    return UNITY_END();
+}
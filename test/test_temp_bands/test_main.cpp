@@ -0,0 +1,155 @@
+/*****************************************************************************
+* | File      	:   test_main.cpp
+* | Function    :   Temperature bands, LUT phase scaling and how often the sensor is read
+* | Info        :   Band edges and scales against temp_bands, EPD_3IN7_ScaleLUT limits,
+*                   and the rate limit of Display.cpp's panel temperature sampling
+******************************************************************************/
+#include <unity.h>
+#include "spi_record.h"
+#include "Display.cpp"
+#include "EPD_3in7.cpp"
+#include "GUI_Paint.cpp"
+#include "fonts/font8.cpp"
+#include "fonts/font12.cpp"
+#include "fonts/font16.cpp"
+#include "fonts/font20.cpp"
+#include "fonts/font24.cpp"
+#include "fonts/font_r270.cpp"
+
+static UBYTE lut[105];
+
+// Sensor reads started by the driver, 0x1B sent as a command
+static int sensorReads(void)
+{
+    int n = 0;
+    for (size_t i = 0; i < spi_stream.size(); i++) {
+        if (spi_stream[i].dc == 0 && spi_stream[i].byte == 0x1B) n++;
+    }
+    return n;
+}
+
+void setUp(void)
+{
+    spi_record_reset();
+    for (int i = 0; i < 105; i++) lut[i] = (UBYTE)i;
+}
+
+void tearDown(void) {}
+
+static void test_band_edges(void)
+{
+    TEST_ASSERT_EQUAL_UINT8(0, EPD_3IN7_TempBand(-128));
+    TEST_ASSERT_EQUAL_UINT8(0, EPD_3IN7_TempBand(4));
+    TEST_ASSERT_EQUAL_UINT8(1, EPD_3IN7_TempBand(5));
+    TEST_ASSERT_EQUAL_UINT8(1, EPD_3IN7_TempBand(14));
+    TEST_ASSERT_EQUAL_UINT8(2, EPD_3IN7_TempBand(15));
+    TEST_ASSERT_EQUAL_UINT8(2, EPD_3IN7_TempBand(21));
+    TEST_ASSERT_EQUAL_UINT8(3, EPD_3IN7_TempBand(22));
+    TEST_ASSERT_EQUAL_UINT8(3, EPD_3IN7_TempBand(29));
+    TEST_ASSERT_EQUAL_UINT8(4, EPD_3IN7_TempBand(30));
+    TEST_ASSERT_EQUAL_UINT8(4, EPD_3IN7_TempBand(127));
+    TEST_ASSERT_EQUAL_UINT8(EPD_3IN7_TEMP_BAND_STOCK, EPD_3IN7_TempBand(20));
+}
+
+static void test_band_scales(void)
+{
+#if USE_TEMP_SCALED_LUTS
+    static const UBYTE scales[EPD_3IN7_TEMP_BANDS] = {150, 125, 100, 85, 70};
+#else
+    static const UBYTE scales[EPD_3IN7_TEMP_BANDS] = {100, 100, 100, 100, 100};
+#endif
+    for (UBYTE band = 0; band < EPD_3IN7_TEMP_BANDS; band++)
+        TEST_ASSERT_EQUAL_UINT8(scales[band], EPD_3IN7_TempBandScale(band));
+    TEST_ASSERT_EQUAL_UINT8(100, EPD_3IN7_TempBandScale(EPD_3IN7_TEMP_BANDS));
+}
+
+// Phases in use never drop below one frame
+static void test_scale_lut_clamps_to_one(void)
+{
+    for (int g = 0; g < 10; g++) {
+        lut[50 + 5 * g] = 1;
+        lut[50 + 5 * g + 1] = 4;
+    }
+    EPD_3IN7_ScaleLUT(lut, 10, lut);
+    for (int g = 0; g < 10; g++) {
+        TEST_ASSERT_EQUAL_UINT8(1, lut[50 + 5 * g]);
+        TEST_ASSERT_EQUAL_UINT8(1, lut[50 + 5 * g + 1]);
+    }
+}
+
+static void test_scale_lut_saturates(void)
+{
+    UBYTE out[105];
+    for (int g = 0; g < 10; g++) {
+        lut[50 + 5 * g] = 0xFF;
+        lut[50 + 5 * g + 3] = 200;
+    }
+    EPD_3IN7_ScaleLUT(lut, 150, out);
+    for (int g = 0; g < 10; g++) {
+        TEST_ASSERT_EQUAL_UINT8(0xFF, out[50 + 5 * g]);
+        TEST_ASSERT_EQUAL_UINT8(0xFF, out[50 + 5 * g + 3]);
+    }
+}
+
+// Unused phases stay off, voltage selects, repeat counts and the frame rate bytes are not timing
+static void test_scale_lut_leaves_zeros_and_other_bytes(void)
+{
+    UBYTE out[105];
+    for (int g = 0; g < 10; g++) lut[50 + 5 * g + 2] = 0;
+    EPD_3IN7_ScaleLUT(lut, 150, out);
+    for (int i = 0; i < 105; i++) {
+        bool tp = i >= 50 && i < 100 && (i - 50) % 5 < 4;
+        if (!tp || lut[i] == 0) TEST_ASSERT_EQUAL_UINT8(lut[i], out[i]);
+        else TEST_ASSERT_EQUAL_UINT8((lut[i] * 150 + 50) / 100 > 0xFF ? 0xFF : (lut[i] * 150 + 50) / 100, out[i]);
+    }
+}
+
+// 0x1B returns the integer part as a signed byte, the band follows it
+static void test_read_temperature(void)
+{
+    spi_read_bytes.push_back(0xF6);
+    spi_read_bytes.push_back(0x00);
+    TEST_ASSERT_EQUAL_INT(-10, EPD_3IN7_ReadTemperature());
+    TEST_ASSERT_EQUAL_UINT8(0, EPD_3IN7_GetTempBand());
+
+    spi_read_bytes.push_back(25);
+    spi_read_bytes.push_back(0x80);
+    TEST_ASSERT_EQUAL_INT(25, EPD_3IN7_ReadTemperature());
+    TEST_ASSERT_EQUAL_UINT8(3, EPD_3IN7_GetTempBand());
+    TEST_ASSERT_EQUAL_INT(2, sensorReads());
+}
+
+// The first full frame reads the sensor, then every TEMP_READ_FRAMES frames or TEMP_READ_INTERVAL_MS
+static void test_full_frames_rate_limit_sensor(void)
+{
+    setPage(PAGE_HOME);
+    temp_read = false;
+    displayCurrentPageFull();
+    TEST_ASSERT_EQUAL_INT(1, sensorReads());
+
+    for (int f = 1; f < TEMP_READ_FRAMES; f++) displayCurrentPageFull();
+    TEST_ASSERT_EQUAL_INT(1, sensorReads());
+    displayCurrentPageFull();
+    TEST_ASSERT_EQUAL_INT(2, sensorReads());
+
+    displayCurrentPageFull();
+    TEST_ASSERT_EQUAL_INT(2, sensorReads());
+    native_ticks += pdMS_TO_TICKS(TEMP_READ_INTERVAL_MS);
+    displayCurrentPageFull();
+    TEST_ASSERT_EQUAL_INT(3, sensorReads());
+}
+
+int main(int argc, char **argv)
+{
+    Display_Init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_band_edges);
+    RUN_TEST(test_band_scales);
+    RUN_TEST(test_scale_lut_clamps_to_one);
+    RUN_TEST(test_scale_lut_saturates);
+    RUN_TEST(test_scale_lut_leaves_zeros_and_other_bytes);
+    RUN_TEST(test_read_temperature);
+    RUN_TEST(test_full_frames_rate_limit_sensor);
+    return UNITY_END();
+}